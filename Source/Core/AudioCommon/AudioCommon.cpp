@@ -7,6 +7,7 @@
 #include <fmt/format.h>
 
 #include "AudioCommon/AlsaSoundStream.h"
+#include "AudioCommon/CaptureSoundStream.h"
 #include "AudioCommon/CubebStream.h"
 #include "AudioCommon/Mixer.h"
 #include "AudioCommon/NullSoundStream.h"
@@ -34,6 +35,8 @@ static std::unique_ptr<SoundStream> CreateSoundStreamForBackend(std::string_view
     return std::make_unique<OpenALStream>();
   else if (backend == BACKEND_NULLSOUND)
     return std::make_unique<NullSound>();
+  else if (backend == BACKEND_CAPTURE)
+    return std::make_unique<CaptureSoundStream>();
   else if (backend == BACKEND_ALSA && AlsaSound::IsValid())
     return std::make_unique<AlsaSound>();
   else if (backend == BACKEND_PULSEAUDIO && PulseAudio::IsValid())
@@ -116,6 +119,7 @@ std::vector<std::string> GetSoundBackends()
   std::vector<std::string> backends;
 
   backends.emplace_back(BACKEND_NULLSOUND);
+  backends.emplace_back(BACKEND_CAPTURE);
   backends.emplace_back(BACKEND_CUBEB);
   if (AlsaSound::IsValid())
     backends.emplace_back(BACKEND_ALSA);
@@ -205,6 +209,8 @@ void SendAIBuffer(Core::System& system, const short* samples, unsigned int num_s
   {
     mixer->PushSamples(samples, num_samples);
   }
+
+  sound_stream->OnAudioDMA(num_samples);
 }
 
 void StartAudioDump(Core::System& system)
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/CaptureSoundStream.h"
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Core/ConfigManager.h"
+
+CaptureSoundStream::~CaptureSoundStream()
+{
+  if (!m_writer.IsOpen())
+    return;
+
+  if (!m_block.empty())
+    PushBlock();
+  m_encoder_thread.Shutdown();
+
+  const double seconds = double(m_writer.GetSampleCount()) / m_mixer->GetSampleRate();
+  m_writer.Stop();
+  if (m_dropped_blocks != 0)
+  {
+    WARN_LOG_FMT(AUDIO, "Audio capture dropped {} blocks of {} frames", m_dropped_blocks,
+                 FlacWriter::BLOCK_SIZE);
+  }
+  NOTICE_LOG_FMT(AUDIO, "Audio capture finished, {:.1f} seconds written", seconds);
+}
+
+bool CaptureSoundStream::Init()
+{
+  const std::time_t start_time = std::time(nullptr);
+  const std::string path =
+      fmt::format("{}{}_{:%Y-%m-%d_%H-%M-%S}.flac", File::GetUserPath(D_DUMPAUDIO_IDX),
+                  SConfig::GetInstance().GetGameID(), fmt::localtime(start_time));
+  File::CreateFullPath(path);
+  if (!m_writer.Start(path, m_mixer->GetSampleRate()))
+  {
+    ERROR_LOG_FMT(AUDIO, "Unable to open {} for audio capture", path);
+    return false;
+  }
+
+  m_block.reserve(FlacWriter::BLOCK_SIZE * 2);
+  m_encoder_thread.Reset("Audio Capture Encoder", [this](std::vector<s16> block) {
+    m_writer.AddStereoSamples(block.data(), static_cast<u32>(block.size() / 2));
+    m_queued_blocks.fetch_sub(1, std::memory_order_release);
+  });
+
+  NOTICE_LOG_FMT(AUDIO, "Capturing audio to {}", path);
+  return true;
+}
+
+bool CaptureSoundStream::SetRunning(bool running)
+{
+  // Nothing is mixed while the emulation is paused, so the file simply stays open.
+  return true;
+}
+
+void CaptureSoundStream::OnAudioDMA(unsigned int num_samples)
+{
+  if (!m_writer.IsOpen())
+    return;
+
+  m_pending_time += u64(num_samples) * m_mixer->GetDMAInputSampleRateDivisor() *
+                    m_mixer->GetSampleRate();
+  m_pending_frames += static_cast<u32>(m_pending_time / Mixer::FIXED_SAMPLE_RATE_DIVIDEND);
+  m_pending_time %= Mixer::FIXED_SAMPLE_RATE_DIVIDEND;
+
+  if (m_pending_frames >= MIX_GRANULARITY)
+    MixPendingFrames();
+}
+
+void CaptureSoundStream::MixPendingFrames()
+{
+  while (m_pending_frames != 0)
+  {
+    const u32 buffered = static_cast<u32>(m_block.size() / 2);
+    const u32 count = std::min(m_pending_frames, FlacWriter::BLOCK_SIZE - buffered);
+    m_block.resize((buffered + count) * 2);
+    m_mixer->MixInEmulatedTime(&m_block[buffered * 2], count);
+    m_pending_frames -= count;
+
+    if (m_block.size() == FlacWriter::BLOCK_SIZE * 2)
+      PushBlock();
+  }
+}
+
+void CaptureSoundStream::PushBlock()
+{
+  // Encoding normally takes a small fraction of real time. If the encoder falls behind anyway,
+  // audio is dropped rather than stalling the emulation or growing the queue without bound.
+  if (m_queued_blocks.load(std::memory_order_acquire) >= MAX_QUEUED_BLOCKS)
+  {
+    if (m_dropped_blocks++ == 0)
+      WARN_LOG_FMT(AUDIO, "Audio capture encoder is falling behind, dropping audio");
+    m_block.clear();
+    return;
+  }
+
+  m_queued_blocks.fetch_add(1, std::memory_order_relaxed);
+  std::vector<s16> block;
+  block.reserve(FlacWriter::BLOCK_SIZE * 2);
+  std::swap(block, m_block);
+  m_encoder_thread.Push(std::move(block));
+}
@@ -0,0 +1,46 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "AudioCommon/FlacWriter.h"
+#include "AudioCommon/SoundStream.h"
+#include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
+
+// Writes the mixed audio to a FLAC file instead of playing it, for headless runs and machines
+// without an audio device. The mixer is pulled from the emulation thread in emulated time, so the
+// capture stays in sync with the game regardless of the emulation speed.
+class CaptureSoundStream final : public SoundStream
+{
+public:
+  ~CaptureSoundStream() override;
+
+  bool Init() override;
+  bool SetRunning(bool running) override;
+  void OnAudioDMA(unsigned int num_samples) override;
+
+  static bool IsValid() { return true; }
+
+private:
+  // Frames mixed at once, about 10 ms
+  static constexpr u32 MIX_GRANULARITY = 512;
+  // Blocks waiting for the encoder before new ones get dropped, about 1.4 seconds
+  static constexpr u32 MAX_QUEUED_BLOCKS = 16;
+
+  void MixPendingFrames();
+  void PushBlock();
+
+  FlacWriter m_writer;
+  Common::WorkQueueThread<std::vector<s16>> m_encoder_thread;
+  std::atomic<u32> m_queued_blocks{0};
+  u64 m_dropped_blocks = 0;
+
+  std::vector<s16> m_block;
+  // Emulated time in units of 1 / Mixer::FIXED_SAMPLE_RATE_DIVIDEND output frames
+  u64 m_pending_time = 0;
+  u32 m_pending_frames = 0;
+};
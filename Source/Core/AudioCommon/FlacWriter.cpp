@@ -0,0 +1,463 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/FlacWriter.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace
+{
+constexpr u32 MAX_FIXED_ORDER = 4;
+constexpr u32 MAX_PARTITION_ORDER = 8;
+constexpr u32 MAX_RICE_PARAMETER = 14;
+constexpr u32 STREAMINFO_SIZE = 34;
+
+enum class ChannelAssignment : u32
+{
+  Independent = 1,
+  LeftSide = 8,
+  SideRight = 9,
+  MidSide = 10,
+};
+
+class BitWriter
+{
+public:
+  void Write(u32 value, u32 bits)
+  {
+    if (bits == 0)
+      return;
+    m_acc = (m_acc << bits) | (value & (u64(-1) >> (64 - bits)));
+    m_bits += bits;
+    while (m_bits >= 8)
+    {
+      m_bits -= 8;
+      m_bytes.push_back(u8(m_acc >> m_bits));
+    }
+    m_acc &= (u64(1) << m_bits) - 1;
+  }
+
+  void WriteSigned(s32 value, u32 bits) { Write(u32(value), bits); }
+
+  // Writes <count> zeros followed by a one.
+  void WriteUnary(u32 count)
+  {
+    for (; count >= 32; count -= 32)
+      Write(0, 32);
+    Write(1, count + 1);
+  }
+
+  void AlignToByte()
+  {
+    if (m_bits != 0)
+      Write(0, 8 - m_bits);
+  }
+
+  std::vector<u8>& GetBytes() { return m_bytes; }
+
+private:
+  std::vector<u8> m_bytes;
+  u64 m_acc = 0;
+  u32 m_bits = 0;
+};
+
+template <typename T, T Polynomial>
+constexpr std::array<T, 256> MakeCRCTable()
+{
+  constexpr u32 shift = sizeof(T) * 8 - 8;
+  std::array<T, 256> table{};
+  for (u32 i = 0; i < 256; ++i)
+  {
+    T crc = T(i << shift);
+    for (int bit = 0; bit < 8; ++bit)
+      crc = T(crc & (T(1) << (shift + 7)) ? (crc << 1) ^ Polynomial : crc << 1);
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr auto CRC8_TABLE = MakeCRCTable<u8, 0x07>();
+constexpr auto CRC16_TABLE = MakeCRCTable<u16, 0x8005>();
+
+u8 CRC8(const u8* data, size_t size)
+{
+  u8 crc = 0;
+  for (size_t i = 0; i < size; ++i)
+    crc = CRC8_TABLE[crc ^ data[i]];
+  return crc;
+}
+
+u16 CRC16(const u8* data, size_t size)
+{
+  u16 crc = 0;
+  for (size_t i = 0; i < size; ++i)
+    crc = u16(crc << 8) ^ CRC16_TABLE[(crc >> 8) ^ data[i]];
+  return crc;
+}
+
+u32 FoldSigned(s32 value)
+{
+  return (u32(value) << 1) ^ u32(value >> 31);
+}
+
+s32 FixedResidual(const s32* x, u32 i, u32 order)
+{
+  switch (order)
+  {
+  case 0:
+    return x[i];
+  case 1:
+    return x[i] - x[i - 1];
+  case 2:
+    return x[i] - 2 * x[i - 1] + x[i - 2];
+  case 3:
+    return x[i] - 3 * x[i - 1] + 3 * x[i - 2] - x[i - 3];
+  default:
+    return x[i] - 4 * x[i - 1] + 6 * x[i - 2] - 4 * x[i - 3] + x[i - 4];
+  }
+}
+
+// How a channel gets encoded, along with its size in bits.
+struct Subframe
+{
+  enum class Type
+  {
+    Constant,
+    Verbatim,
+    Fixed,
+  };
+
+  Type type = Type::Verbatim;
+  u32 order = 0;
+  u32 partition_order = 0;
+  std::array<u8, 1 << MAX_PARTITION_ORDER> rice_parameters{};
+  u64 bits = std::numeric_limits<u64>::max();
+};
+
+// Finds the best Rice parameter for the folded residuals of one partition, returning its size.
+u64 PlanPartition(const u32* folded, u32 count, u8* parameter)
+{
+  u64 sum = 0;
+  for (u32 i = 0; i < count; ++i)
+    sum += folded[i];
+
+  // The best parameter is close to log2 of the mean, so only try its neighbours.
+  const u64 mean = count != 0 ? sum / count : 0;
+  const u32 estimate =
+      mean != 0 ? std::min(u32(std::bit_width(mean) - 1), MAX_RICE_PARAMETER) : 0;
+  u64 best_bits = std::numeric_limits<u64>::max();
+  for (u32 k = estimate > 0 ? estimate - 1 : 0; k <= std::min(estimate + 1, MAX_RICE_PARAMETER);
+       ++k)
+  {
+    u64 bits = u64(count) * (k + 1);
+    for (u32 i = 0; i < count; ++i)
+      bits += folded[i] >> k;
+    if (bits < best_bits)
+    {
+      best_bits = bits;
+      *parameter = u8(k);
+    }
+  }
+  return best_bits + 4;
+}
+
+Subframe PlanSubframe(const s32* x, u32 count, u32 bps)
+{
+  Subframe best;
+  best.type = Subframe::Type::Verbatim;
+  best.bits = 8 + u64(count) * bps;
+
+  if (std::all_of(x, x + count, [&](s32 sample) { return sample == x[0]; }))
+  {
+    best.type = Subframe::Type::Constant;
+    best.bits = 8 + bps;
+    return best;
+  }
+
+  // Pick the predictor order with the smallest residuals, as libFLAC does for its fixed
+  // predictors. Only samples which all orders can predict are compared.
+  const u32 max_order = std::min(MAX_FIXED_ORDER, count - 1);
+  u32 order = 0;
+  u64 smallest = std::numeric_limits<u64>::max();
+  for (u32 o = 0; o <= max_order; ++o)
+  {
+    u64 total = 0;
+    for (u32 i = max_order; i < count; ++i)
+      total += u64(std::abs(s64(FixedResidual(x, i, o))));
+    if (total < smallest)
+    {
+      smallest = total;
+      order = o;
+    }
+  }
+
+  std::array<u32, FlacWriter::BLOCK_SIZE> folded;
+  for (u32 i = order; i < count; ++i)
+    folded[i] = FoldSigned(FixedResidual(x, i, order));
+
+  for (u32 partition_order = 0; partition_order <= MAX_PARTITION_ORDER; ++partition_order)
+  {
+    const u32 partition_size = count >> partition_order;
+    if ((partition_size << partition_order) != count || partition_size <= order)
+      break;
+
+    Subframe candidate;
+    candidate.type = Subframe::Type::Fixed;
+    candidate.order = order;
+    candidate.partition_order = partition_order;
+    candidate.bits = 8 + u64(order) * bps + 2 + 4;
+    for (u32 partition = 0; partition < (1u << partition_order); ++partition)
+    {
+      const u32 start = partition == 0 ? order : partition * partition_size;
+      const u32 end = (partition + 1) * partition_size;
+      candidate.bits += PlanPartition(&folded[start], end - start,
+                                      &candidate.rice_parameters[partition]);
+    }
+
+    if (candidate.bits < best.bits)
+      best = candidate;
+  }
+
+  return best;
+}
+
+void WriteSubframe(BitWriter& writer, const Subframe& subframe, const s32* x, u32 count, u32 bps)
+{
+  switch (subframe.type)
+  {
+  case Subframe::Type::Constant:
+    writer.Write(0b0'000000'0, 8);
+    writer.WriteSigned(x[0], bps);
+    return;
+  case Subframe::Type::Verbatim:
+    writer.Write(0b0'000001'0, 8);
+    for (u32 i = 0; i < count; ++i)
+      writer.WriteSigned(x[i], bps);
+    return;
+  case Subframe::Type::Fixed:
+    break;
+  }
+
+  writer.Write((0b001000 | subframe.order) << 1, 8);
+  for (u32 i = 0; i < subframe.order; ++i)
+    writer.WriteSigned(x[i], bps);
+
+  // Residual coding method 0: partitioned Rice coding with 4-bit parameters
+  writer.Write(0, 2);
+  writer.Write(subframe.partition_order, 4);
+  const u32 partition_size = count >> subframe.partition_order;
+  for (u32 partition = 0; partition < (1u << subframe.partition_order); ++partition)
+  {
+    const u32 k = subframe.rice_parameters[partition];
+    writer.Write(k, 4);
+    const u32 start = partition == 0 ? subframe.order : partition * partition_size;
+    const u32 end = (partition + 1) * partition_size;
+    for (u32 i = start; i < end; ++i)
+    {
+      const u32 folded = FoldSigned(FixedResidual(x, i, subframe.order));
+      writer.WriteUnary(folded >> k);
+      writer.Write(folded, k);
+    }
+  }
+}
+
+void WriteUTF8(BitWriter& writer, u32 value)
+{
+  if (value < 0x80)
+  {
+    writer.Write(value, 8);
+    return;
+  }
+
+  u32 continuation_bytes = 1;
+  while (value >> (5 * continuation_bytes + 6) != 0)
+    ++continuation_bytes;
+
+  // The first byte starts with a one for every byte of the sequence, followed by a zero.
+  const u32 prefix = (0xff00u >> (continuation_bytes + 1)) & 0xff;
+  writer.Write(prefix | (value >> (6 * continuation_bytes)), 8);
+  for (u32 i = continuation_bytes; i-- > 0;)
+    writer.Write(0x80 | ((value >> (6 * i)) & 0x3f), 8);
+}
+}  // namespace
+
+FlacWriter::FlacWriter() = default;
+
+FlacWriter::~FlacWriter()
+{
+  Stop();
+}
+
+bool FlacWriter::Start(const std::string& filename, u32 sample_rate)
+{
+  if (m_file.IsOpen())
+  {
+    ERROR_LOG_FMT(AUDIO, "FLAC file {} was already open", filename);
+    return false;
+  }
+
+  if (!m_file.Open(filename, "wb"))
+  {
+    ERROR_LOG_FMT(AUDIO, "Could not open {} for writing", filename);
+    return false;
+  }
+
+  m_sample_rate = sample_rate;
+  m_sample_count = 0;
+  m_frame_number = 0;
+  m_min_frame_size = std::numeric_limits<u32>::max();
+  m_max_frame_size = 0;
+  m_buffered = 0;
+
+  m_file.WriteBytes("fLaC", 4);
+  // Written again with the final sizes once the stream ends
+  WriteStreamInfo();
+  return true;
+}
+
+void FlacWriter::Stop()
+{
+  if (!m_file.IsOpen())
+    return;
+
+  if (m_buffered != 0)
+    EncodeFrame();
+
+  m_file.Seek(4, File::SeekOrigin::Begin);
+  WriteStreamInfo();
+  m_file.Close();
+}
+
+void FlacWriter::WriteStreamInfo()
+{
+  BitWriter writer;
+  // Last metadata block, type 0 (STREAMINFO)
+  writer.Write(1, 1);
+  writer.Write(0, 7);
+  writer.Write(STREAMINFO_SIZE, 24);
+
+  writer.Write(BLOCK_SIZE, 16);
+  writer.Write(BLOCK_SIZE, 16);
+  const bool has_frames = m_max_frame_size != 0;
+  writer.Write(has_frames ? m_min_frame_size : 0, 24);
+  writer.Write(has_frames ? m_max_frame_size : 0, 24);
+  writer.Write(m_sample_rate, 20);
+  writer.Write(2 - 1, 3);
+  writer.Write(16 - 1, 5);
+  writer.Write(u32(m_sample_count >> 32), 4);
+  writer.Write(u32(m_sample_count), 32);
+  // The MD5 signature of the audio is optional and left unset.
+  for (int i = 0; i < 4; ++i)
+    writer.Write(0, 32);
+
+  m_file.WriteBytes(writer.GetBytes().data(), writer.GetBytes().size());
+}
+
+void FlacWriter::AddStereoSamples(const s16* samples, u32 count)
+{
+  while (count != 0)
+  {
+    const u32 chunk = std::min(count, BLOCK_SIZE - m_buffered);
+    for (u32 i = 0; i < chunk; ++i)
+    {
+      m_left[m_buffered + i] = samples[i * 2];
+      m_right[m_buffered + i] = samples[i * 2 + 1];
+    }
+    m_buffered += chunk;
+    samples += chunk * 2;
+    count -= chunk;
+
+    if (m_buffered == BLOCK_SIZE)
+      EncodeFrame();
+  }
+}
+
+void FlacWriter::EncodeFrame()
+{
+  const u32 count = m_buffered;
+  m_buffered = 0;
+
+  std::array<s32, BLOCK_SIZE> mid;
+  std::array<s32, BLOCK_SIZE> side;
+  for (u32 i = 0; i < count; ++i)
+  {
+    mid[i] = (m_left[i] + m_right[i]) >> 1;
+    side[i] = m_left[i] - m_right[i];
+  }
+
+  const Subframe left = PlanSubframe(m_left.data(), count, 16);
+  const Subframe right = PlanSubframe(m_right.data(), count, 16);
+  const Subframe mid_subframe = PlanSubframe(mid.data(), count, 16);
+  const Subframe side_subframe = PlanSubframe(side.data(), count, 17);
+
+  // Use whichever pair of channels is the smallest.
+  ChannelAssignment assignment = ChannelAssignment::Independent;
+  u64 bits = left.bits + right.bits;
+  if (left.bits + side_subframe.bits < bits)
+  {
+    assignment = ChannelAssignment::LeftSide;
+    bits = left.bits + side_subframe.bits;
+  }
+  if (side_subframe.bits + right.bits < bits)
+  {
+    assignment = ChannelAssignment::SideRight;
+    bits = side_subframe.bits + right.bits;
+  }
+  if (mid_subframe.bits + side_subframe.bits < bits)
+    assignment = ChannelAssignment::MidSide;
+
+  BitWriter writer;
+  writer.Write(0b11111111111110, 14);
+  // Reserved, fixed block size stream
+  writer.Write(0, 2);
+  // The block size either is the usual one, or follows the header as a 16-bit number.
+  writer.Write(count == BLOCK_SIZE ? 0b1100 : 0b0111, 4);
+  // Sample rate from STREAMINFO
+  writer.Write(0, 4);
+  writer.Write(static_cast<u32>(assignment), 4);
+  // 16 bits per sample, reserved
+  writer.Write(0b100, 3);
+  writer.Write(0, 1);
+  WriteUTF8(writer, m_frame_number);
+  if (count != BLOCK_SIZE)
+    writer.Write(count - 1, 16);
+  writer.Write(CRC8(writer.GetBytes().data(), writer.GetBytes().size()), 8);
+
+  switch (assignment)
+  {
+  case ChannelAssignment::Independent:
+    WriteSubframe(writer, left, m_left.data(), count, 16);
+    WriteSubframe(writer, right, m_right.data(), count, 16);
+    break;
+  case ChannelAssignment::LeftSide:
+    WriteSubframe(writer, left, m_left.data(), count, 16);
+    WriteSubframe(writer, side_subframe, side.data(), count, 17);
+    break;
+  case ChannelAssignment::SideRight:
+    WriteSubframe(writer, side_subframe, side.data(), count, 17);
+    WriteSubframe(writer, right, m_right.data(), count, 16);
+    break;
+  case ChannelAssignment::MidSide:
+    WriteSubframe(writer, mid_subframe, mid.data(), count, 16);
+    WriteSubframe(writer, side_subframe, side.data(), count, 17);
+    break;
+  }
+
+  writer.AlignToByte();
+  writer.Write(CRC16(writer.GetBytes().data(), writer.GetBytes().size()), 16);
+
+  const std::vector<u8>& bytes = writer.GetBytes();
+  m_file.WriteBytes(bytes.data(), bytes.size());
+  m_min_frame_size = std::min(m_min_frame_size, u32(bytes.size()));
+  m_max_frame_size = std::max(m_max_frame_size, u32(bytes.size()));
+  m_sample_count += count;
+  ++m_frame_number;
+}
@@ -0,0 +1,51 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+// Streams 16-bit stereo audio to a FLAC file. The encoder only uses the fixed predictors of the
+// format, which keeps it fast enough to run next to the emulation while still compressing game
+// audio considerably better than PCM.
+class FlacWriter
+{
+public:
+  static constexpr u32 BLOCK_SIZE = 4096;
+
+  FlacWriter();
+  ~FlacWriter();
+
+  FlacWriter(const FlacWriter&) = delete;
+  FlacWriter& operator=(const FlacWriter&) = delete;
+  FlacWriter(FlacWriter&&) = delete;
+  FlacWriter& operator=(FlacWriter&&) = delete;
+
+  bool Start(const std::string& filename, u32 sample_rate);
+  void Stop();
+  bool IsOpen() const { return m_file.IsOpen(); }
+
+  // Interleaved samples in host byte order
+  void AddStereoSamples(const s16* samples, u32 count);
+
+  u64 GetSampleCount() const { return m_sample_count; }
+
+private:
+  void WriteStreamInfo();
+  void EncodeFrame();
+
+  File::IOFile m_file;
+  u32 m_sample_rate = 0;
+  u64 m_sample_count = 0;
+  u32 m_frame_number = 0;
+  u32 m_min_frame_size = 0;
+  u32 m_max_frame_size = 0;
+
+  std::array<s32, BLOCK_SIZE> m_left{};
+  std::array<s32, BLOCK_SIZE> m_right{};
+  u32 m_buffered = 0;
+};
@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "AudioCommon/Enums.h"
+#include "AudioCommon/MixerResampler.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -58,19 +59,14 @@ void Mixer::DoState(PointerWrap& p)
 }
 
 // Executed from sound stream thread
-unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
-                                   bool consider_framelimit, float emulationspeed,
-                                   int timing_variance)
+unsigned int Mixer::MixerFifo::Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
+                                   float emulationspeed, int timing_variance)
 {
-  unsigned int currentSample = 0;
-
   // Cache access in non-volatile variable
   // This is the only function changing the read value, so it's safe to
   // cache it locally although it's written here.
   // The writing pointer will be modified outside, but it will only increase,
   // so we will just ignore new written data while interpolating.
-  // Without this cache, the compiler wouldn't be allowed to optimize the
-  // interpolation loop.
   u32 indexR = m_indexR.load();
   u32 indexW = m_indexW.load();
 
@@ -103,50 +99,59 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
-  const auto read_buffer = [this](auto index) {
-    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
-  };
+  // The samples are resampled in blocks, each of which first gets converted to one array per
+  // channel in host byte order.
+  std::array<s16, RESAMPLER_BLOCK_SIZE> left;
+  std::array<s16, RESAMPLER_BLOCK_SIZE> right;
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  unsigned int currentSample = 0;
+  while (currentSample < numSamples)
   {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
+    const u32 available = ((indexW - indexR) & INDEX_MASK) / 2;
+    const u32 block_size = std::min(available, RESAMPLER_BLOCK_SIZE);
+    const u32 count =
+        std::min(numSamples - currentSample,
+                 AudioCommon::GetResamplerOutputCount(block_size, m_frac, ratio));
+    if (count == 0)
+      break;
+
+    // Only convert the frames the filter reads for these output frames.
+    const u32 input_frames =
+        static_cast<u32>((m_frac + u64(count - 1) * ratio) >> 16) + AudioCommon::RESAMPLER_TAPS;
+    const u32 first_part = std::min(input_frames, (MAX_SAMPLES * 2 - (indexR & INDEX_MASK)) / 2);
+    AudioCommon::DeinterleaveStereo(&m_buffer[indexR & INDEX_MASK], left.data(), right.data(),
+                                    first_part, !m_little_endian);
+    AudioCommon::DeinterleaveStereo(&m_buffer[0], left.data() + first_part,
+                                    right.data() + first_part, input_frames - first_part,
+                                    !m_little_endian);
+
+    u32 consumed =
+        AudioCommon::ResampleAndMix(left.data(), right.data(), &samples[currentSample * 2], count,
+                                    &m_frac, ratio, lvolume, rvolume);
+    // Don't move past the samples that have been written when running at very high speeds.
+    consumed = std::min(consumed, available - (AudioCommon::RESAMPLER_TAPS - 1));
+    indexR += consumed * 2;
+    currentSample += count;
   }
 
   // Actual number of samples written to the buffer without padding.
-  unsigned int actual_sample_count = currentSample / 2;
-
-  // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
-  s[0] = (s[0] * rvolume) >> 8;
-  s[1] = (s[1] * lvolume) >> 8;
-  for (; currentSample < numSamples * 2; currentSample += 2)
+  unsigned int actual_sample_count = currentSample;
+
+  // Padding with the sample at the current position, or the last one written if the FIFO ran
+  // out of samples before reaching it.
+  const u32 available = ((indexW - indexR) & INDEX_MASK) / 2;
+  const u32 pad_index =
+      available > AudioCommon::RESAMPLER_HISTORY ? indexR + AudioCommon::RESAMPLER_HISTORY * 2 :
+                                                    indexW - 2;
+  const auto read_buffer = [this](auto index) -> s16 {
+    return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
+  };
+  const s32 padR = (read_buffer((pad_index + 1) & INDEX_MASK) * rvolume) >> 8;
+  const s32 padL = (read_buffer(pad_index & INDEX_MASK) * lvolume) >> 8;
+  for (; currentSample < numSamples; ++currentSample)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
-
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+    samples[currentSample * 2 + 0] += padR;
+    samples[currentSample * 2 + 1] += padL;
   }
 
   // Flush cached variable
@@ -155,13 +160,34 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   return actual_sample_count;
 }
 
+void Mixer::MixFifos(short* samples, unsigned int num_samples, bool consider_framelimit,
+                     float emulation_speed, int timing_variance)
+{
+  // The sources are added up at full precision and only clamped once at the end.
+  std::fill_n(m_mix_buffer.begin(), num_samples * 2, 0);
+
+  m_dma_mixer.Mix(m_mix_buffer.data(), num_samples, consider_framelimit, emulation_speed,
+                  timing_variance);
+  m_streaming_mixer.Mix(m_mix_buffer.data(), num_samples, consider_framelimit, emulation_speed,
+                        timing_variance);
+  m_wiimote_speaker_mixer.Mix(m_mix_buffer.data(), num_samples, consider_framelimit,
+                              emulation_speed, timing_variance);
+  m_skylander_portal_mixer.Mix(m_mix_buffer.data(), num_samples, consider_framelimit,
+                               emulation_speed, timing_variance);
+  for (auto& mixer : m_gba_mixers)
+  {
+    mixer.Mix(m_mix_buffer.data(), num_samples, consider_framelimit, emulation_speed,
+              timing_variance);
+  }
+
+  AudioCommon::ClampMixedSamples(m_mix_buffer.data(), samples, num_samples * 2);
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
     return 0;
 
-  memset(samples, 0, num_samples * 2 * sizeof(short));
-
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
@@ -176,21 +202,7 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
                m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
                available_samples, MAX_SAMPLES, num_samples);
 
-    m_scratch_buffer.fill(0);
-
-    m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
-    m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
-    m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
-    m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                 timing_variance);
-    for (auto& mixer : m_gba_mixers)
-    {
-      mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
-    }
+    MixFifos(m_scratch_buffer.data(), available_samples, false, emulation_speed, timing_variance);
 
     if (!m_is_stretching)
     {
@@ -202,18 +214,27 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    // Requests larger than the mixing buffer are split up.
+    for (unsigned int offset = 0; offset < num_samples; offset += MAX_SAMPLES)
+    {
+      MixFifos(samples + offset * 2, std::min(num_samples - offset, MAX_SAMPLES), true,
+               emulation_speed, timing_variance);
+    }
     m_is_stretching = false;
   }
 
   return num_samples;
 }
 
+void Mixer::MixInEmulatedTime(short* samples, unsigned int num_samples)
+{
+  for (unsigned int offset = 0; offset < num_samples; offset += MAX_SAMPLES)
+  {
+    MixFifos(samples + offset * 2, std::min(num_samples - offset, MAX_SAMPLES), true, 1.0f,
+             m_config_timing_variance);
+  }
+}
+
 unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 {
   if (!num_samples)
@@ -354,6 +375,11 @@ void Mixer::SetDMAInputSampleRateDivisor(unsigned int rate_divisor)
   m_dma_mixer.SetInputSampleRateDivisor(rate_divisor);
 }
 
+unsigned int Mixer::GetDMAInputSampleRateDivisor() const
+{
+  return m_dma_mixer.GetInputSampleRateDivisor();
+}
+
 void Mixer::SetStreamInputSampleRateDivisor(unsigned int rate_divisor)
 {
   m_streaming_mixer.SetInputSampleRateDivisor(rate_divisor);
@@ -491,8 +517,10 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
   unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * static_cast<u64>(m_mixer->m_sampleRate) *
+  // Mixer::MixerFifo::Mix always keeps the samples the filter reads around the current position.
+  if (samples_in_fifo < AudioCommon::RESAMPLER_TAPS)
+    return 0;
+  return (samples_in_fifo - (AudioCommon::RESAMPLER_TAPS - 1)) *
+         static_cast<u64>(m_mixer->m_sampleRate) *
          m_input_sample_rate_divisor / FIXED_SAMPLE_RATE_DIVIDEND;
 }
@@ -26,6 +26,10 @@ public:
   unsigned int Mix(short* samples, unsigned int numSamples);
   unsigned int MixSurround(float* samples, unsigned int num_samples);
 
+  // Called from the emulation thread by streams which consume samples in emulated time rather
+  // than at the pace of an audio device, so the emulation speed setting doesn't apply.
+  void MixInEmulatedTime(short* samples, unsigned int num_samples);
+
   // Called from main thread
   void PushSamples(const short* samples, unsigned int num_samples);
   void PushStreamingSamples(const short* samples, unsigned int num_samples);
@@ -35,6 +39,7 @@ public:
   void PushGBASamples(int device_number, const short* samples, unsigned int num_samples);
 
   unsigned int GetSampleRate() const { return m_sampleRate; }
+  unsigned int GetDMAInputSampleRateDivisor() const;
 
   void SetDMAInputSampleRateDivisor(unsigned int rate_divisor);
   void SetStreamInputSampleRateDivisor(unsigned int rate_divisor);
@@ -59,6 +64,8 @@ private:
   static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
+  // Input frames converted for the resampler at once
+  static constexpr u32 RESAMPLER_BLOCK_SIZE = 1024;
 
   const unsigned int SURROUND_CHANNELS = 6;
 
@@ -72,7 +79,7 @@ private:
     }
     void DoState(PointerWrap& p);
     void PushSamples(const short* samples, unsigned int num_samples);
-    unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
+    unsigned int Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
                      float emulationspeed, int timing_variance);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
@@ -86,6 +93,7 @@ private:
     bool m_little_endian;
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
     std::atomic<u32> m_indexW{0};
+    // Oldest sample the resampler still needs, which keeps it from being overwritten
     std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
@@ -94,6 +102,9 @@ private:
     u32 m_frac = 0;
   };
 
+  void MixFifos(short* samples, unsigned int num_samples, bool consider_framelimit,
+                float emulation_speed, int timing_variance);
+
   void RefreshConfig();
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
@@ -110,6 +121,7 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  std::array<s32, MAX_SAMPLES * 2> m_mix_buffer{};
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
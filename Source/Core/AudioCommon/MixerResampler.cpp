@@ -0,0 +1,177 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AudioCommon/MixerResampler.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "Common/Swap.h"
+
+#ifdef _M_X86_64
+#include <immintrin.h>
+#endif
+
+namespace AudioCommon
+{
+namespace
+{
+constexpr u32 PHASE_BITS = 7;
+constexpr u32 PHASES = 1 << PHASE_BITS;
+constexpr int COEF_SHIFT = 14;
+// Cutoff frequency relative to the input Nyquist frequency. Slightly below 1 so that the filter
+// still attenuates images with only eight taps.
+constexpr double CUTOFF = 0.9;
+
+using FilterTable = std::array<std::array<s16, RESAMPLER_TAPS>, PHASES>;
+
+FilterTable MakeFilterTable()
+{
+  FilterTable table{};
+  for (u32 phase = 0; phase < PHASES; ++phase)
+  {
+    std::array<double, RESAMPLER_TAPS> taps;
+    double sum = 0.0;
+    for (u32 tap = 0; tap < RESAMPLER_TAPS; ++tap)
+    {
+      const double x = double(tap) - RESAMPLER_HISTORY - double(phase) / PHASES;
+      const double sinc_x = std::numbers::pi * CUTOFF * x;
+      const double sinc = x == 0.0 ? 1.0 : std::sin(sinc_x) / sinc_x;
+      // Blackman window over the span of the taps
+      const double w = std::numbers::pi * (x / (RESAMPLER_TAPS / 2) + 1.0);
+      const double window = 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w);
+      taps[tap] = sinc * window;
+      sum += taps[tap];
+    }
+
+    // Normalize every phase to unity gain, putting the rounding error into the largest tap.
+    int fixed_sum = 0;
+    for (u32 tap = 0; tap < RESAMPLER_TAPS; ++tap)
+    {
+      table[phase][tap] = s16(std::lround(taps[tap] / sum * (1 << COEF_SHIFT)));
+      fixed_sum += table[phase][tap];
+    }
+    const auto largest = std::max_element(table[phase].begin(), table[phase].end());
+    *largest += (1 << COEF_SHIFT) - fixed_sum;
+  }
+  return table;
+}
+
+const FilterTable& GetFilterTable()
+{
+  static const FilterTable table = MakeFilterTable();
+  return table;
+}
+
+void MixFrame(s32* out, s32 left, s32 right, s32 left_volume, s32 right_volume)
+{
+  out[0] += (right * right_volume) >> 8;
+  out[1] += (left * left_volume) >> 8;
+}
+}  // namespace
+
+void DeinterleaveStereo(const s16* input, s16* left, s16* right, u32 frames, bool byte_swap)
+{
+  u32 i = 0;
+#ifdef _M_X86_64
+  for (; i + 8 <= frames; i += 8)
+  {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 2));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 2 + 8));
+    if (byte_swap)
+    {
+      a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+      b = _mm_or_si128(_mm_slli_epi16(b, 8), _mm_srli_epi16(b, 8));
+    }
+    // The shifts keep the sign of the first channel, which makes the saturating pack exact.
+    const __m128i l = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                                      _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+    const __m128i r = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(left + i), l);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(right + i), r);
+  }
+#endif
+  for (; i < frames; ++i)
+  {
+    left[i] = byte_swap ? Common::swap16(input[i * 2]) : input[i * 2];
+    right[i] = byte_swap ? Common::swap16(input[i * 2 + 1]) : input[i * 2 + 1];
+  }
+}
+
+u32 GetResamplerOutputCount(u32 input_frames, u32 frac, u32 ratio)
+{
+  if (input_frames < RESAMPLER_TAPS)
+    return 0;
+
+  // Output frame n reads the input frames starting at (frac + n * ratio) >> 16.
+  if (ratio == 0)
+    return std::numeric_limits<u32>::max();
+  const u64 last_position = u64(input_frames - RESAMPLER_TAPS) << 16 | 0xffff;
+  return u32(std::min<u64>((last_position - frac) / ratio + 1, std::numeric_limits<u32>::max()));
+}
+
+u32 ResampleAndMix(const s16* left, const s16* right, s32* out, u32 count, u32* frac, u32 ratio,
+                   s32 left_volume, s32 right_volume)
+{
+  const FilterTable& table = GetFilterTable();
+  u32 position = *frac;
+  u32 consumed = 0;
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16* coeffs = table[(position >> (16 - PHASE_BITS)) & (PHASES - 1)].data();
+#ifdef _M_X86_64
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(coeffs));
+    const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + consumed));
+    const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + consumed));
+    const __m128i products_l = _mm_madd_epi16(l, c);
+    const __m128i products_r = _mm_madd_epi16(r, c);
+    // Sum up both channels at once, ending with the left sum in lane 0 and the right one in 1.
+    __m128i sums = _mm_add_epi32(_mm_unpacklo_epi32(products_l, products_r),
+                                 _mm_unpackhi_epi32(products_l, products_r));
+    sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+    sums = _mm_srai_epi32(_mm_add_epi32(sums, _mm_set1_epi32(1 << (COEF_SHIFT - 1))), COEF_SHIFT);
+    const s32 sample_l = _mm_cvtsi128_si32(sums);
+    const s32 sample_r = _mm_cvtsi128_si32(_mm_srli_si128(sums, 4));
+#else
+    s32 sum_l = 0;
+    s32 sum_r = 0;
+    for (u32 tap = 0; tap < RESAMPLER_TAPS; ++tap)
+    {
+      sum_l += left[consumed + tap] * coeffs[tap];
+      sum_r += right[consumed + tap] * coeffs[tap];
+    }
+    const s32 sample_l = (sum_l + (1 << (COEF_SHIFT - 1))) >> COEF_SHIFT;
+    const s32 sample_r = (sum_r + (1 << (COEF_SHIFT - 1))) >> COEF_SHIFT;
+#endif
+    MixFrame(out + i * 2, sample_l, sample_r, left_volume, right_volume);
+
+    position += ratio;
+    consumed += position >> 16;
+    position &= 0xffff;
+  }
+
+  *frac = position;
+  return consumed;
+}
+
+void ClampMixedSamples(const s32* input, s16* output, u32 count)
+{
+  u32 i = 0;
+#ifdef _M_X86_64
+  const __m128i min = _mm_set1_epi16(-32767);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 4));
+    const __m128i packed = _mm_max_epi16(_mm_packs_epi32(a, b), min);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+  }
+#endif
+  for (; i < count; ++i)
+    output[i] = s16(std::clamp(input[i], -32767, 32767));
+}
+}  // namespace AudioCommon
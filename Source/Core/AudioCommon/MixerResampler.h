@@ -0,0 +1,33 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Block based resampling for the mixer FIFOs. The input is converted to one array per channel
+// first, which lets the polyphase filter load all of its taps for an output sample at once.
+
+namespace AudioCommon
+{
+// Number of input frames the filter reads for each output frame.
+constexpr u32 RESAMPLER_TAPS = 8;
+// Number of those frames which come before the position of the output frame.
+constexpr u32 RESAMPLER_HISTORY = RESAMPLER_TAPS / 2 - 1;
+
+// Splits interleaved stereo samples into two arrays, optionally swapping the byte order.
+void DeinterleaveStereo(const s16* input, s16* left, s16* right, u32 frames, bool byte_swap);
+
+// Returns how many output frames can be produced from <input_frames> frames, starting at the
+// 16.16 fixed point position <frac> within the first frame after the filter history.
+u32 GetResamplerOutputCount(u32 input_frames, u32 frac, u32 ratio);
+
+// Resamples <count> frames with a windowed sinc filter, multiplies them by volumes ranging from
+// 0 to 256 and adds them to the interleaved <out>. The channels of <out> are in the opposite order,
+// <left> ends up in the second one. Updates <frac> and returns how many input frames were consumed.
+u32 ResampleAndMix(const s16* left, const s16* right, s32* out, u32 count, u32* frac, u32 ratio,
+                   s32 left_volume, s32 right_volume);
+
+// Converts the mixed samples to 16 bits, clamping them to the range the mixer has always used.
+void ClampMixedSamples(const s32* input, s16* output, u32 count);
+}  // namespace AudioCommon
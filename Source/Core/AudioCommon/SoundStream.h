@@ -22,4 +22,7 @@ public:
   virtual void SetVolume(int) {}
   // Returns true if successful.
   virtual bool SetRunning(bool running) { return false; }
+  // Called from the emulation thread after each audio DMA transfer, which happens at a fixed
+  // emulated rate even while the DMA is disabled.
+  virtual void OnAudioDMA(unsigned int num_samples) {}
 };
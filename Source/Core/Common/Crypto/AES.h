@@ -41,6 +41,11 @@ public:
   {
     return Crypt(nullptr, nullptr, buf_in, buf_out, len);
   }
+  // Processes count independent buffers of len bytes each. Buffer i uses ivs[i] as its IV,
+  // or zero if ivs is nullptr. CBC encryption can't be parallelized within one buffer,
+  // so interleaving several buffers is much faster than encrypting them one at a time.
+  virtual bool CryptMultiple(const u8* const* ivs, const u8* const* bufs_in, u8* const* bufs_out,
+                             size_t count, size_t len) const;
 };
 
 std::unique_ptr<Context> CreateContextEncrypt(const u8* key);
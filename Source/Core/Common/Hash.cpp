@@ -7,6 +7,7 @@
 #include <bit>
 #include <cstring>
 
+#include <xxhash.h>
 #include <zlib.h>
 
 #include "Common/BitUtils.h"
@@ -427,6 +428,16 @@ u64 GetHash64(const u8* src, u32 len, u32 samples)
   return s_texture_hash_func(src, len, samples);
 }
 
+u64 GetHash64XXH3(const u8* src, u32 len, u32 samples)
+{
+  // Sampled hashes only touch a handful of cache lines, so they are bound by memory latency rather
+  // than by the hash function itself. Keep using the strided hash for those.
+  if (samples != 0 && samples < len / 8)
+    return s_texture_hash_func(src, len, samples);
+
+  return XXH3_64bits(src, len);
+}
+
 u32 StartCRC32()
 {
   return crc32_z(0L, Z_NULL, 0);
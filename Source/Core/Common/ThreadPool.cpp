@@ -0,0 +1,125 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/ThreadPool.h"
+
+#include <utility>
+
+#include "Common/Thread.h"
+
+namespace Common
+{
+void ThreadPool::Start(std::string_view name, u32 num_threads)
+{
+  Shutdown();
+
+  m_name = name;
+  m_shutdown = false;
+  m_threads.reserve(num_threads);
+  for (u32 i = 0; i < num_threads; ++i)
+    m_threads.emplace_back(&ThreadPool::WorkerLoop, this);
+}
+
+void ThreadPool::Shutdown()
+{
+  {
+    std::lock_guard lk(m_lock);
+    m_shutdown = true;
+  }
+  m_work_available.notify_all();
+
+  for (std::thread& thread : m_threads)
+    thread.join();
+  m_threads.clear();
+
+  // Anything submitted while there were no workers has already run inline, but be safe in case a
+  // job was queued concurrently with the shutdown.
+  std::unique_lock lk(m_lock);
+  while (!m_jobs.empty())
+  {
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lk.unlock();
+    RunJob(job);
+    lk.lock();
+  }
+}
+
+void ThreadPool::Submit(std::function<void()> job, WaitGroup* group)
+{
+  if (m_threads.empty())
+  {
+    job();
+    return;
+  }
+
+  if (group)
+    group->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    std::lock_guard lk(m_lock);
+    m_jobs.push_back({std::move(job), group});
+  }
+  m_work_available.notify_one();
+}
+
+void ThreadPool::Wait(WaitGroup& group)
+{
+  std::unique_lock lk(m_lock);
+  while (!group.IsDone())
+  {
+    if (m_jobs.empty())
+    {
+      m_job_done.wait(lk);
+      continue;
+    }
+
+    // Help out rather than sleeping. This may run jobs from other groups, which is fine.
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lk.unlock();
+    RunJob(job);
+    lk.lock();
+  }
+}
+
+void ThreadPool::ParallelFor(u32 count, const std::function<void(u32)>& function)
+{
+  WaitGroup group;
+  for (u32 i = 0; i < count; ++i)
+    Submit([&function, i] { function(i); }, &group);
+  Wait(group);
+}
+
+void ThreadPool::RunJob(Job& job)
+{
+  job.function();
+
+  if (job.group && job.group->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    // Take the lock so that a waiter can't miss the notification between checking the group and
+    // going to sleep.
+    std::lock_guard lk(m_lock);
+    m_job_done.notify_all();
+  }
+}
+
+void ThreadPool::WorkerLoop()
+{
+  Common::SetCurrentThreadName(m_name.c_str());
+
+  std::unique_lock lk(m_lock);
+  while (true)
+  {
+    m_work_available.wait(lk, [&] { return !m_jobs.empty() || m_shutdown; });
+    if (m_jobs.empty())
+      return;
+
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lk.unlock();
+    RunJob(job);
+    lk.lock();
+  }
+}
+}  // namespace Common
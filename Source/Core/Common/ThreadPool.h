@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// A fixed set of worker threads executing jobs from a shared queue.
+//
+// Threads waiting on a WaitGroup help execute queued jobs while they wait, so a pool without any
+// worker threads is valid and simply runs every job on the submitting thread.
+
+namespace Common
+{
+class ThreadPool
+{
+public:
+  // Tracks completion of a set of jobs. Must outlive the jobs submitted with it.
+  class WaitGroup
+  {
+  public:
+    bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+  private:
+    friend class ThreadPool;
+    std::atomic<u32> m_pending{0};
+  };
+
+  ThreadPool() = default;
+  ThreadPool(std::string_view name, u32 num_threads) { Start(name, num_threads); }
+  ~ThreadPool() { Shutdown(); }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Stops the current workers (if any), then starts num_threads new ones.
+  void Start(std::string_view name, u32 num_threads);
+
+  // Runs all queued jobs to completion and stops the workers.
+  void Shutdown();
+
+  u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()); }
+
+  void Submit(std::function<void()> job, WaitGroup* group = nullptr);
+
+  // Blocks until every job submitted with the group has finished.
+  void Wait(WaitGroup& group);
+
+  // Runs function(i) for every i in [0, count) and waits for all of them to finish.
+  void ParallelFor(u32 count, const std::function<void(u32)>& function);
+
+private:
+  struct Job
+  {
+    std::function<void()> function;
+    WaitGroup* group;
+  };
+
+  void RunJob(Job& job);
+  void WorkerLoop();
+
+  std::string m_name;
+  std::vector<std::thread> m_threads;
+  std::mutex m_lock;
+  std::condition_variable m_work_available;
+  std::condition_variable m_job_done;
+  std::deque<Job> m_jobs;
+  bool m_shutdown = false;
+};
+}  // namespace Common
@@ -1860,12 +1860,11 @@ static int GetVEXpp(u8 opPrefix)
 }
 
 void XEmitter::WriteVEXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
-                          int W, int extrabytes)
+                          int W, int extrabytes, int L)
 {
   int mmmmm = GetVEXmmmmm(op);
   int pp = GetVEXpp(opPrefix);
-  // FIXME: we currently don't support 256-bit instructions, and "size" is not the vector size here
-  arg.WriteVEX(this, regOp1, regOp2, 0, pp, mmmmm, W);
+  arg.WriteVEX(this, regOp1, regOp2, L, pp, mmmmm, W);
   Write8(op & 0xFF);
   arg.WriteRest(this, extrabytes, regOp1);
 }
@@ -1885,6 +1884,22 @@ void XEmitter::WriteAVXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, con
   WriteVEXOp(opPrefix, op, regOp1, regOp2, arg, W, extrabytes);
 }
 
+void XEmitter::WriteAVX256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2,
+                             const OpArg& arg)
+{
+  if (!cpu_info.bAVX)
+    PanicAlertFmt("Trying to use AVX on a system that doesn't support it. Bad programmer.");
+  WriteVEXOp(opPrefix, op, regOp1, regOp2, arg, 0, 0, 1);
+}
+
+void XEmitter::WriteAVX2_256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2,
+                               const OpArg& arg)
+{
+  if (!cpu_info.bAVX2)
+    PanicAlertFmt("Trying to use AVX2 on a system that doesn't support it. Bad programmer.");
+  WriteVEXOp(opPrefix, op, regOp1, regOp2, arg, 0, 0, 1);
+}
+
 void XEmitter::WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                            X64Reg regOp3, int W)
 {
@@ -3049,6 +3064,47 @@ void XEmitter::VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
   WriteAVXOp(0x66, 0xEF, regOp1, regOp2, arg);
 }
 
+void XEmitter::VZEROUPPER()
+{
+  if (!cpu_info.bAVX)
+    PanicAlertFmt("Trying to use AVX on a system that doesn't support it. Bad programmer.");
+  Write8(0xC5);
+  Write8(0xF8);
+  Write8(0x77);
+}
+void XEmitter::VMOVUPS_ymm(X64Reg regOp, const OpArg& arg)
+{
+  WriteAVX256Op(0x00, sseMOVUPfromRM, regOp, INVALID_REG, arg);
+}
+void XEmitter::VMOVUPS_ymm(const OpArg& arg, X64Reg regOp)
+{
+  WriteAVX256Op(0x00, sseMOVUPtoRM, regOp, INVALID_REG, arg);
+}
+void XEmitter::VMULPS_ymm(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
+{
+  WriteAVX256Op(0x00, sseMUL, regOp1, regOp2, arg);
+}
+void XEmitter::VCVTDQ2PS_ymm(X64Reg regOp, const OpArg& arg)
+{
+  WriteAVX256Op(0x00, 0x5B, regOp, INVALID_REG, arg);
+}
+void XEmitter::VPMOVSXBD_ymm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2_256Op(0x66, 0x3821, dest, INVALID_REG, arg);
+}
+void XEmitter::VPMOVSXWD_ymm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2_256Op(0x66, 0x3823, dest, INVALID_REG, arg);
+}
+void XEmitter::VPMOVZXBD_ymm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2_256Op(0x66, 0x3831, dest, INVALID_REG, arg);
+}
+void XEmitter::VPMOVZXWD_ymm(X64Reg dest, const OpArg& arg)
+{
+  WriteAVX2_256Op(0x66, 0x3833, dest, INVALID_REG, arg);
+}
+
 void XEmitter::VFMADD132PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
 {
   WriteFMA3Op(0x98, regOp1, regOp2, arg);
@@ -357,13 +357,15 @@ private:
   void WriteSSSE3Op(u8 opPrefix, u16 op, X64Reg regOp, const OpArg& arg, int extrabytes = 0);
   void WriteSSE41Op(u8 opPrefix, u16 op, X64Reg regOp, const OpArg& arg, int extrabytes = 0);
   void WriteVEXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0,
-                  int extrabytes = 0);
+                  int extrabytes = 0, int L = 0);
   void WriteVEXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                    X64Reg regOp3, int W = 0);
   void WriteAVXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0,
                   int extrabytes = 0);
   void WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                    X64Reg regOp3, int W = 0);
+  void WriteAVX256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void WriteAVX2_256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void WriteFMA3Op(u8 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteFMA4Op(u8 op, X64Reg dest, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteBMIOp(int size, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
@@ -877,6 +879,18 @@ public:
   void VPOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 
+  // 256-bit AVX/AVX2. These take the XMM register names but operate on the whole YMM register.
+  // Emit VZEROUPPER before going back to SSE code to avoid state transition penalties.
+  void VZEROUPPER();
+  void VMOVUPS_ymm(X64Reg regOp, const OpArg& arg);
+  void VMOVUPS_ymm(const OpArg& arg, X64Reg regOp);
+  void VMULPS_ymm(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void VCVTDQ2PS_ymm(X64Reg regOp, const OpArg& arg);
+  void VPMOVSXBD_ymm(X64Reg dest, const OpArg& arg);
+  void VPMOVSXWD_ymm(X64Reg dest, const OpArg& arg);
+  void VPMOVZXBD_ymm(X64Reg dest, const OpArg& arg);
+  void VPMOVZXWD_ymm(X64Reg dest, const OpArg& arg);
+
   // FMA3
   void VFMADD132PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VFMADD213PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
@@ -142,6 +142,10 @@ bool BootCore(std::unique_ptr<BootParameters> boot, const WindowSystemInfo& wsi)
   if (!boot->riivolution_patches.empty())
     Config::SetCurrent(Config::MAIN_FAST_DISC_SPEED, true);
 
+  // Riivolution save redirects need the NAND to be on the host filesystem.
+  if (!boot->riivolution_patches.empty())
+    Config::SetCurrent(Config::MAIN_WII_SESSION_NAND_IN_MEMORY, false);
+
   Core::System::GetInstance().Initialize();
 
   Core::UpdateWantDeterminism(/*initial*/ true);
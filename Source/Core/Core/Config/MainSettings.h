@@ -15,6 +15,7 @@
 
 // DSP Backend Types
 #define BACKEND_NULLSOUND _trans("No Audio Output")
+#define BACKEND_CAPTURE _trans("Capture to File")
 #define BACKEND_ALSA "ALSA"
 #define BACKEND_CUBEB "Cubeb"
 #define BACKEND_OPENAL "OpenAL"
@@ -153,10 +154,13 @@ extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
 extern const Info<std::string> MAIN_WII_NUS_SHOP_URL;
 extern const Info<bool> MAIN_WII_WIILINK_ENABLE;
+extern const Info<bool> MAIN_WII_SESSION_NAND_IN_MEMORY;
+extern const Info<std::string> MAIN_WII_SESSION_NAND_FLUSH_PATH;
 
 // Main.DSP
 
 extern const Info<bool> MAIN_DSP_THREAD;
+extern const Info<bool> MAIN_DSP_HLE_THREAD;
 extern const Info<bool> MAIN_DSP_CAPTURE_LOG;
 extern const Info<bool> MAIN_DSP_JIT;
 extern const Info<bool> MAIN_DUMP_AUDIO;
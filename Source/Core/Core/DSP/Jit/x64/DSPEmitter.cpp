@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/BitSet.h"
@@ -224,6 +225,44 @@ void DSPEmitter::EmitInstruction(UDSPInstruction inst)
   }
 }
 
+// Returns whether <inst> is a loop instruction which might run the loop body.
+static bool StartsLoop(UDSPInstruction inst)
+{
+  // LOOP, BLOOP
+  if ((inst & 0xffc0) == 0x0040)
+    return true;
+
+  // LOOPI, BLOOPI
+  return (inst & 0xfe00) == 0x1000 && (inst & 0xff) != 0;
+}
+
+// Returns whether the block being compiled runs straight through to <dest>, which has to match the
+// conditions for ending a block in Compile().
+bool DSPEmitter::IsReachedInBlock(u16 dest) const
+{
+  const SDSP& state = m_dsp_core.DSPState();
+  const Analyzer& analyzer = state.GetAnalyzer();
+  if (dest <= m_compile_pc || dest >= m_start_address + MAX_BLOCK_SIZE ||
+      analyzer.IsIdleSkip(m_start_address))
+  {
+    return false;
+  }
+
+  u16 addr = m_compile_pc;
+  while (addr < dest)
+  {
+    const UDSPInstruction inst = state.ReadIMEM(addr);
+    const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+    if (opcode->uncond_branch && !StartsLoop(inst))
+      return false;
+
+    addr += opcode->size;
+    if (analyzer.IsIdleSkip(addr))
+      return false;
+  }
+  return addr == dest;
+}
+
 void DSPEmitter::Compile(u16 start_addr)
 {
   // Remember the current block address for later
@@ -233,6 +272,9 @@ void DSPEmitter::Compile(u16 start_addr)
   const u8* entryPoint = AlignCode16();
 
   m_gpr.LoadRegs();
+  // Linked blocks and loop iterations enter with values in the host regs that have not been
+  // written back yet.
+  m_gpr.SetCachedRegsDirty();
 
   m_block_link_entry = GetCodePtr();
 
@@ -241,17 +283,24 @@ void DSPEmitter::Compile(u16 start_addr)
   m_block_size[start_addr] = 0;
 
   auto& analyzer = m_dsp_core.DSPState().GetAnalyzer();
+  if (!analyzer.IsIdleSkip(start_addr))
+    m_in_block_loops.emplace_back(start_addr, start_addr, m_block_link_entry, u16(0), m_gpr);
+
   while (m_compile_pc < start_addr + MAX_BLOCK_SIZE)
   {
+    WriteInBlockBranchTargets();
+
     if (analyzer.IsCheckExceptions(m_compile_pc))
       checkExceptions(m_block_size[start_addr]);
 
     const UDSPInstruction inst = m_dsp_core.DSPState().ReadIMEM(m_compile_pc);
     const DSPOPCTemplate* opcode = GetOpTemplate(inst);
+    const u16 inst_addr = m_compile_pc;
 
+    // Count the instruction before emitting it, so that branch exits include it.
+    m_block_size[start_addr]++;
     EmitInstruction(inst);
 
-    m_block_size[start_addr]++;
     m_compile_pc += opcode->size;
 
     // If the block was trying to link into itself, remove the link
@@ -263,6 +312,10 @@ void DSPEmitter::Compile(u16 start_addr)
     // by the analyzer.
     if (analyzer.IsLoopEnd(static_cast<u16>(m_compile_pc - 1u)))
     {
+      std::vector<FixupBranch> in_block_loop_done;
+      if (!opcode->branch)
+        in_block_loop_done = WriteInBlockLoopEnd(static_cast<u16>(m_compile_pc - 1u));
+
       MOVZX(32, 16, EAX, M_SDSP_r_st(2));
       TEST(32, R(EAX), R(EAX));
       FixupBranch rLoopAddressExit = J_CC(CC_LE, Jump::Near);
@@ -296,13 +349,24 @@ void DSPEmitter::Compile(u16 start_addr)
 
       SetJumpTarget(rLoopAddressExit);
       SetJumpTarget(rLoopCounterExit);
+      for (const FixupBranch& branch : in_block_loop_done)
+        SetJumpTarget(branch);
     }
 
     if (opcode->branch)
     {
       // don't update g_dsp.pc -- the branch insn already did
       fixup_pc = false;
-      if (opcode->uncond_branch)
+      if (StartsLoop(inst) && !analyzer.IsIdleSkip(start_addr))
+      {
+        // Keep compiling the loop body into this block.
+        const u16 loop_end =
+            opcode->size == 2 ? m_dsp_core.DSPState().ReadIMEM(inst_addr + 1) : m_compile_pc;
+        m_gpr.SetCachedRegsDirty();
+        m_in_block_loops.emplace_back(loop_end, m_compile_pc, GetCodePtr(),
+                                      m_block_size[start_addr], m_gpr);
+      }
+      else if (opcode->uncond_branch)
       {
         break;
       }
@@ -341,33 +405,36 @@ void DSPEmitter::Compile(u16 start_addr)
     }
   }
 
+  for (InBlockLoop& loop : m_in_block_loops)
+    loop.regs.Drop();
+  m_in_block_loops.clear();
+  ASSERT_MSG(DSPLLE, m_in_block_branches.empty(), "Block at {:#06x} has unresolved branches",
+             start_addr);
+
   if (fixup_pc)
   {
     MOV(16, M_SDSP_pc(), Imm16(m_compile_pc));
+    // Continue with the next block without going through the dispatcher.
+    LinkToBlock(m_compile_pc);
   }
 
   m_blocks[start_addr] = (DSPCompiledCode)entryPoint;
 
-  // Mark this block as a linkable destination if it does not contain
-  // any unresolved CALL's
-  if (m_unresolved_jumps[start_addr].empty())
-  {
-    m_block_links[start_addr] = m_block_link_entry;
+  // Mark this block as a linkable destination. Blocks with unresolved jumps are recompiled once
+  // their destinations exist, but their current code stays valid for any block linking to it.
+  m_block_links[start_addr] = m_block_link_entry;
 
-    for (size_t i = 0; i < 0xffff; ++i)
+  for (size_t i = 0; i < 0xffff; ++i)
+  {
+    if (!m_unresolved_jumps[i].empty())
     {
-      if (!m_unresolved_jumps[i].empty())
+      // Check if there were any blocks waiting for this block to be linkable
+      size_t size = m_unresolved_jumps[i].size();
+      m_unresolved_jumps[i].remove(start_addr);
+      if (m_unresolved_jumps[i].size() < size)
       {
-        // Check if there were any blocks waiting for this block to be linkable
-        size_t size = m_unresolved_jumps[i].size();
-        m_unresolved_jumps[i].remove(start_addr);
-        if (m_unresolved_jumps[i].size() < size)
-        {
-          // Mark the block to be recompiled again
-          m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-          m_block_links[i] = nullptr;
-          m_block_size[i] = 0;
-        }
+        // Mark the block to be recompiled again
+        m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
       }
     }
   }
@@ -213,6 +213,11 @@ private:
 
   void WriteBranchExit();
   void WriteBlockLink(u16 dest);
+  void LinkToBlock(u16 dest);
+  bool IsReachedInBlock(u16 dest) const;
+  void WriteInBlockBranch(u16 dest);
+  void WriteInBlockBranchTargets();
+  std::vector<Gen::FixupBranch> WriteInBlockLoopEnd(u16 end);
 
   void ReJitConditional(UDSPInstruction opc, void (DSPEmitter::*conditional_fn)(UDSPInstruction));
   void r_jcc(UDSPInstruction opc);
@@ -310,6 +315,27 @@ private:
 
   static constexpr size_t MAX_BLOCKS = 0x10000;
 
+  // A loop whose body is compiled into the current block, so that the end of the loop can jump
+  // back to the start of the body without leaving the block. Loops which were started before
+  // the block are only known by their body, which then begins at the start of the block.
+  struct InBlockLoop
+  {
+    u16 end;
+    u16 body;
+    Block body_code;
+    u16 body_cycles;
+    DSPJitRegCache regs;
+  };
+
+  // A conditional branch to an instruction further down in the current block, waiting for the
+  // code of its destination.
+  struct InBlockBranch
+  {
+    u16 dest;
+    Gen::FixupBranch branch;
+    u16 cycles;
+  };
+
   DSPJitRegCache m_gpr{*this};
 
   u16 m_compile_pc;
@@ -322,6 +348,8 @@ private:
   Block m_block_link_entry;
 
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
+  std::list<InBlockLoop> m_in_block_loops;
+  std::vector<InBlockBranch> m_in_block_branches;
 
   u16 m_cycles_left = 0;
 
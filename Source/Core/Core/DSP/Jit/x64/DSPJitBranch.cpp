@@ -3,6 +3,9 @@
 
 #include "Core/DSP/Jit/x64/DSPEmitter.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 
 #include "Core/DSP/DSPAnalyzer.h"
@@ -116,29 +119,77 @@ void DSPEmitter::WriteBranchExit()
 
 void DSPEmitter::WriteBlockLink(u16 dest)
 {
+  // Jumps into the current block are left to the dispatcher.
+  if (dest >= m_start_address && dest <= m_compile_pc)
+    return;
+
+  LinkToBlock(dest);
+}
+
+void DSPEmitter::WriteInBlockBranch(u16 dest)
+{
+  // Both paths meet at the destination with the accumulators in their host registers and
+  // everything else in memory.
+  m_gpr.FlushMemBackedRegs();
+  m_in_block_branches.push_back({dest, J(Jump::Near), m_block_size[m_start_address]});
+}
+
+void DSPEmitter::WriteInBlockBranchTargets()
+{
+  const auto is_target = [this](const InBlockBranch& branch) {
+    return branch.dest == m_compile_pc;
+  };
+  if (std::none_of(m_in_block_branches.begin(), m_in_block_branches.end(), is_target))
+    return;
+
+  m_gpr.FlushMemBackedRegs();
+  m_gpr.SetCachedRegsDirty();
+  std::vector<FixupBranch> joins{J(Jump::Near)};
+
+  for (const InBlockBranch& branch : m_in_block_branches)
+  {
+    if (!is_target(branch))
+      continue;
+
+    SetJumpTarget(branch.branch);
+    // The skipped instructions are part of the block size, but were not executed.
+    MOV(64, R(RAX), ImmPtr(&m_cycles_left));
+    ADD(16, MatR(RAX), Imm16(m_block_size[m_start_address] - branch.cycles));
+    joins.push_back(J(Jump::Near));
+  }
+  std::erase_if(m_in_block_branches, is_target);
+
+  for (const FixupBranch& join : joins)
+    SetJumpTarget(join);
+}
+
+void DSPEmitter::LinkToBlock(u16 dest)
+{
+  // Idle skipping blocks have to give up their cycles in the dispatcher.
+  if (m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
+    return;
+
   // Jump directly to the called block if it has already been compiled.
-  if (!(dest >= m_start_address && dest <= m_compile_pc))
+  if (m_block_links[dest] != nullptr)
   {
-    if (m_block_links[dest] != nullptr)
-    {
-      m_gpr.FlushRegs();
-      // Check if we have enough cycles to execute the next block
-      MOV(64, R(RAX), ImmPtr(&m_cycles_left));
-      MOV(16, R(ECX), MatR(RAX));
-      CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + m_block_size[dest]));
-      FixupBranch notEnoughCycles = J_CC(CC_BE);
-
-      SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
-      MOV(16, MatR(RAX), R(ECX));
-      JMP(m_block_links[dest], Jump::Near);
-      SetJumpTarget(notEnoughCycles);
-    }
-    else
-    {
-      // The destination has not been compiled yet.  Add it to the list
-      // of blocks that this block is waiting on.
-      m_unresolved_jumps[m_start_address].push_back(dest);
-    }
+    // The accumulators stay in their host registers, every block writes them back when it exits.
+    m_gpr.FlushMemBackedRegs();
+    // Check if we have enough cycles to execute the next block
+    MOV(64, R(RAX), ImmPtr(&m_cycles_left));
+    MOV(16, R(ECX), MatR(RAX));
+    CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + m_block_size[dest]));
+    FixupBranch notEnoughCycles = J_CC(CC_BE);
+
+    SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
+    MOV(16, MatR(RAX), R(ECX));
+    JMP(m_block_links[dest], Jump::Near);
+    SetJumpTarget(notEnoughCycles);
+  }
+  else
+  {
+    // The destination has not been compiled yet.  Add it to the list
+    // of blocks that this block is waiting on.
+    m_unresolved_jumps[m_start_address].push_back(dest);
   }
 }
 
@@ -147,8 +198,16 @@ void DSPEmitter::r_jcc(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
+  // Skipping ahead in the current block doesn't need to leave it.
+  if (!opcode->uncond_branch && IsReachedInBlock(dest))
+  {
+    WriteInBlockBranch(dest);
+    return;
+  }
+
+  // If the block is unconditional, attempt to link block. Conditional branches only link to
+  // blocks that already exist, rather than compiling targets which might never be reached.
+  if (opcode->uncond_branch || m_block_links[dest] != nullptr)
     WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
@@ -195,7 +254,7 @@ void DSPEmitter::r_call(const UDSPInstruction opc)
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
   // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
+  if (opcode->uncond_branch || m_block_links[dest] != nullptr)
     WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
@@ -346,6 +405,65 @@ void DSPEmitter::HandleLoop()
   SetJumpTarget(rLoopCntG);
 }
 
+// Handles the end of a loop whose body was compiled into the current block. As long as enough
+// cycles are left, further iterations jump straight back to the start of the body, and the last
+// iteration pops the loop stacks and continues in the block. Anything else falls through to the
+// generic loop handling. Returns the branches to take past the generic handling.
+std::vector<FixupBranch> DSPEmitter::WriteInBlockLoopEnd(u16 end)
+{
+  std::vector<FixupBranch> loop_done;
+
+  // Try the innermost loop first.
+  for (auto it = m_in_block_loops.rbegin(); it != m_in_block_loops.rend(); ++it)
+  {
+    InBlockLoop& loop = *it;
+    if (loop.end != end && loop.body != m_start_address)
+      continue;
+
+    CMP(16, M_SDSP_r_st(2), Imm16(end));
+    FixupBranch other_end = J_CC(CC_NE, Jump::Near);
+    CMP(16, M_SDSP_r_st(0), Imm16(loop.body));
+    FixupBranch other_body = J_CC(CC_NE, Jump::Near);
+    CMP(16, M_SDSP_r_st(3), Imm16(1));
+    FixupBranch no_counter = J_CC(CC_B, Jump::Near);
+    FixupBranch last_iteration = J_CC(CC_E, Jump::Near);
+
+    // Earlier iterations are accounted for here, as the block only returns the cycles of a
+    // single pass when it exits. Leave enough cycles for the rest of the block.
+    const u16 iteration_cycles = m_block_size[m_start_address] - loop.body_cycles;
+    MOV(64, R(RAX), ImmPtr(&m_cycles_left));
+    MOV(16, R(ECX), MatR(RAX));
+    CMP(16, R(ECX), Imm16(iteration_cycles + m_block_size[m_start_address]));
+    FixupBranch not_enough_cycles = J_CC(CC_BE, Jump::Near);
+    SUB(16, R(ECX), Imm16(iteration_cycles));
+    MOV(16, MatR(RAX), R(ECX));
+    SUB(16, M_SDSP_r_st(3), Imm16(1));
+    {
+      DSPJitRegCache c(m_gpr);
+      m_gpr.FlushRegs(loop.regs);
+      JMP(loop.body_code, Jump::Near);
+      m_gpr.FlushRegs(c, false);
+    }
+
+    SetJumpTarget(last_iteration);
+    {
+      DSPJitRegCache c(m_gpr);
+      dsp_reg_load_stack(StackRegister::Call);
+      dsp_reg_load_stack(StackRegister::LoopAddress);
+      dsp_reg_load_stack(StackRegister::LoopCounter);
+      m_gpr.FlushRegs(c);
+    }
+    loop_done.push_back(J(Jump::Near));
+
+    SetJumpTarget(other_end);
+    SetJumpTarget(other_body);
+    SetJumpTarget(no_counter);
+    SetJumpTarget(not_enough_cycles);
+  }
+
+  return loop_done;
+}
+
 // LOOP $R
 // 0000 0000 010r rrrr
 // Repeatedly execute following opcode until counter specified by value
@@ -352,6 +352,15 @@ void DSPJitRegCache::FlushMemBackedRegs()
   }
 }
 
+void DSPJitRegCache::SetCachedRegsDirty()
+{
+  for (DynamicReg& reg : m_regs)
+  {
+    if (reg.loc.IsSimpleReg())
+      reg.dirty = true;
+  }
+}
+
 void DSPJitRegCache::FlushRegs()
 {
   FlushMemBackedRegs();
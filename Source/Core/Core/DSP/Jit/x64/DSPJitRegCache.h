@@ -102,6 +102,14 @@ public:
   // Prepare state so that another flushed DSPJitRegCache can take over
   void FlushRegs();
 
+  // Like FlushRegs(), but leaves the statically allocated regs in their host regs without
+  // writing them back. Used for jumps into code which expects them there.
+  void FlushMemBackedRegs();
+
+  // Mark all guest regs that are currently held in host regs as dirty, so that they are written
+  // back even if the code jumped to from elsewhere with newer values in them.
+  void SetCachedRegsDirty();
+
   void LoadRegs(bool emit = true);  // Load statically allocated regs from memory
   void SaveRegs();                  // Save statically allocated regs to memory
 
@@ -168,7 +176,6 @@ private:
   void MovToHostReg(size_t reg, bool load);
   void RotateHostReg(size_t reg, int shift, bool emit);
   void MovToMemory(size_t reg);
-  void FlushMemBackedRegs();
 
   std::array<DynamicReg, 37> m_regs{};
   std::array<X64CachedReg, 16> m_xregs{};
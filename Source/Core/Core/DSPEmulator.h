@@ -20,6 +20,10 @@ public:
   virtual void DoState(PointerWrap& p) = 0;
   virtual void PauseAndLock(bool do_lock) = 0;
 
+  // Waits for DSP work running asynchronously with the CPU, before the CPU side accesses memory
+  // that this work might be using.
+  virtual void WaitForAsyncWork() {}
+
   virtual void DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value) = 0;
   virtual void DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value) = 0;
   virtual u16 DSP_ReadMailBoxHigh(bool cpu_mailbox) = 0;
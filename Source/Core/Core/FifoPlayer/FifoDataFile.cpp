@@ -5,10 +5,16 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <xxhash.h>
+#include <zstd.h>
+
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
@@ -16,11 +22,13 @@
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Version 6 stores frames as compressed chunks, which older versions can't read.
+constexpr u32 MIN_LOADER_VERSION = 6;
+
+// Decoded frames of loaded files are kept in memory up to this size. Small logs end up entirely
+// in memory after the first loop, while large ones are streamed from the file.
+constexpr size_t FRAME_CACHE_SIZE = 256 * 1024 * 1024;
 
 #pragma pack(push, 1)
 
@@ -46,10 +54,48 @@ struct FileHeader
   // will crash and burn with mismatched settings.  See PR #8722.
   u32 mem1_size;
   u32 mem2_size;
-  u8 reserved[32];
+  // Added in version 6
+  u64 blobListOffset;
+  u32 blobCount;
+  u8 reserved[20];
 };
 static_assert(sizeof(FileHeader) == 128, "FileHeader should be 128 bytes");
 
+// Since version 6, the FIFO data and memory updates of each frame are stored in one chunk, which
+// is zstd compressed unless that doesn't make it smaller. The chunk contains fifoDataSize bytes
+// of FIFO data followed by numMemoryUpdates FileChunkMemoryUpdates.
+struct FileFrameChunk
+{
+  u64 chunkOffset;
+  u32 chunkSize;
+  u32 fifoDataSize;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u32 numMemoryUpdates;
+  u8 reserved[36];
+};
+static_assert(sizeof(FileFrameChunk) == 64, "FileFrameChunk should be 64 bytes");
+
+struct FileChunkMemoryUpdate
+{
+  u32 fifoPosition;
+  u32 address;
+  u32 blobIndex;
+  u8 type;
+  u8 reserved[3];
+};
+static_assert(sizeof(FileChunkMemoryUpdate) == 16, "FileChunkMemoryUpdate should be 16 bytes");
+
+// Memory update payloads are stored once per distinct content, so that data which gets uploaded
+// again and again (like textures) only takes space once. Compressed like frame chunks.
+struct FileBlob
+{
+  u64 offset;
+  u32 compressedSize;
+  u32 size;
+};
+static_assert(sizeof(FileBlob) == 16, "FileBlob should be 16 bytes");
+
 struct FileFrameInfo
 {
   u64 fifoDataOffset;
@@ -75,6 +121,66 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 #pragma pack(pop)
 
+static size_t GetFrameMemorySize(const FifoFrameInfo& frame)
+{
+  size_t size = sizeof(frame) + frame.fifoData.size();
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+    size += sizeof(update) + update.data.size();
+  return size;
+}
+
+// Reads data that was written by WriteMaybeCompressed.
+// Sizes are checked against the file before anything is allocated, so that a corrupt file can't
+// make us allocate more memory than its contents could possibly expand to.
+static bool ReadMaybeCompressed(File::IOFile& file, u64 offset, u32 stored_size, size_t size,
+                                std::vector<u8>* data)
+{
+  const u64 file_size = file.GetSize();
+  if (offset > file_size || stored_size > file_size - offset)
+    return false;
+
+  if (!file.Seek(offset, File::SeekOrigin::Begin))
+    return false;
+
+  if (stored_size == size)
+  {
+    data->resize(size);
+    return file.ReadBytes(data->data(), size);
+  }
+
+  // Data is only stored compressed if that makes it smaller.
+  if (stored_size > size)
+    return false;
+
+  std::vector<u8> compressed(stored_size);
+  if (!file.ReadBytes(compressed.data(), compressed.size()))
+    return false;
+
+  if (ZSTD_getFrameContentSize(compressed.data(), compressed.size()) != size)
+    return false;
+
+  data->resize(size);
+  return ZSTD_decompress(data->data(), size, compressed.data(), compressed.size()) == size;
+}
+
+// Returns the number of bytes written. Data that doesn't compress is stored as is, in which case
+// the returned size is the size of the data.
+static u32 WriteMaybeCompressed(File::IOFile& file, ZSTD_CCtx* context, const u8* data,
+                                size_t size, std::vector<u8>* buffer)
+{
+  buffer->resize(ZSTD_compressBound(size));
+  const size_t compressed_size = ZSTD_compressCCtx(context, buffer->data(), buffer->size(), data,
+                                                   size, ZSTD_CLEVEL_DEFAULT);
+  if (!ZSTD_isError(compressed_size) && compressed_size < size)
+  {
+    file.WriteBytes(buffer->data(), compressed_size);
+    return static_cast<u32>(compressed_size);
+  }
+
+  file.WriteBytes(data, size);
+  return static_cast<u32>(size);
+}
+
 FifoDataFile::FifoDataFile() = default;
 
 FifoDataFile::~FifoDataFile() = default;
@@ -86,7 +192,7 @@ bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 
 bool FifoDataFile::HasBrokenEFBCopies() const
 {
-  return m_Version < 2;
+  return m_Version < 2 || GetFlag(FLAG_BROKEN_EFB_COPIES);
 }
 
 void FifoDataFile::SetIsWii(bool isWii)
@@ -101,7 +207,56 @@ bool FifoDataFile::GetIsWii() const
 
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  m_Frames.push_back(std::make_shared<FifoFrameInfo>(frameInfo));
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  return static_cast<u32>(m_file ? m_frame_locations.size() : m_Frames.size());
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  if (!m_file)
+    return m_Frames[frame];
+
+  std::unique_lock lk(m_frame_cache_mutex);
+
+  if (m_frame_cache[frame])
+    return m_frame_cache[frame];
+
+  std::shared_ptr<const FifoFrameInfo> result = ReadFrame(frame);
+  if (!result)
+  {
+    // Don't keep other threads waiting while the alert is shown.
+    lk.unlock();
+    PanicAlertFmtT("Failed to read frame {0} of the DFF file.", frame);
+    lk.lock();
+
+    // Another thread may have tried in the meantime.
+    if (m_frame_cache[frame])
+      return m_frame_cache[frame];
+
+    // Play an empty frame instead.
+    auto empty_frame = std::make_shared<FifoFrameInfo>();
+    empty_frame->fifoStart = m_frame_locations[frame].fifo_start;
+    empty_frame->fifoEnd = m_frame_locations[frame].fifo_end;
+    result = std::move(empty_frame);
+  }
+
+  m_frame_cache[frame] = result;
+  m_frame_cache_order.push_back(frame);
+  m_frame_cache_size += GetFrameMemorySize(*result);
+
+  while (m_frame_cache_size > FRAME_CACHE_SIZE && m_frame_cache_order.size() > 1)
+  {
+    const u32 evicted_frame = m_frame_cache_order.front();
+    m_frame_cache_order.pop_front();
+    m_frame_cache_size -= GetFrameMemorySize(*m_frame_cache[evicted_frame]);
+    m_frame_cache[evicted_frame].reset();
+  }
+
+  return result;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
@@ -113,10 +268,6 @@ bool FifoDataFile::Save(const std::string& filename)
   // Add space for header
   PadFile(sizeof(FileHeader), file);
 
-  // Add space for frame list
-  u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
-
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
 
@@ -132,15 +283,69 @@ bool FifoDataFile::Save(const std::string& filename)
   u64 texMemOffset = file.Tell();
   file.WriteArray(m_TexMem);
 
+  const std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(ZSTD_createCCtx(),
+                                                                     ZSTD_freeCCtx);
+  if (!context)
+    return false;
+
+  std::vector<FileFrameChunk> frame_chunks(GetFrameCount());
+  std::vector<FileBlob> blobs;
+  // 128-bit content hashes are trusted to not collide.
+  std::map<std::pair<u64, u64>, u32> blob_indices;
+  std::vector<u8> chunk;
+  std::vector<u8> buffer;
+
+  for (u32 i = 0; i < frame_chunks.size(); ++i)
+  {
+    const std::shared_ptr<const FifoFrameInfo> frame = GetFrame(i);
+
+    chunk.assign(frame->fifoData.begin(), frame->fifoData.end());
+
+    for (const MemoryUpdate& update : frame->memoryUpdates)
+    {
+      const XXH128_hash_t hash = XXH3_128bits(update.data.data(), update.data.size());
+      const auto [it, inserted] =
+          blob_indices.try_emplace({hash.low64, hash.high64}, static_cast<u32>(blobs.size()));
+      if (inserted)
+      {
+        FileBlob& blob = blobs.emplace_back();
+        blob.offset = file.Tell();
+        blob.size = static_cast<u32>(update.data.size());
+        blob.compressedSize = WriteMaybeCompressed(file, context.get(), update.data.data(),
+                                                   update.data.size(), &buffer);
+      }
+
+      FileChunkMemoryUpdate dstUpdate{};
+      dstUpdate.fifoPosition = update.fifoPosition;
+      dstUpdate.address = update.address;
+      dstUpdate.blobIndex = it->second;
+      dstUpdate.type = static_cast<u8>(update.type);
+
+      const u8* const dstUpdatePtr = reinterpret_cast<const u8*>(&dstUpdate);
+      chunk.insert(chunk.end(), dstUpdatePtr, dstUpdatePtr + sizeof(dstUpdate));
+    }
+
+    FileFrameChunk& dstFrame = frame_chunks[i];
+    dstFrame.chunkOffset = file.Tell();
+    dstFrame.chunkSize =
+        WriteMaybeCompressed(file, context.get(), chunk.data(), chunk.size(), &buffer);
+    dstFrame.fifoDataSize = static_cast<u32>(frame->fifoData.size());
+    dstFrame.fifoStart = frame->fifoStart;
+    dstFrame.fifoEnd = frame->fifoEnd;
+    dstFrame.numMemoryUpdates = static_cast<u32>(frame->memoryUpdates.size());
+  }
+
+  u64 frameListOffset = file.Tell();
+  file.WriteArray(frame_chunks.data(), frame_chunks.size());
+
+  u64 blobListOffset = file.Tell();
+  file.WriteArray(blobs.data(), blobs.size());
+
   // Write header
-  FileHeader header;
+  FileHeader header{};
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -158,44 +363,32 @@ bool FifoDataFile::Save(const std::string& filename)
   header.texMemSize = TEX_MEM_SIZE;
 
   header.frameListOffset = frameListOffset;
-  header.frameCount = (u32)m_Frames.size();
+  header.frameCount = static_cast<u32>(frame_chunks.size());
+
+  header.blobListOffset = blobListOffset;
+  header.blobCount = static_cast<u32>(blobs.size());
 
   header.flags = m_Flags;
 
-  auto& system = Core::System::GetInstance();
-  auto& memory = system.GetMemory();
-  header.mem1_size = memory.GetRamSizeReal();
-  header.mem2_size = memory.GetExRamSizeReal();
+  if (m_file)
+  {
+    // Converting a loaded file
+    if (HasBrokenEFBCopies())
+      header.flags |= FLAG_BROKEN_EFB_COPIES;
+    header.mem1_size = m_ram_size_real;
+    header.mem2_size = m_exram_size_real;
+  }
+  else
+  {
+    auto& system = Core::System::GetInstance();
+    auto& memory = system.GetMemory();
+    header.mem1_size = memory.GetRamSizeReal();
+    header.mem2_size = memory.GetExRamSizeReal();
+  }
 
   file.Seek(0, File::SeekOrigin::Begin);
   file.WriteBytes(&header, sizeof(FileHeader));
 
-  // Write frames list
-  for (unsigned int i = 0; i < m_Frames.size(); ++i)
-  {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
-
-    // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
-  }
-
   if (!file.Close())
     return false;
 
@@ -203,6 +396,19 @@ bool FifoDataFile::Save(const std::string& filename)
 }
 
 std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
+{
+  return Load(filename, flagsOnly, true);
+}
+
+bool FifoDataFile::Convert(const std::string& in_filename, const std::string& out_filename)
+{
+  // The RAM sizes of the file are only needed for playback, not for converting it.
+  const std::unique_ptr<FifoDataFile> file = Load(in_filename, false, false);
+  return file && file->Save(out_filename);
+}
+
+std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flags_only,
+                                                 bool check_ram_sizes)
 {
   File::IOFile file;
   file.Open(filename, "rb");
@@ -253,7 +459,7 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_Flags = header.flags;
   dataFile->m_Version = header.file_version;
 
-  if (flagsOnly)
+  if (flags_only)
   {
     // Force settings to match those used when the DFF was created.  This is sort of a hack.
     // It only works because this function gets called twice, and the first time (flagsOnly mode)
@@ -272,7 +478,8 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   // prior conditional.
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
-  if (header.mem1_size != memory.GetRamSizeReal() || header.mem2_size != memory.GetExRamSizeReal())
+  if (check_ram_sizes && (header.mem1_size != memory.GetRamSizeReal() ||
+                          header.mem2_size != memory.GetExRamSizeReal()))
   {
     CriticalAlertFmtT("Emulated memory size mismatch!\n"
                       "Current: MEM1 {0:08X} ({1} MiB), MEM2 {2:08X} ({3} MiB)\n"
@@ -316,33 +523,140 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
-  // Read frames
-  for (u32 i = 0; i < header.frameCount; ++i)
+  // Read the frame list. The frames themselves are only read when they are needed.
+  if (header.frameCount > file.GetSize() / sizeof(FileFrameInfo))
+    return panic_failed_to_read();
+  dataFile->m_frame_locations.resize(header.frameCount);
+
+  if (dataFile->m_Version >= 6)
   {
-    u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, File::SeekOrigin::Begin);
-    FileFrameInfo srcFrame;
-    if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
+    if (header.blobCount > file.GetSize() / sizeof(FileBlob))
       return panic_failed_to_read();
 
-    FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
+    std::vector<FileFrameChunk> frame_chunks(header.frameCount);
+    file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+    file.ReadArray(frame_chunks.data(), frame_chunks.size());
+
+    for (u32 i = 0; i < header.frameCount; ++i)
+    {
+      const FileFrameChunk& srcFrame = frame_chunks[i];
+      FrameLocation& dstFrame = dataFile->m_frame_locations[i];
+      dstFrame.offset = srcFrame.chunkOffset;
+      dstFrame.size = srcFrame.chunkSize;
+      dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+      dstFrame.fifo_start = srcFrame.fifoStart;
+      dstFrame.fifo_end = srcFrame.fifoEnd;
+      dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+    }
+
+    std::vector<FileBlob> blobs(header.blobCount);
+    file.Seek(header.blobListOffset, File::SeekOrigin::Begin);
+    file.ReadArray(blobs.data(), blobs.size());
+
+    dataFile->m_blob_locations.resize(header.blobCount);
+    for (u32 i = 0; i < header.blobCount; ++i)
+    {
+      BlobLocation& dstBlob = dataFile->m_blob_locations[i];
+      dstBlob.offset = blobs[i].offset;
+      dstBlob.compressed_size = blobs[i].compressedSize;
+      dstBlob.size = blobs[i].size;
+    }
+  }
+  else
+  {
+    std::vector<FileFrameInfo> frames(header.frameCount);
+    file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+    file.ReadArray(frames.data(), frames.size());
+
+    for (u32 i = 0; i < header.frameCount; ++i)
+    {
+      const FileFrameInfo& srcFrame = frames[i];
+      FrameLocation& dstFrame = dataFile->m_frame_locations[i];
+      dstFrame.offset = srcFrame.fifoDataOffset;
+      dstFrame.size = srcFrame.fifoDataSize;
+      dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+      dstFrame.fifo_start = srcFrame.fifoStart;
+      dstFrame.fifo_end = srcFrame.fifoEnd;
+      dstFrame.memory_updates_offset = srcFrame.memoryUpdatesOffset;
+      dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+    }
+  }
 
-    file.Seek(srcFrame.fifoDataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+  if (!file.IsGood())
+    return panic_failed_to_read();
 
-    ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+  dataFile->m_file = std::make_unique<File::IOFile>(std::move(file));
+  dataFile->m_frame_cache.resize(header.frameCount);
 
-    if (!file.IsGood())
-      return panic_failed_to_read();
+  return dataFile;
+}
+
+std::unique_ptr<FifoFrameInfo> FifoDataFile::ReadFrame(u32 frame) const
+{
+  const FrameLocation& location = m_frame_locations[frame];
+
+  auto result = std::make_unique<FifoFrameInfo>();
+  result->fifoStart = location.fifo_start;
+  result->fifoEnd = location.fifo_end;
+
+  // Don't let an earlier failure affect this frame.
+  m_file->ClearError();
 
-    dataFile->AddFrame(dstFrame);
+  if (m_Version < 6)
+  {
+    const u64 file_size = m_file->GetSize();
+    if (location.offset > file_size || location.fifo_data_size > file_size - location.offset)
+      return nullptr;
+
+    result->fifoData.resize(location.fifo_data_size);
+    m_file->Seek(location.offset, File::SeekOrigin::Begin);
+    m_file->ReadBytes(result->fifoData.data(), location.fifo_data_size);
+
+    if (!ReadMemoryUpdates(location.memory_updates_offset, location.num_memory_updates,
+                           result->memoryUpdates, *m_file) ||
+        !m_file->IsGood())
+    {
+      return nullptr;
+    }
+
+    return result;
   }
 
-  return dataFile;
+  const size_t chunk_size = location.fifo_data_size +
+                            size_t{location.num_memory_updates} * sizeof(FileChunkMemoryUpdate);
+  std::vector<u8> chunk;
+  if (!ReadMaybeCompressed(*m_file, location.offset, location.size, chunk_size, &chunk))
+    return nullptr;
+
+  result->fifoData.assign(chunk.begin(), chunk.begin() + location.fifo_data_size);
+
+  result->memoryUpdates.resize(location.num_memory_updates);
+  for (u32 i = 0; i < location.num_memory_updates; ++i)
+  {
+    FileChunkMemoryUpdate srcUpdate;
+    std::memcpy(&srcUpdate,
+                chunk.data() + location.fifo_data_size + i * sizeof(FileChunkMemoryUpdate),
+                sizeof(FileChunkMemoryUpdate));
+
+    MemoryUpdate& dstUpdate = result->memoryUpdates[i];
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+    if (!ReadBlob(srcUpdate.blobIndex, &dstUpdate.data))
+      return nullptr;
+  }
+
+  return result;
+}
+
+bool FifoDataFile::ReadBlob(u32 index, std::vector<u8>* data) const
+{
+  if (index >= m_blob_locations.size())
+    return false;
+
+  const BlobLocation& location = m_blob_locations[index];
+  return ReadMaybeCompressed(*m_file, location.offset, location.compressed_size, location.size,
+                             data);
 }
 
 void FifoDataFile::PadFile(size_t numBytes, File::IOFile& file)
@@ -364,40 +678,14 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
-{
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
-
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
-  {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
-
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
-
-    FileMemoryUpdate dstUpdate;
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
-
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
-  }
-
-  return updateListOffset;
-}
-
-void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+bool FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                      std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
 {
+  // Like in ReadMaybeCompressed, sizes are checked against the file before allocating anything.
+  const u64 file_size = file.GetSize();
+  if (numUpdates > file_size / sizeof(FileMemoryUpdate))
+    return false;
+
   memUpdates.resize(numUpdates);
 
   for (u32 i = 0; i < numUpdates; ++i)
@@ -405,7 +693,11 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     u64 updateOffset = fileOffset + (i * sizeof(FileMemoryUpdate));
     file.Seek(updateOffset, File::SeekOrigin::Begin);
     FileMemoryUpdate srcUpdate;
-    file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate));
+    if (!file.ReadBytes(&srcUpdate, sizeof(FileMemoryUpdate)))
+      return false;
+
+    if (srcUpdate.dataOffset > file_size || srcUpdate.dataSize > file_size - srcUpdate.dataOffset)
+      return false;
 
     MemoryUpdate& dstUpdate = memUpdates[i];
     dstUpdate.address = srcUpdate.address;
@@ -414,6 +706,9 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
 
     file.Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
-    file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
+    if (!file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize))
+      return false;
   }
+
+  return true;
 }
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -73,25 +75,57 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Frames of loaded files are read from the file on demand, and only a limited number of them
+  // are kept in memory, so don't hold on to the returned pointer for longer than needed.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
+  // Rewrites a DFF file of any version in the current format.
+  static bool Convert(const std::string& in_filename, const std::string& out_filename);
 
 private:
   enum
   {
-    FLAG_IS_WII = 1
+    FLAG_IS_WII = 1,
+    // Set when converting files from before version 2
+    FLAG_BROKEN_EFB_COPIES = 2,
   };
 
+  // Where the data of a frame is in a loaded file
+  struct FrameLocation
+  {
+    u64 offset = 0;
+    u32 size = 0;
+    u32 fifo_data_size = 0;
+    u32 fifo_start = 0;
+    u32 fifo_end = 0;
+    // Only used by files from before version 6, which store updates outside of the frame data
+    u64 memory_updates_offset = 0;
+    u32 num_memory_updates = 0;
+  };
+
+  // A memory update payload, which may be shared by any number of memory updates
+  struct BlobLocation
+  {
+    u64 offset = 0;
+    u32 compressed_size = 0;
+    u32 size = 0;
+  };
+
+  static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flags_only,
+                                            bool check_ram_sizes);
+
+  std::unique_ptr<FifoFrameInfo> ReadFrame(u32 frame) const;
+  bool ReadBlob(u32 index, std::vector<u8>* data) const;
+
   void PadFile(size_t numBytes, File::IOFile& file);
 
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
-  static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
+  static bool ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
@@ -105,5 +139,16 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  // Frames of recorded files
+  std::vector<std::shared_ptr<const FifoFrameInfo>> m_Frames;
+
+  // Loaded files
+  std::unique_ptr<File::IOFile> m_file;
+  std::vector<FrameLocation> m_frame_locations;
+  std::vector<BlobLocation> m_blob_locations;
+
+  mutable std::mutex m_frame_cache_mutex;
+  mutable std::vector<std::shared_ptr<const FifoFrameInfo>> m_frame_cache;
+  mutable std::deque<u32> m_frame_cache_order;
+  mutable size_t m_frame_cache_size = 0;
 };
@@ -465,6 +465,9 @@ void DSPManager::Do_ARAM_DMA()
   int ticksToTransfer = (m_aram_dma.Cnt.count / 32) * 246;
   core_timing.ScheduleEvent(ticksToTransfer, m_event_type_complete_aram);
 
+  // The DSP emulator might be reading ARAM or main RAM on another thread.
+  m_dsp_emulator->WaitForAsyncWork();
+
   // Real hardware DMAs in 32byte chunks, but we can get by with 8byte chunks
   if (m_aram_dma.Cnt.dir)
   {
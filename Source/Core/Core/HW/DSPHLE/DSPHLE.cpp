@@ -6,6 +6,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/DSPHLE/UCodes/UCodes.h"
@@ -33,6 +34,10 @@ bool DSPHLE::Initialize(bool wii, bool dsp_thread)
 
   m_dsp_state.Reset();
 
+  m_use_work_thread = Config::Get(Config::MAIN_DSP_HLE_THREAD);
+  if (m_use_work_thread)
+    m_work_thread.Reset("DSP HLE", [](std::function<void()> work) { work(); });
+
   return true;
 }
 
@@ -42,11 +47,17 @@ void DSPHLE::DSP_StopSoundStream()
 
 void DSPHLE::Shutdown()
 {
+  WaitForAsyncWork();
+  m_work_thread.Shutdown();
   m_ucode = nullptr;
 }
 
 void DSPHLE::DSP_Update(int cycles)
 {
+  // Work running on the DSP HLE thread is considered done at the next update.
+  WaitForAsyncWork();
+  m_mail_handler.SendDeferredMail();
+
   if (m_ucode != nullptr)
     m_ucode->Update();
 }
@@ -67,6 +78,30 @@ void DSPHLE::SendMailToDSP(u32 mail)
   }
 }
 
+void DSPHLE::RunAsync(std::function<void()> work)
+{
+  // Deferring the mail changes when the CPU gets it compared to running the work right away, so
+  // the thread can't be used when determinism is wanted (e.g. for netplay and movies).
+  if (!m_use_work_thread || Core::WantsDeterminism())
+  {
+    work();
+    return;
+  }
+
+  m_mail_handler.DeferMail();
+  m_async_work_pending = true;
+  m_work_thread.Push(std::move(work));
+}
+
+void DSPHLE::WaitForAsyncWork()
+{
+  if (!m_async_work_pending)
+    return;
+
+  m_work_thread.WaitForCompletion();
+  m_async_work_pending = false;
+}
+
 void DSPHLE::SetUCode(u32 crc)
 {
   m_mail_handler.ClearPending();
@@ -106,6 +141,10 @@ void DSPHLE::DoState(PointerWrap& p)
     return;
   }
 
+  // Deferred mail isn't part of the state, so send it now.
+  WaitForAsyncWork();
+  m_mail_handler.SendDeferredMail();
+
   p.Do(m_dsp_control);
   p.Do(m_control_reg_init_code_clear_time);
   p.Do(m_dsp_state);
@@ -179,6 +218,7 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
   if (cpu_mailbox)
   {
     m_dsp_state.cpu_mailbox = (m_dsp_state.cpu_mailbox & 0xFFFF0000) | value;
+    WaitForAsyncWork();
     SendMailToDSP(m_dsp_state.cpu_mailbox);
     // Mail sent so clear MSB to show that it is progressed
     m_dsp_state.cpu_mailbox &= 0x7FFFFFFF;
@@ -192,6 +232,8 @@ void DSPHLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 // Other DSP functions
 u16 DSPHLE::DSP_WriteControlRegister(u16 value)
 {
+  WaitForAsyncWork();
+
   DSP::UDSPControl temp(value);
 
   if (m_dsp_control.DSPHalt != temp.DSPHalt)
@@ -242,5 +284,7 @@ u16 DSPHLE::DSP_ReadControlRegister()
 
 void DSPHLE::PauseAndLock(bool do_lock)
 {
+  if (do_lock)
+    WaitForAsyncWork();
 }
 }  // namespace DSP::HLE
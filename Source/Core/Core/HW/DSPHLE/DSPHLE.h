@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/DSPEmulator.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/MailHandler.h"
@@ -27,6 +29,7 @@ public:
   bool IsLLE() const override { return false; }
   void DoState(PointerWrap& p) override;
   void PauseAndLock(bool do_lock) override;
+  void WaitForAsyncWork() override;
 
   void DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value) override;
   void DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value) override;
@@ -42,6 +45,11 @@ public:
   void SetUCode(u32 crc);
   void SwapUCode(u32 crc);
 
+  // Runs uCode work such as audio rendering on the DSP HLE thread, if it is enabled. The mail sent
+  // by the work is deferred until the next DSP update, so that the CPU always receives it at a
+  // deterministic point in emulated time. Without the thread, the work runs right away.
+  void RunAsync(std::function<void()> work);
+
 private:
   void SendMailToDSP(u32 mail);
 
@@ -67,5 +75,11 @@ private:
   DSP::UDSPControl m_dsp_control;
   u64 m_control_reg_init_code_clear_time = 0;
   CMailHandler m_mail_handler;
+
+  // The CPU only waits for the work when it needs state the work might be using. In particular,
+  // reading the mailboxes, which games poll, doesn't wait.
+  Common::WorkQueueThread<std::function<void()>> m_work_thread;
+  bool m_use_work_thread = false;
+  bool m_async_work_pending = false;
 };
 }  // namespace DSP::HLE
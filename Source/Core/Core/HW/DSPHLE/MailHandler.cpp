@@ -22,6 +22,12 @@ CMailHandler::~CMailHandler()
 
 void CMailHandler::PushMail(u32 mail, bool interrupt, int cycles_into_future)
 {
+  if (m_defer_mail)
+  {
+    m_deferred_mails.push_back({mail, interrupt, cycles_into_future});
+    return;
+  }
+
   if (interrupt)
   {
     if (m_pending_mails.empty())
@@ -74,6 +80,20 @@ u16 CMailHandler::ReadDSPMailboxLow()
 void CMailHandler::ClearPending()
 {
   m_pending_mails.clear();
+  m_deferred_mails.clear();
+}
+
+void CMailHandler::DeferMail()
+{
+  m_defer_mail = true;
+}
+
+void CMailHandler::SendDeferredMail()
+{
+  m_defer_mail = false;
+  for (const DeferredMail& deferred : m_deferred_mails)
+    PushMail(deferred.mail, deferred.interrupt, deferred.cycles_into_future);
+  m_deferred_mails.clear();
 }
 
 bool CMailHandler::HasPending() const
@@ -5,6 +5,7 @@
 
 #include <deque>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 
@@ -34,7 +35,20 @@ public:
   u16 ReadDSPMailboxHigh();
   u16 ReadDSPMailboxLow();
 
+  // While mail is deferred, PushMail only records the mail, without making it visible to the CPU
+  // or generating interrupts. This is used for uCode work running on the DSP HLE thread, which
+  // must not touch CPU state. SendDeferredMail sends the recorded mail and stops deferring.
+  void DeferMail();
+  void SendDeferredMail();
+
 private:
+  struct DeferredMail
+  {
+    u32 mail;
+    bool interrupt;
+    int cycles_into_future;
+  };
+
   // The actual DSP only has a single pair of mail registers, and doesn't keep track of pending
   // mails. But for HLE, it's a lot easier to write all the mails that will be read ahead of time,
   // and then give them to the CPU in the requested order.
@@ -44,5 +58,8 @@ private:
   u32 m_last_mail = 0;
   // When halted, the DSP itself is not running, but the last mail can be read.
   bool m_halted = false;
+
+  std::vector<DeferredMail> m_deferred_mails;
+  bool m_defer_mail = false;
 };
 }  // namespace DSP::HLE
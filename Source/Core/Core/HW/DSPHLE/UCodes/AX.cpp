@@ -677,9 +677,11 @@ void AXUCode::HandleMail(u32 mail)
 
   case MailState::WaitingForCmdListAddress:
     CopyCmdList(mail, m_cmdlist_size);
-    HandleCommandList();
     m_cmdlist_size = 0;
-    SignalWorkEnd();
+    m_dsphle->RunAsync([this] {
+      HandleCommandList();
+      SignalWorkEnd();
+    });
     m_mail_state = MailState::WaitingForNextTask;
     break;
 
@@ -0,0 +1,323 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXSampleProcessing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+
+#ifdef _M_X86_64
+#include <immintrin.h>
+#endif
+
+namespace DSP::HLE
+{
+namespace
+{
+bool IsInterpolating(int srctype)
+{
+  return srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE;
+}
+
+// Moves to the next output sample. Returns how many input samples were consumed to get there.
+u32 AdvancePosition(u32* curr_pos, u32 ratio)
+{
+  *curr_pos += ratio;
+  const u32 consumed = *curr_pos >> 16;
+  *curr_pos &= 0xFFFF;
+  return consumed;
+}
+
+s16 PolyphaseSample(const s16* t, const s16* c)
+{
+  const s64 samp =
+      (s64(t[0]) * c[0] + s64(t[1]) * c[1] + s64(t[2]) * c[2] + s64(t[3]) * c[3]) >> 15;
+  return MathUtil::SaturatingCast<s16>(samp);
+}
+
+u32 GetPolyphaseOffset(u32 curr_pos)
+{
+  return (curr_pos >> 9) << 2;
+}
+
+s16 LinearSample(const s16* t, u32 curr_pos)
+{
+  // If curr_pos is 0, we can simply take the sample without any multiplying.
+  if (curr_pos == 0)
+    return t[0];
+
+  const u16 curr_frac = static_cast<u16>(curr_pos);
+  const u16 inv_curr_frac = -curr_frac;
+  return static_cast<s16>((t[0] * inv_curr_frac + t[1] * curr_frac) >> 16);
+}
+
+#ifdef _M_X86_64
+// Computes the 32-bit products of signed samples and unsigned 16-bit factors. pmulhw treats the
+// factors as signed, which is corrected by adding the samples to the high half for factors with
+// the top bit set.
+void MultiplyUnsigned(__m128i samples, __m128i factors, __m128i* lo, __m128i* hi)
+{
+  *lo = _mm_mullo_epi16(samples, factors);
+  *hi = _mm_add_epi16(_mm_mulhi_epi16(samples, factors),
+                      _mm_and_si128(samples, _mm_srai_epi16(factors, 15)));
+}
+
+// Returns clamp((samples * volume) >> 15, -32767, 32767) for eight samples.
+template <bool signed_volume>
+__m128i ScaleByVolume(__m128i samples, __m128i volume)
+{
+  __m128i lo, hi;
+  if constexpr (signed_volume)
+  {
+    lo = _mm_mullo_epi16(samples, volume);
+    hi = _mm_mulhi_epi16(samples, volume);
+  }
+  else
+  {
+    MultiplyUnsigned(samples, volume, &lo, &hi);
+  }
+
+  const __m128i products_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i products_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  return _mm_max_epi16(_mm_packs_epi32(products_lo, products_hi), _mm_set1_epi16(-32767));
+}
+
+// Returns the volume for each of the next eight samples.
+__m128i GetVolumeRamp(u16 volume, u16 volume_delta)
+{
+  return _mm_add_epi16(_mm_set1_epi16(volume),
+                       _mm_mullo_epi16(_mm_set1_epi16(volume_delta),
+                                       _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7)));
+}
+#endif
+
+u32 ResamplePolyphase(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio,
+                      const s16* coeffs)
+{
+  u32 read = 0;
+  u32 i = 0;
+
+#ifdef _M_X86_64
+  const auto load_taps = [](const s16* taps) {
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(taps));
+  };
+
+  for (; i + 4 <= count; i += 4)
+  {
+    u32 taps[4];
+    u32 phases[4];
+    for (u32 j = 0; j < 4; ++j)
+    {
+      read += AdvancePosition(&curr_pos, ratio);
+      taps[j] = read;
+      phases[j] = GetPolyphaseOffset(curr_pos);
+    }
+
+    // Each pmaddwd result holds the sum of two of the four products of one output sample.
+    const __m128i sums01 = _mm_madd_epi16(
+        _mm_unpacklo_epi64(load_taps(input + taps[0]), load_taps(input + taps[1])),
+        _mm_unpacklo_epi64(load_taps(coeffs + phases[0]), load_taps(coeffs + phases[1])));
+    const __m128i sums23 = _mm_madd_epi16(
+        _mm_unpacklo_epi64(load_taps(input + taps[2]), load_taps(input + taps[3])),
+        _mm_unpacklo_epi64(load_taps(coeffs + phases[2]), load_taps(coeffs + phases[3])));
+    const __m128i first = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(sums01), _mm_castsi128_ps(sums23), _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i second = _mm_castps_si128(_mm_shuffle_ps(
+        _mm_castsi128_ps(sums01), _mm_castsi128_ps(sums23), _MM_SHUFFLE(3, 1, 3, 1)));
+
+    // pmaddwd only overflows if all four of its inputs are -32768, which wraps to INT_MIN. Since
+    // no pair of products can legitimately sum to INT_MIN, use the exact path for those.
+    const __m128i int_min = _mm_set1_epi32(std::numeric_limits<s32>::min());
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi32(first, int_min),
+                                       _mm_cmpeq_epi32(second, int_min))) != 0)
+    {
+      for (u32 j = 0; j < 4; ++j)
+        output[i + j] = PolyphaseSample(input + taps[j], coeffs + phases[j]);
+      continue;
+    }
+
+    // (first + second) >> 15, without overflowing 32 bits.
+    const __m128i low_bits = _mm_set1_epi32(0x7FFF);
+    const __m128i carry = _mm_srli_epi32(
+        _mm_add_epi32(_mm_and_si128(first, low_bits), _mm_and_si128(second, low_bits)), 15);
+    const __m128i sum = _mm_add_epi32(
+        _mm_add_epi32(_mm_srai_epi32(first, 15), _mm_srai_epi32(second, 15)), carry);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(sum, sum));
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    read += AdvancePosition(&curr_pos, ratio);
+    output[i] = PolyphaseSample(input + read, coeffs + GetPolyphaseOffset(curr_pos));
+  }
+
+  return curr_pos;
+}
+
+u32 ResampleLinear(const s16* input, s16* output, u32 count, u32 curr_pos, u32 ratio)
+{
+  u32 read = 0;
+  u32 i = 0;
+
+#ifdef _M_X86_64
+  for (; i + 8 <= count; i += 8)
+  {
+    alignas(16) s16 s0[8];
+    alignas(16) s16 s1[8];
+    alignas(16) u16 frac[8];
+    for (u32 j = 0; j < 8; ++j)
+    {
+      read += AdvancePosition(&curr_pos, ratio);
+      s0[j] = input[read];
+      s1[j] = input[read + 1];
+      frac[j] = static_cast<u16>(curr_pos);
+    }
+
+    // s0 * (0x10000 - frac) + s1 * frac, as 32-bit numbers split into 16-bit halves. For a frac of
+    // 0, the first factor doesn't fit in 16 bits, so s0 is added to the high half directly.
+    const __m128i samples0 = _mm_load_si128(reinterpret_cast<const __m128i*>(s0));
+    const __m128i samples1 = _mm_load_si128(reinterpret_cast<const __m128i*>(s1));
+    const __m128i curr_frac = _mm_load_si128(reinterpret_cast<const __m128i*>(frac));
+    const __m128i inv_curr_frac = _mm_sub_epi16(_mm_setzero_si128(), curr_frac);
+
+    __m128i lo0, hi0, lo1, hi1;
+    MultiplyUnsigned(samples0, inv_curr_frac, &lo0, &hi0);
+    MultiplyUnsigned(samples1, curr_frac, &lo1, &hi1);
+    hi0 = _mm_add_epi16(
+        hi0, _mm_and_si128(samples0, _mm_cmpeq_epi16(curr_frac, _mm_setzero_si128())));
+
+    // The result is the high half of the sum, including the carry from the low halves.
+    const __m128i lo = _mm_add_epi16(lo0, lo1);
+    const __m128i sign_bit = _mm_set1_epi16(-0x8000);
+    const __m128i carry =
+        _mm_cmplt_epi16(_mm_xor_si128(lo, sign_bit), _mm_xor_si128(lo0, sign_bit));
+    const __m128i sample = _mm_sub_epi16(_mm_add_epi16(hi0, hi1), carry);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), sample);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    read += AdvancePosition(&curr_pos, ratio);
+    output[i] = LinearSample(input + read, curr_pos);
+  }
+
+  return curr_pos;
+}
+
+template <bool signed_volume>
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta)
+{
+  u32 i = 0;
+
+#ifdef _M_X86_64
+  __m128i volumes = GetVolumeRamp(volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* data = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(data, ScaleByVolume<signed_volume>(_mm_loadu_si128(data), volumes));
+    volumes = _mm_add_epi16(volumes, volume_step);
+  }
+  volume += static_cast<u16>(volume_delta * i);
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s32 current_volume = signed_volume ? s32(s16(volume)) : s32(volume);
+    const s32 sample = (s32(samples[i]) * current_volume) >> 15;
+    samples[i] = std::clamp(sample, -32767, 32767);  // -32768 ?
+    volume += volume_delta;
+  }
+
+  return volume;
+}
+}  // namespace
+
+u32 GetResamplerInputCount(u32 count, u32 curr_pos, u32 ratio, int srctype)
+{
+  if (!IsInterpolating(srctype))
+    return count;
+
+  u32 input_count = 0;
+  for (u32 i = 0; i < count; ++i)
+    input_count += AdvancePosition(&curr_pos, ratio);
+  return input_count;
+}
+
+u32 ResampleSamples(const s16* input, s16* output, u32 count, s16* last_samples, u32 curr_pos,
+                    u32 ratio, int srctype, const s16* coeffs)
+{
+  if (!IsInterpolating(srctype))
+  {
+    // No sample rate conversion here: simply copy the new samples to the output buffer.
+    std::copy_n(input + 4, count, output);
+    std::memcpy(last_samples, output + count - 4, 4 * sizeof(s16));
+    return curr_pos;
+  }
+
+  const u32 input_count = GetResamplerInputCount(count, curr_pos, ratio, srctype);
+  if (coeffs && srctype == SRCTYPE_POLYPHASE)
+    curr_pos = ResamplePolyphase(input, output, count, curr_pos, ratio, coeffs);
+  else
+    curr_pos = ResampleLinear(input, output, count, curr_pos, ratio);
+
+  std::memcpy(last_samples, input + input_count, 4 * sizeof(s16));
+  return curr_pos;
+}
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+  if (signed_volume)
+    return ApplyVolumeRamp<true>(samples, count, volume, volume_delta);
+  else
+    return ApplyVolumeRamp<false>(samples, count, volume, volume_delta);
+}
+
+u16 MixAddWithRamp(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                   s16* last_sample)
+{
+  u32 i = 0;
+
+#ifdef _M_X86_64
+  __m128i volumes = GetVolumeRamp(volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = ScaleByVolume<false>(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), volumes);
+    volumes = _mm_add_epi16(volumes, volume_step);
+
+    __m128i* dst = reinterpret_cast<__m128i*>(out + i);
+    const __m128i samples_lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+    const __m128i samples_hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+    _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), samples_lo));
+    _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), samples_hi));
+
+    if (i + 8 == count)
+      *last_sample = static_cast<s16>(_mm_extract_epi16(samples, 7));
+  }
+  volume += static_cast<u16>(volume_delta * i);
+#endif
+
+  for (; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    sample = std::clamp((s32)sample, -32767, 32767);  // -32768 ?
+
+    out[i] += (s16)sample;
+    volume += volume_delta;
+
+    *last_sample = (s16)sample;
+  }
+
+  return volume;
+}
+}  // namespace DSP::HLE
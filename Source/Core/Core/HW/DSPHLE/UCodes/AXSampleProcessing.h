@@ -0,0 +1,37 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Sample processing shared by the GameCube and Wii versions of AX. These functions work on whole
+// blocks of samples so that they can be vectorized, but they produce exactly the same results as
+// the sample-by-sample loops of the ucode.
+
+namespace DSP::HLE
+{
+// Returns how many new input samples ResampleSamples needs to produce <count> output samples.
+u32 GetResamplerInputCount(u32 count, u32 curr_pos, u32 ratio, int srctype);
+
+// Resamples <input> to <count> output samples. <input> must start with the four <last_samples>
+// from the previous call, followed by GetResamplerInputCount() new samples. <last_samples> is
+// updated with the last four input samples.
+//
+// <curr_pos> and <ratio> are 16.16 fixed point numbers. If <srctype> is SRCTYPE_POLYPHASE and no
+// coefficients are provided, linear interpolation is used instead.
+//
+// Returns the fractional position after resampling.
+u32 ResampleSamples(const s16* input, s16* output, u32 count, s16* last_samples, u32 curr_pos,
+                    u32 ratio, int srctype, const s16* coeffs);
+
+// Multiplies the samples by a 1.15 fixed point volume which starts at <volume> and is increased by
+// <volume_delta> after each sample. The volume is signed on GameCube and unsigned on Wii.
+// Returns the volume after the last sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume);
+
+// Adds the samples multiplied by an unsigned volume ramp to <out>, and stores the last multiplied
+// sample in <last_sample>. Returns the volume after the last sample.
+u16 MixAddWithRamp(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                   s16* last_sample);
+}  // namespace DSP::HLE
@@ -12,7 +12,7 @@
 #endif
 
 #include <algorithm>
-#include <functional>
+#include <array>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -20,6 +20,7 @@
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/DSP.h"
 #include "Core/HW/DSPHLE/UCodes/AX.h"
+#include "Core/HW/DSPHLE/UCodes/AXSampleProcessing.h"
 #include "Core/HW/DSPHLE/UCodes/AXStructs.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -220,149 +221,59 @@ u16 AcceleratorGetSample()
   return s_accelerator->Read(acc_pb->adpcm.coefs);
 }
 
-// Reads samples from the input callback, resamples them to <count> samples at
-// the wanted sample rate (computed from the ratio, see below).
-//
-// If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
-// (or the srctype will automatically be changed to LINEAR).
-//
-// Returns the current position after resampling (including fractional part).
-//
-// The input to output ratio is set in <ratio>, which is a floating point num
-// stored as a 32b integer:
-//  * Upper 16 bits of the ratio are the integer part
-//  * Lower 16 bits are the decimal part
-//
-// <curr_pos> is a 32b integer structured in the same way as the ratio: the
-// upper 16 bits are the integer part of the current position in the input
-// stream, and the lower 16 bits are the decimal part.
+// Read <count> input samples from ARAM, decoding and converting rate
+// if required.
 //
-// We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
-// avoids discontinuities in the audio stream, especially with very low ratios
-// which interpolate a lot of values between two "real" samples.
-u32 ResampleAudio(std::function<s16(u32)> input_callback, s16* output, u32 count, s16* last_samples,
-                  u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+// The ratio and current position are 16.16 fixed point numbers. We start
+// getting samples not from sample 0, but 0.<curr_pos_frac>. This avoids
+// discontinuities in the audio stream, especially with very low ratios which
+// interpolate a lot of values between two "real" samples.
+void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
 {
-  int read_samples_count = 0;
+  // Enough for ratios of up to 4.0 to be resampled in one go.
+  constexpr u32 MAX_INPUT_SAMPLES = 4 * MAX_SAMPLES_PER_FRAME;
 
-  // If DSP DROM coefficients are available, support polyphase resampling.
-  if (coeffs && srctype == SRCTYPE_POLYPHASE)
-  {
-    s16 temp[4];
-    u32 idx = 0;
+  AcceleratorSetup(&pb);
 
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
+  if (coeffs)
+    coeffs += pb.coef_select * 0x200;
 
-    for (u32 i = 0; i < count; ++i)
+  // Decode the samples needed for as many output samples as possible at once, so that resampling
+  // can process whole blocks of samples.
+  const u32 ratio = HILO_TO_32(pb.src.ratio);
+  u32 curr_pos = pb.src.cur_addr_frac;
+  for (u32 done = 0; done < count;)
+  {
+    u32 block_count = count - done;
+    u32 input_count = GetResamplerInputCount(block_count, curr_pos, ratio, pb.src_type);
+    while (input_count > MAX_INPUT_SAMPLES && block_count > 1)
     {
-      curr_pos += ratio;
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
-
-      u16 curr_pos_frac = ((curr_pos & 0xFFFF) >> 9) << 2;
-      const s16* c = &coeffs[curr_pos_frac];
-
-      s64 t0 = temp[idx++ & 3];
-      s64 t1 = temp[idx++ & 3];
-      s64 t2 = temp[idx++ & 3];
-      s64 t3 = temp[idx++ & 3];
-
-      s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
-
-      output[i] = MathUtil::SaturatingCast<s16>(samp);
+      block_count /= 2;
+      input_count = GetResamplerInputCount(block_count, curr_pos, ratio, pb.src_type);
     }
 
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
-  }
-  else if (srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
-  {
-    // This is the circular buffer containing samples to use for the
-    // interpolation. It is initialized with the values from the PB, and it
-    // will be stored back to the PB at the end.
-    s16 temp[4];
-    u32 idx = 0;
-
-    temp[idx++ & 3] = last_samples[0];
-    temp[idx++ & 3] = last_samples[1];
-    temp[idx++ & 3] = last_samples[2];
-    temp[idx++ & 3] = last_samples[3];
-
-    for (u32 i = 0; i < count; ++i)
+    // A single output sample only depends on the last four input samples, so the samples before
+    // those still have to be read, but don't need to be kept.
+    u32 block_ratio = ratio;
+    if (input_count > MAX_INPUT_SAMPLES)
     {
-      curr_pos += ratio;
-
-      // While our current position is >= 1.0, push new samples to the
-      // circular buffer.
-      while (curr_pos >= 0x10000)
-      {
-        temp[idx++ & 3] = input_callback(read_samples_count++);
-        curr_pos -= 0x10000;
-      }
-
-      // Get our current fractional position, used to know how much of
-      // curr0 and how much of curr1 the output sample should be.
-      u16 curr_frac = curr_pos & 0xFFFF;
-      u16 inv_curr_frac = -curr_frac;
-
-      // Interpolate! If curr_frac is 0, we can simply take the last
-      // sample without any multiplying.
-      s16 sample;
-      if (curr_frac)
-      {
-        s32 s0 = temp[idx++ & 3];
-        s32 s1 = temp[idx++ & 3];
-
-        sample = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
-        idx += 2;
-      }
-      else
-      {
-        sample = temp[idx++ & 3];
-        idx += 3;
-      }
-
-      output[i] = sample;
+      const u32 skipped = input_count - MAX_INPUT_SAMPLES;
+      for (u32 i = 0; i < skipped; ++i)
+        AcceleratorGetSample();
+      block_ratio -= skipped << 16;
+      input_count = MAX_INPUT_SAMPLES;
     }
 
-    // Update the four last_samples values.
-    last_samples[3] = temp[--idx & 3];
-    last_samples[2] = temp[--idx & 3];
-    last_samples[1] = temp[--idx & 3];
-    last_samples[0] = temp[--idx & 3];
-  }
-  else  // SRCTYPE_NEAREST
-  {
-    // No sample rate conversion here: simply read samples from the
-    // accelerator to the output buffer.
-    for (u32 i = 0; i < count; ++i)
-      output[i] = input_callback(i);
+    // The last four samples of the previous block followed by the samples of this block.
+    std::array<s16, 4 + MAX_INPUT_SAMPLES> input;
+    std::copy_n(pb.src.last_samples, 4, input.begin());
+    for (u32 i = 0; i < input_count; ++i)
+      input[i + 4] = AcceleratorGetSample();
 
-    memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
+    curr_pos = ResampleSamples(input.data(), samples + done, block_count, pb.src.last_samples,
+                               curr_pos, block_ratio, pb.src_type, coeffs);
+    done += block_count;
   }
-
-  return curr_pos;
-}
-
-// Read <count> input samples from ARAM, decoding and converting rate
-// if required.
-void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
-{
-  AcceleratorSetup(&pb);
-
-  if (coeffs)
-    coeffs += pb.coef_select * 0x200;
-  u32 curr_pos =
-      ResampleAudio([](u32) { return AcceleratorGetSample(); }, samples, count, pb.src.last_samples,
-                    pb.src.cur_addr_frac, HILO_TO_32(pb.src.ratio), pb.src_type, coeffs);
   pb.src.cur_addr_frac = (curr_pos & 0xFFFF);
 
   // Update current position, YN1, YN2 and pred scale in the PB.
@@ -376,27 +287,11 @@ void GetInputSamples(PB_TYPE& pb, s16* samples, u16 count, const s16* coeffs)
 // Add samples to an output buffer, with optional volume ramping.
 void MixAdd(int* out, const s16* input, u32 count, VolumeData* vd, s16* dpop, bool ramp)
 {
-  u16& volume = vd->volume;
-  u16 volume_delta = vd->volume_delta;
-
   // If volume ramping is disabled, set volume_delta to 0. That way, the
   // mixing loop can avoid testing if volume ramping is enabled at each step,
   // and just add volume_delta.
-  if (!ramp)
-    volume_delta = 0;
-
-  for (u32 i = 0; i < count; ++i)
-  {
-    s64 sample = input[i];
-    sample *= volume;
-    sample >>= 15;
-    sample = std::clamp((s32)sample, -32767, 32767);  // -32768 ?
-
-    out[i] += (s16)sample;
-    volume += volume_delta;
-
-    *dpop = (s16)sample;
-  }
+  const u16 volume_delta = ramp ? vd->volume_delta : 0;
+  vd->volume = MixAddWithRamp(out, input, count, vd->volume, volume_delta, dpop);
 }
 
 // Execute a low pass filter on the samples using one history value. Returns
@@ -422,19 +317,16 @@ void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl
   GetInputSamples(pb, samples, count, coeffs);
 
   // Apply a global volume ramp using the volume envelope parameters.
-  for (u32 i = 0; i < count; ++i)
-  {
 #ifdef AX_GC
-    // signed on GameCube
-    const s32 volume = (s16)pb.vol_env.cur_volume;
+  // signed on GameCube
+  constexpr bool signed_volume = true;
 #else
-    // unsigned on Wii
-    const s32 volume = (u16)pb.vol_env.cur_volume;
+  // unsigned on Wii
+  constexpr bool signed_volume = false;
 #endif
-    const s32 sample = ((s32)samples[i] * volume) >> 15;
-    samples[i] = std::clamp(sample, -32767, 32767);  // -32768 ?
-    pb.vol_env.cur_volume += pb.vol_env.cur_volume_delta;
-  }
+  pb.vol_env.cur_volume = static_cast<s16>(
+      ApplyVolumeRamp(samples, count, static_cast<u16>(pb.vol_env.cur_volume),
+                      static_cast<u16>(pb.vol_env.cur_volume_delta), signed_volume));
 
   // Optionally, execute a low pass filter
   if (pb.lpf.enabled)
@@ -536,9 +428,16 @@ void ProcessVoice(PB_TYPE& pb, const AXBuffers& buffers, u16 count, AXMixControl
 
     // We use ratio 0x55555 == (5 * 65536 + 21845) / 65536 == 5.3333 which
     // is the nearest we can get to 96/18
-    u32 curr_pos = ResampleAudio([&samples](u32 i) { return samples[i]; }, wm_samples, wm_count,
-                                 pb.remote_src.last_samples, pb.remote_src.cur_addr_frac, 0x55555,
-                                 SRCTYPE_POLYPHASE, coeffs);
+    constexpr u32 wm_ratio = 0x55555;
+    s16 wm_input[4 + MAX_SAMPLES_PER_FRAME];
+    const u32 wm_input_count = GetResamplerInputCount(wm_count, pb.remote_src.cur_addr_frac,
+                                                      wm_ratio, SRCTYPE_POLYPHASE);
+    std::copy_n(pb.remote_src.last_samples, 4, wm_input);
+    std::copy_n(samples, wm_input_count, wm_input + 4);
+
+    u32 curr_pos =
+        ResampleSamples(wm_input, wm_samples, wm_count, pb.remote_src.last_samples,
+                        pb.remote_src.cur_addr_frac, wm_ratio, SRCTYPE_POLYPHASE, coeffs);
     pb.remote_src.cur_addr_frac = curr_pos & 0xFFFF;
 
 // Mix to main[0-3] and aux[0-3]
@@ -262,7 +262,7 @@ void ZeldaUCode::HandleMailDefault(u32 mail)
       if (m_sync_flags_second_half)
         m_sync_max_voice_id = 0xFFFF;
 
-      RenderAudio();
+      m_dsphle->RunAsync([this] { RenderAudio(); });
       if (m_sync_flags_second_half)
         SetMailState(MailState::WAITING);
       m_sync_flags_second_half = !m_sync_flags_second_half;
@@ -271,7 +271,7 @@ void ZeldaUCode::HandleMailDefault(u32 mail)
     {
       m_sync_max_voice_id = (((mail >> 16) & 0xF) + 1) << 4;
       m_sync_voice_skip_flags[(mail >> 16) & 0xFF] = mail & 0xFFFF;
-      RenderAudio();
+      m_dsphle->RunAsync([this] { RenderAudio(); });
       SetMailState(MailState::WAITING);
     }
     break;
@@ -528,7 +528,7 @@ void ZeldaUCode::RunPendingCommands()
       }
       else
       {
-        RenderAudio();
+        m_dsphle->RunAsync([this] { RenderAudio(); });
       }
       return;
 
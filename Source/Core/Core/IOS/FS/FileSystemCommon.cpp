@@ -9,6 +9,8 @@
 #include "Common/FileUtil.h"
 #include "Core/IOS/Device.h"
 #include "Core/IOS/FS/HostBackend/FS.h"
+#include "Core/IOS/FS/MemoryBackend/FS.h"
+#include "Core/WiiRoot.h"
 
 namespace IOS::HLE::FS
 {
@@ -39,6 +41,12 @@ SplitPathResult SplitPathAndBasename(std::string_view path)
 std::unique_ptr<FileSystem> MakeFileSystem(Location location,
                                            std::vector<NandRedirect> nand_redirects)
 {
+  if (location == Location::Session)
+  {
+    if (std::shared_ptr<MemoryNand> nand = Core::GetSessionMemoryNand())
+      return std::make_unique<MemoryFileSystem>(std::move(nand));
+  }
+
   const std::string nand_root =
       File::GetUserPath(location == Location::Session ? D_SESSION_WIIROOT_IDX : D_WIIROOT_IDX);
   return std::make_unique<HostFileSystem>(nand_root, std::move(nand_redirects));
@@ -17,10 +17,12 @@
 #include "Common/ChunkFile.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
 #include "Core/IOS/ES/ES.h"
+#include "Core/IOS/FS/SnapshotStore.h"
 #include "Core/IOS/IOS.h"
 #include "Core/Movie.h"
 #include "Core/WiiRoot.h"
@@ -370,11 +372,217 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
   p.Do(type);
 }
 
+std::optional<HostFileSystem::FileDigest>
+HostFileSystem::GetFileDigest(const std::string& host_path)
+{
+  const std::filesystem::path path = StringToPath(host_path);
+  std::error_code error;
+  const u64 size = std::filesystem::file_size(path, error);
+  if (error)
+    return std::nullopt;
+  const auto last_write_time = std::filesystem::last_write_time(path, error);
+  if (error)
+    return std::nullopt;
+
+  const auto it = m_digest_cache.find(host_path);
+  if (it != m_digest_cache.end() && it->second.size == size &&
+      it->second.last_write_time == last_write_time)
+  {
+    return it->second;
+  }
+
+  File::IOFile file(host_path, "rb");
+  auto context = Common::SHA1::CreateContext();
+  std::vector<u8> buffer(BUFFER_CHUNK_SIZE);
+  for (u64 remaining = size; remaining != 0;)
+  {
+    const size_t chunk_size = static_cast<size_t>(std::min<u64>(remaining, buffer.size()));
+    if (!file.ReadBytes(buffer.data(), chunk_size))
+      return std::nullopt;
+    context->Update(buffer.data(), chunk_size);
+    remaining -= chunk_size;
+  }
+
+  const FileDigest digest{size, last_write_time, context->Finish()};
+  m_digest_cache.insert_or_assign(host_path, digest);
+  return digest;
+}
+
+void HostFileSystem::ForgetFileDigests(const std::string& host_path)
+{
+  m_digest_cache.erase(host_path);
+  const std::string prefix = host_path + '/';
+  auto it = m_digest_cache.lower_bound(prefix);
+  while (it != m_digest_cache.end() && it->first.starts_with(prefix))
+    it = m_digest_cache.erase(it);
+}
+
+void HostFileSystem::DoSnapshotWriteOrMeasure(PointerWrap& p, std::string start_directory_path)
+{
+  std::string path = BuildFilename(start_directory_path).host_path;
+  if (p.IsWriteMode())
+    File::CreateFullPath(File::GetUserPath(D_STATESAVES_IDX) + "NAND/");
+
+  File::FSTEntry parent_entry = File::ScanDirectoryTree(path, true);
+  std::deque<File::FSTEntry> todo;
+  todo.insert(todo.end(), parent_entry.children.begin(), parent_entry.children.end());
+
+  while (!todo.empty())
+  {
+    File::FSTEntry& entry = todo.front();
+    std::string name = entry.physicalName;
+    name.erase(0, path.length() + 1);
+    if (entry.isDirectory)
+    {
+      char type = 'd';
+      p.Do(type);
+      p.Do(name);
+      todo.insert(todo.end(), entry.children.begin(), entry.children.end());
+    }
+    else if (std::optional<FileDigest> digest = GetFileDigest(entry.physicalName))
+    {
+      char type = 'f';
+      p.Do(type);
+      p.Do(name);
+      p.Do(digest->size);
+      p.DoArray(digest->digest);
+      if (p.IsWriteMode() && !StoreSnapshotBlob(entry.physicalName, digest->digest))
+      {
+        ERROR_LOG_FMT(IOS_FS, "Failed to store {} for the savestate", entry.physicalName);
+        p.SetMeasureMode();
+        return;
+      }
+    }
+    else
+    {
+      ERROR_LOG_FMT(IOS_FS, "Failed to read {} for the savestate", entry.physicalName);
+    }
+    todo.pop_front();
+  }
+
+  char type = 0;
+  p.Do(type);
+
+  if (p.IsWriteMode())
+    PruneSnapshotBlobs();
+}
+
+void HostFileSystem::DoSnapshotRead(PointerWrap& p, std::string start_directory_path)
+{
+  std::string path = BuildFilename(start_directory_path).host_path;
+
+  struct SnapshotEntry
+  {
+    bool is_file = false;
+    u64 size = 0;
+    Common::SHA1::Digest digest{};
+  };
+  // Sorted, so that directories always come before their contents.
+  std::map<std::string, SnapshotEntry> snapshot;
+  while (true)
+  {
+    char type = 0;
+    p.Do(type);
+    if (!type)
+      break;
+    std::string name;
+    p.Do(name);
+    SnapshotEntry& entry = snapshot[name];
+    entry.is_file = type == 'f';
+    if (entry.is_file)
+    {
+      p.Do(entry.size);
+      p.DoArray(entry.digest);
+    }
+  }
+  if (!p.IsReadMode())
+    return;
+
+  // Make sure that everything can be restored before modifying anything, so that a missing blob
+  // doesn't leave the NAND half restored.
+  std::vector<std::pair<std::string, std::string>> files_to_restore;
+  for (const auto& [name, entry] : snapshot)
+  {
+    if (!entry.is_file)
+      continue;
+
+    const std::string host_path = path + "/" + name;
+    const std::optional<FileDigest> digest = GetFileDigest(host_path);
+    if (digest && digest->size == entry.size && digest->digest == entry.digest)
+      continue;
+
+    std::string blob_path = GetSnapshotBlobPath(entry.digest);
+    if (!File::IsFile(blob_path) || File::GetSize(blob_path) != entry.size)
+    {
+      PanicAlertFmtT("Failed to restore {0} from the NAND snapshot store.\n\n"
+                     "{1} is missing or cannot be read.",
+                     name, blob_path);
+      p.SetMeasureMode();
+      return;
+    }
+    files_to_restore.emplace_back(host_path, std::move(blob_path));
+  }
+
+  // Only touch what differs from the snapshot, which usually is very little.
+  File::FSTEntry parent_entry = File::ScanDirectoryTree(path, true);
+  std::deque<File::FSTEntry> todo;
+  todo.insert(todo.end(), parent_entry.children.begin(), parent_entry.children.end());
+  while (!todo.empty())
+  {
+    File::FSTEntry& entry = todo.front();
+    std::string name = entry.physicalName;
+    name.erase(0, path.length() + 1);
+    const auto it = snapshot.find(name);
+    if (it == snapshot.end() || it->second.is_file == entry.isDirectory)
+    {
+      if (entry.isDirectory)
+        File::DeleteDirRecursively(entry.physicalName);
+      else
+        File::Delete(entry.physicalName);
+      ForgetFileDigests(entry.physicalName);
+    }
+    else if (entry.isDirectory)
+    {
+      todo.insert(todo.end(), entry.children.begin(), entry.children.end());
+    }
+    todo.pop_front();
+  }
+
+  for (const auto& [name, entry] : snapshot)
+  {
+    if (!entry.is_file)
+      File::CreateDir(path + "/" + name);
+  }
+
+  for (const auto& [host_path, blob_path] : files_to_restore)
+  {
+    ForgetFileDigests(host_path);
+    if (!File::CopyRegularFile(blob_path, host_path))
+    {
+      PanicAlertFmtT("Failed to restore {0} from the NAND snapshot store.\n\n"
+                     "{1} cannot be read.",
+                     host_path, blob_path);
+      p.SetMeasureMode();
+      return;
+    }
+  }
+}
+
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // Savestates can't be loaded with a different NAND backend.
+  p.DoMarker("HostFileSystem", 0x484f5300);
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
+  {
     handle.host_file.reset();
+    if (handle.written)
+    {
+      ForgetFileDigests(BuildFilename(handle.wii_path).host_path);
+      handle.written = false;
+    }
+  }
 
   // The format for the next part of the save state is follows:
   // 1. bool Movie::WasMovieActiveWhenStateSaved() &&
@@ -382,8 +590,8 @@ void HostFileSystem::DoState(PointerWrap& p)
   // 2. Contents of the "/tmp" directory recursively.
   // 3. u32 size_of_nand_folder_saved_below (or 0, if the root
   // of the NAND folder is not savestated below).
-  // 4. Contents of the "/" directory recursively (or nothing, if the
-  // root of the NAND folder is not save stated).
+  // 4. A manifest of the "/" directory recursively, with the file contents kept in the NAND
+  // snapshot store (or nothing, if the root of the NAND folder is not save stated).
 
   // The "/" directory is only saved when a savestate is made during a movie recording
   // and when the directory root is temporary (i.e. WiiSession).
@@ -403,7 +611,7 @@ void HostFileSystem::DoState(PointerWrap& p)
     u8* previous_position = p.ReserveU32();
     if (original_save_state_made_during_movie_recording)
     {
-      DoStateWriteOrMeasure(p, "/");
+      DoSnapshotWriteOrMeasure(p, "/");
       if (p.IsWriteMode())
       {
         u32 size_of_nand = p.GetOffsetFromPreviousPosition(previous_position) - sizeof(u32);
@@ -425,7 +633,7 @@ void HostFileSystem::DoState(PointerWrap& p)
     {
       p.Do(temp_val);
       if (Movie::IsMovieActive() && Core::WiiRootIsTemporary())
-        DoStateRead(p, "/");
+        DoSnapshotRead(p, "/");
     }
   }
 
@@ -449,6 +657,7 @@ ResultCode HostFileSystem::Format(Uid uid)
   const std::string root = BuildFilename("/").host_path;
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
+  m_digest_cache.clear();
   ResetFst();
   SaveFst();
   // Reset and close all handles.
@@ -550,6 +759,7 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
     File::DeleteDirRecursively(host_path);
   else
     return ResultCode::InUse;
+  ForgetFileDigests(host_path);
 
   const auto it = std::find_if(parent->children.begin(), parent->children.end(),
                                GetNamePredicate(split_path.file_name));
@@ -637,6 +847,9 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     }
   }
 
+  ForgetFileDigests(host_old_path);
+  ForgetFileDigests(host_new_path);
+
   FstEntry* new_entry = GetFstEntryForPath(new_path);
   new_entry->name = split_new_path.file_name;
 
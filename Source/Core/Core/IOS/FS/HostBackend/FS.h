@@ -4,12 +4,15 @@
 #pragma once
 
 #include <array>
+#include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Core/IOS/FS/FileSystem.h"
 
@@ -62,6 +65,11 @@ public:
 private:
   void DoStateWriteOrMeasure(PointerWrap& p, std::string start_directory_path);
   void DoStateRead(PointerWrap& p, std::string start_directory_path);
+  // Like the above, but only a manifest of content hashes is stored in the savestate. The file
+  // contents go to a content-addressed blob store shared by all savestates, so files that have
+  // not changed since the last savestate cost neither a copy nor a read.
+  void DoSnapshotWriteOrMeasure(PointerWrap& p, std::string start_directory_path);
+  void DoSnapshotRead(PointerWrap& p, std::string start_directory_path);
 
   struct FstEntry
   {
@@ -83,6 +91,7 @@ private:
     std::string wii_path;
     std::shared_ptr<File::IOFile> host_file;
     u32 file_offset = 0;
+    bool written = false;
   };
   Handle* AssignFreeHandle();
   Handle* GetHandleFromFd(Fd fd);
@@ -101,6 +110,17 @@ private:
   bool IsFileOpened(const std::string& path) const;
   bool IsDirectoryInUse(const std::string& path) const;
 
+  struct FileDigest
+  {
+    u64 size;
+    std::filesystem::file_time_type last_write_time;
+    Common::SHA1::Digest digest;
+  };
+  /// Hashes a host file, or returns the cached digest if the file has not changed since.
+  std::optional<FileDigest> GetFileDigest(const std::string& host_path);
+  /// Drops the cached digests of a host file or of all files inside a host directory.
+  void ForgetFileDigests(const std::string& host_path);
+
   std::string GetFstFilePath() const;
   void ResetFst();
   void LoadFst();
@@ -123,6 +143,9 @@ private:
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
 
+  /// Content hashes of host files, keyed by host path.
+  std::map<std::string, FileDigest> m_digest_cache;
+
   FstEntry m_redirect_fst{};
   std::vector<NandRedirect> m_nand_redirects;
 };
@@ -106,6 +106,9 @@ ResultCode HostFileSystem::Close(Fd fd)
   if (!handle)
     return ResultCode::Invalid;
 
+  if (handle->written)
+    ForgetFileDigests(BuildFilename(handle->wii_path).host_path);
+
   // Let go of our pointer to the file, it will automatically close if we are the last handle
   // accessing it.
   *handle = Handle{};
@@ -154,6 +157,7 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
     return ResultCode::AccessDenied;
 
   handle->file_offset += count;
+  handle->written = true;
   return count;
 }
 
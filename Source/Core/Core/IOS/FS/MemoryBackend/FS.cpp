@@ -0,0 +1,931 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/MemoryBackend/FS.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Common/Align.h"
+#include "Common/ChunkFile.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/NandPaths.h"
+#include "Common/StringUtil.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
+#include "Core/IOS/FS/SnapshotStore.h"
+#include "Core/Movie.h"
+
+namespace IOS::HLE::FS
+{
+namespace
+{
+auto GetNamePredicate(const std::string& name)
+{
+  return [&name](const auto& entry) { return entry.name == name; };
+}
+
+std::string GetChildPath(const std::string& path, const std::string& name)
+{
+  return (path == "/" ? "" : path) + '/' + name;
+}
+
+void ResetRoot(Metadata* data)
+{
+  *data = {};
+  // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
+  data->modes = {Mode::None, Mode::Read, Mode::Read};
+}
+}  // namespace
+
+bool MemoryNand::Entry::CheckPermission(Uid caller_uid, Gid caller_gid, Mode requested_mode) const
+{
+  if (caller_uid == 0)
+    return true;
+  Mode file_mode = data.modes.other;
+  if (data.uid == caller_uid)
+    file_mode = data.modes.owner;
+  else if (data.gid == caller_gid)
+    file_mode = data.modes.group;
+  return (u8(requested_mode) & u8(file_mode)) == u8(requested_mode);
+}
+
+u32 MemoryNand::Entry::GetSize() const
+{
+  return contents ? static_cast<u32>(contents->size()) : data.size;
+}
+
+MemoryNand::MemoryNand(std::string base_path)
+{
+  m_root.name = "/";
+  ResetRoot(&m_root.data);
+
+  while (base_path.ends_with('/'))
+    base_path.pop_back();
+  if (base_path.empty() || !File::IsDirectory(base_path))
+    return;
+
+  // Reading the base through HostFileSystem gets us the metadata from its FST.
+  HostFileSystem base{base_path};
+  AddBaseEntries(base, base_path, "/", &m_root);
+
+  INFO_LOG_FMT(IOS_FS, "Using {} as the base of the in-memory NAND", base_path);
+}
+
+bool MemoryNand::AddBaseDirectory(std::string base_path, const std::string& nand_path, Uid uid,
+                                  Gid gid)
+{
+  while (base_path.ends_with('/'))
+    base_path.pop_back();
+  if (!IsValidNonRootPath(nand_path) || !File::IsDirectory(base_path))
+    return false;
+
+  HostFileSystem base{base_path};
+  const Result<Metadata> metadata = base.GetMetadata(0, 0, nand_path);
+  if (!metadata || metadata->is_file)
+    return false;
+
+  std::string path;
+  Entry* entry = &m_root;
+  for (const std::string& component : SplitString(nand_path.substr(1), '/'))
+  {
+    path += '/' + component;
+    auto next =
+        std::find_if(entry->children.begin(), entry->children.end(), GetNamePredicate(component));
+    if (next == entry->children.end())
+    {
+      const Result<Metadata> parent_metadata = base.GetMetadata(0, 0, path);
+      if (!parent_metadata)
+        return false;
+      Entry& child = entry->children.emplace_back();
+      child.name = component;
+      child.data = *parent_metadata;
+      child.data.uid = uid;
+      child.data.gid = gid;
+      next = std::prev(entry->children.end());
+    }
+    if (next->data.is_file)
+      return false;
+    entry = &*next;
+  }
+
+  entry->children.clear();
+  AddBaseEntries(base, base_path, nand_path, entry);
+
+  const auto set_owner = [&](const auto& self, Entry* owned) -> void {
+    owned->data.uid = uid;
+    owned->data.gid = gid;
+    for (Entry& child : owned->children)
+      self(self, &child);
+  };
+  for (Entry& child : entry->children)
+    set_owner(set_owner, &child);
+
+  INFO_LOG_FMT(IOS_FS, "Using {} from {} in the in-memory NAND", nand_path, base_path);
+  return true;
+}
+
+void MemoryNand::AddBaseEntries(HostFileSystem& base, const std::string& base_path,
+                                const std::string& path, Entry* entry)
+{
+  const Result<std::vector<std::string>> children = base.ReadDirectory(0, 0, path);
+  if (!children)
+    return;
+
+  // The newest entries are listed first.
+  for (auto it = children->rbegin(); it != children->rend(); ++it)
+  {
+    const std::string child_path = GetChildPath(path, *it);
+    const Result<Metadata> metadata = base.GetMetadata(0, 0, child_path);
+    if (!metadata)
+      continue;
+
+    Entry& child = entry->children.emplace_back();
+    child.name = *it;
+    child.data = *metadata;
+    if (metadata->is_file)
+      child.base_path = base_path + Common::EscapePath(child_path);
+    else
+      AddBaseEntries(base, base_path, child_path, &child);
+  }
+}
+
+bool MemoryNand::LoadContents(Entry* entry)
+{
+  if (entry->contents)
+    return true;
+
+  auto contents = std::make_shared<std::vector<u8>>(entry->data.size);
+  File::IOFile file(entry->base_path, "rb");
+  if (!file.ReadBytes(contents->data(), contents->size()))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to load {} from the base NAND", entry->base_path);
+    return false;
+  }
+
+  entry->contents = std::move(contents);
+  entry->base_path.clear();
+  entry->base_digest.reset();
+  return true;
+}
+
+bool MemoryNand::Flush(std::string host_path)
+{
+  while (host_path.ends_with('/'))
+    host_path.pop_back();
+
+  // Directories are only replaced if they are empty or contain a NAND, so that a wrong path
+  // doesn't wipe unrelated files.
+  const auto can_replace = [](const std::string& path) {
+    if (!File::Exists(path))
+      return true;
+    if (!File::IsDirectory(path))
+      return false;
+    const File::FSTEntry contents = File::ScanDirectoryTree(path, false);
+    return contents.children.empty() || File::IsFile(path + "/fst.bin") ||
+           File::IsDirectory(path + "/title");
+  };
+
+  // The NAND is written next to the target and then moved into place, so that the target
+  // never contains a partially written NAND.
+  const std::string temp_path = host_path + ".flush";
+  const std::string old_path = host_path + ".old";
+  if (host_path.empty() || !can_replace(host_path) || !can_replace(temp_path) ||
+      !can_replace(old_path))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Refusing to flush the in-memory NAND to {}, which is not a NAND",
+                  host_path);
+    return false;
+  }
+  File::DeleteDirRecursively(temp_path);
+  File::DeleteDirRecursively(old_path);
+
+  HostFileSystem fs{temp_path};
+
+  bool success = true;
+  const auto flush = [&](const auto& self, const std::string& path, Entry* entry) -> void {
+    for (Entry& child : entry->children)
+    {
+      const std::string child_path = GetChildPath(path, child.name);
+      const Metadata& data = child.data;
+      const ResultCode result =
+          data.is_file ? fs.CreateFile(0, 0, child_path, data.attribute, data.modes) :
+                         fs.CreateDirectory(0, 0, child_path, data.attribute, data.modes);
+      if (result != ResultCode::Success ||
+          fs.SetMetadata(0, child_path, data.uid, data.gid, data.attribute, data.modes) !=
+              ResultCode::Success)
+      {
+        ERROR_LOG_FMT(IOS_FS, "Failed to flush {} to {}", child_path, temp_path);
+        success = false;
+        continue;
+      }
+
+      if (!data.is_file)
+      {
+        self(self, child_path, &child);
+        continue;
+      }
+
+      const Result<FileHandle> file = fs.OpenFile(0, 0, child_path, Mode::Write);
+      if (!LoadContents(&child) || !file ||
+          !file->Write(child.contents->data(), child.contents->size()))
+      {
+        ERROR_LOG_FMT(IOS_FS, "Failed to flush {} to {}", child_path, temp_path);
+        success = false;
+      }
+    }
+  };
+  flush(flush, "/", &m_root);
+
+  if (!success || (File::Exists(host_path) && !File::Rename(host_path, old_path)) ||
+      !File::Rename(temp_path, host_path))
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to flush the in-memory NAND to {}", host_path);
+    File::DeleteDirRecursively(temp_path);
+    return false;
+  }
+  File::DeleteDirRecursively(old_path);
+
+  INFO_LOG_FMT(IOS_FS, "Flushed the in-memory NAND to {}", host_path);
+  return true;
+}
+
+MemoryFileSystem::MemoryFileSystem(std::shared_ptr<MemoryNand> nand) : m_nand{std::move(nand)}
+{
+}
+
+MemoryFileSystem::~MemoryFileSystem() = default;
+
+void MemoryFileSystem::DoStateEntry(PointerWrap& p, Entry* entry)
+{
+  p.Do(entry->name);
+  p.Do(entry->data);
+  if (entry->data.is_file)
+  {
+    if (!p.IsReadMode())
+      MemoryNand::LoadContents(entry);
+    if (!entry->contents)
+      entry->contents = std::make_shared<std::vector<u8>>();
+    p.Do(*entry->contents);
+    return;
+  }
+
+  u32 count = static_cast<u32>(entry->children.size());
+  p.Do(count);
+  if (p.IsReadMode())
+    entry->children.resize(count);
+  for (Entry& child : entry->children)
+    DoStateEntry(p, &child);
+}
+
+bool MemoryFileSystem::DoSnapshotEntry(PointerWrap& p, Entry* entry)
+{
+  if (!p.IsReadMode() && entry->data.is_file)
+    entry->data.size = entry->GetSize();
+  p.Do(entry->name);
+  p.Do(entry->data);
+  if (!entry->data.is_file)
+  {
+    u32 count = static_cast<u32>(entry->children.size());
+    p.Do(count);
+    if (p.IsReadMode())
+      entry->children.resize(count);
+    for (Entry& child : entry->children)
+    {
+      if (!DoSnapshotEntry(p, &child))
+        return false;
+    }
+    return true;
+  }
+
+  u32 size = entry->data.size;
+  Common::SHA1::Digest digest{};
+  if (p.IsWriteMode())
+  {
+    bool stored = false;
+    if (entry->contents)
+    {
+      digest = Common::SHA1::CalculateDigest(*entry->contents);
+      stored = StoreSnapshotBlob(*entry->contents, digest);
+    }
+    else if (entry->base_digest)
+    {
+      // Still unchanged since it was restored from the snapshot store
+      digest = *entry->base_digest;
+      stored = StoreSnapshotBlob(entry->base_path, digest);
+    }
+    else
+    {
+      std::vector<u8> contents(size);
+      if (File::IOFile(entry->base_path, "rb").ReadBytes(contents.data(), contents.size()))
+      {
+        digest = Common::SHA1::CalculateDigest(contents);
+        stored = StoreSnapshotBlob(entry->base_path, digest);
+        entry->base_digest = digest;
+      }
+    }
+
+    if (!stored)
+    {
+      ERROR_LOG_FMT(IOS_FS, "Failed to store {} for the savestate", entry->name);
+      p.SetMeasureMode();
+      return false;
+    }
+  }
+  p.Do(size);
+  p.DoArray(digest);
+
+  if (p.IsReadMode())
+  {
+    // The contents are only read from the snapshot store when they are needed.
+    entry->data.size = size;
+    entry->contents.reset();
+    entry->base_path = GetSnapshotBlobPath(digest);
+    entry->base_digest = digest;
+  }
+  return true;
+}
+
+void MemoryFileSystem::DoState(PointerWrap& p)
+{
+  // Savestates can't be loaded with a different NAND backend.
+  p.DoMarker("MemoryFileSystem", 0x4d454d00);
+
+  // Like with HostFileSystem, "/tmp" is always savestated and the whole NAND only
+  // during movie recording.
+  bool whole_nand = Movie::IsMovieActive();
+  p.Do(whole_nand);
+
+  Entry* root = &m_nand->m_root;
+  if (whole_nand)
+  {
+    if (!p.IsReadMode())
+    {
+      if (p.IsWriteMode())
+        File::CreateFullPath(File::GetUserPath(D_STATESAVES_IDX) + "NAND/");
+      if (DoSnapshotEntry(p, root) && p.IsWriteMode())
+        PruneSnapshotBlobs();
+    }
+    else
+    {
+      Entry state_root;
+      DoSnapshotEntry(p, &state_root);
+
+      // Make sure that everything can be restored before replacing the NAND.
+      const auto find_missing_blob = [](const auto& self, const Entry& entry) -> const Entry* {
+        if (entry.data.is_file)
+        {
+          const bool exists =
+              File::IsFile(entry.base_path) && File::GetSize(entry.base_path) == entry.data.size;
+          return exists ? nullptr : &entry;
+        }
+        for (const Entry& child : entry.children)
+        {
+          if (const Entry* missing = self(self, child))
+            return missing;
+        }
+        return nullptr;
+      };
+
+      if (Movie::IsMovieActive())
+      {
+        if (const Entry* missing = find_missing_blob(find_missing_blob, state_root))
+        {
+          PanicAlertFmtT("Failed to restore {0} from the NAND snapshot store.\n\n"
+                         "{1} is missing or cannot be read.",
+                         missing->name, missing->base_path);
+          p.SetMeasureMode();
+        }
+        else
+        {
+          *root = std::move(state_root);
+        }
+      }
+    }
+  }
+  else
+  {
+    const std::string tmp_name = "tmp";
+    const auto tmp = std::find_if(root->children.begin(), root->children.end(),
+                                  GetNamePredicate(tmp_name));
+    bool has_tmp = tmp != root->children.end();
+    p.Do(has_tmp);
+    if (!p.IsReadMode())
+    {
+      if (has_tmp)
+        DoStateEntry(p, &*tmp);
+    }
+    else
+    {
+      if (tmp != root->children.end())
+        root->children.erase(tmp);
+      if (has_tmp)
+        DoStateEntry(p, &root->children.emplace_back());
+    }
+  }
+
+  for (Handle& handle : m_handles)
+  {
+    p.Do(handle.opened);
+    p.Do(handle.mode);
+    p.Do(handle.wii_path);
+    p.Do(handle.file_offset);
+    if (!p.IsReadMode() || !handle.opened)
+      continue;
+
+    Entry* entry = GetEntryForPath(handle.wii_path);
+    if (entry && entry->data.is_file && MemoryNand::LoadContents(entry))
+    {
+      handle.contents = entry->contents;
+    }
+    else
+    {
+      WARN_LOG_FMT(IOS_FS, "{} is no longer there after loading the state", handle.wii_path);
+      handle = Handle{};
+    }
+  }
+}
+
+ResultCode MemoryFileSystem::Format(Uid uid)
+{
+  if (uid != 0)
+    return ResultCode::AccessDenied;
+  m_nand->m_root.children.clear();
+  ResetRoot(&m_nand->m_root.data);
+  // Reset and close all handles.
+  m_handles = {};
+  return ResultCode::Success;
+}
+
+MemoryFileSystem::Entry* MemoryFileSystem::GetEntryForPath(const std::string& path)
+{
+  if (path == "/")
+    return &m_nand->m_root;
+
+  if (!IsValidNonRootPath(path))
+    return nullptr;
+
+  Entry* entry = &m_nand->m_root;
+  for (const std::string& component : SplitString(path.substr(1), '/'))
+  {
+    const auto next =
+        std::find_if(entry->children.begin(), entry->children.end(), GetNamePredicate(component));
+    if (entry->data.is_file || next == entry->children.end())
+      return nullptr;
+    entry = &*next;
+  }
+  return entry;
+}
+
+Result<FileHandle> MemoryFileSystem::OpenFile(Uid, Gid, const std::string& path, Mode mode)
+{
+  Handle* handle = AssignFreeHandle();
+  if (!handle)
+    return ResultCode::NoFreeHandle;
+
+  Entry* entry = GetEntryForPath(path);
+  if (!entry || !entry->data.is_file)
+  {
+    *handle = Handle{};
+    return ResultCode::NotFound;
+  }
+
+  if (!MemoryNand::LoadContents(entry))
+  {
+    *handle = Handle{};
+    return ResultCode::AccessDenied;
+  }
+
+  handle->wii_path = path;
+  handle->mode = mode;
+  handle->contents = entry->contents;
+  handle->file_offset = 0;
+  return FileHandle{this, ConvertHandleToFd(handle)};
+}
+
+ResultCode MemoryFileSystem::Close(Fd fd)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  *handle = Handle{};
+  return ResultCode::Success;
+}
+
+Result<u32> MemoryFileSystem::ReadBytesFromFile(Fd fd, u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Read)) == 0)
+    return ResultCode::AccessDenied;
+
+  const std::vector<u8>& contents = *handle->contents;
+  const u32 file_size = static_cast<u32>(contents.size());
+  // IOS has this check in the read request handler.
+  if (count + handle->file_offset > file_size)
+    count = file_size - handle->file_offset;
+
+  std::copy_n(contents.begin() + handle->file_offset, count, ptr);
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  if ((u8(handle->mode) & u8(Mode::Write)) == 0)
+    return ResultCode::AccessDenied;
+
+  std::vector<u8>& contents = *handle->contents;
+  if (contents.size() < handle->file_offset + count)
+    contents.resize(handle->file_offset + count);
+  std::copy_n(ptr, count, contents.begin() + handle->file_offset);
+  handle->file_offset += count;
+  return count;
+}
+
+Result<u32> MemoryFileSystem::SeekFile(Fd fd, u32 offset, SeekMode mode)
+{
+  Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  const u32 file_size = static_cast<u32>(handle->contents->size());
+  u32 new_position = 0;
+  switch (mode)
+  {
+  case SeekMode::Set:
+    new_position = offset;
+    break;
+  case SeekMode::Current:
+    new_position = handle->file_offset + offset;
+    break;
+  case SeekMode::End:
+    new_position = file_size + offset;
+    break;
+  default:
+    return ResultCode::Invalid;
+  }
+
+  // This differs from POSIX behaviour which allows seeking past the end of the file.
+  if (file_size < new_position)
+    return ResultCode::Invalid;
+
+  handle->file_offset = new_position;
+  return handle->file_offset;
+}
+
+Result<FileStatus> MemoryFileSystem::GetFileStatus(Fd fd)
+{
+  const Handle* handle = GetHandleFromFd(fd);
+  if (!handle)
+    return ResultCode::Invalid;
+
+  FileStatus status;
+  status.size = static_cast<u32>(handle->contents->size());
+  status.offset = handle->file_offset;
+  return status;
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::AssignFreeHandle()
+{
+  const auto it = std::find_if(m_handles.begin(), m_handles.end(),
+                               [](const Handle& handle) { return !handle.opened; });
+  if (it == m_handles.end())
+    return nullptr;
+
+  *it = Handle{};
+  it->opened = true;
+  return &*it;
+}
+
+MemoryFileSystem::Handle* MemoryFileSystem::GetHandleFromFd(Fd fd)
+{
+  if (fd >= m_handles.size() || !m_handles[fd].opened)
+    return nullptr;
+  return &m_handles[fd];
+}
+
+Fd MemoryFileSystem::ConvertHandleToFd(const Handle* handle) const
+{
+  return handle - m_handles.data();
+}
+
+ResultCode MemoryFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                                   FileAttribute attr, Modes modes, bool is_file)
+{
+  if (!IsValidNonRootPath(path) ||
+      !std::all_of(path.begin(), path.end(), Common::IsPrintableCharacter))
+  {
+    return ResultCode::Invalid;
+  }
+
+  if (!is_file && std::count(path.begin(), path.end(), '/') > int(MaxPathDepth))
+    return ResultCode::TooManyPathComponents;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Entry* parent = GetEntryForPath(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  if (parent->data.is_file)
+    return ResultCode::Invalid;
+
+  if (std::any_of(parent->children.begin(), parent->children.end(),
+                  GetNamePredicate(split_path.file_name)))
+  {
+    return ResultCode::AlreadyExists;
+  }
+
+  Entry& child = parent->children.emplace_back();
+  child.name = split_path.file_name;
+  child.data.is_file = is_file;
+  child.data.modes = modes;
+  child.data.uid = uid;
+  child.data.gid = gid;
+  child.data.attribute = attr;
+  if (is_file)
+    child.contents = std::make_shared<std::vector<u8>>();
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::CreateFile(Uid uid, Gid gid, const std::string& path,
+                                        FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, true);
+}
+
+ResultCode MemoryFileSystem::CreateDirectory(Uid uid, Gid gid, const std::string& path,
+                                             FileAttribute attr, Modes modes)
+{
+  return CreateFileOrDirectory(uid, gid, path, attr, modes, false);
+}
+
+bool MemoryFileSystem::IsFileOpened(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path == path;
+  });
+}
+
+bool MemoryFileSystem::IsDirectoryInUse(const std::string& path) const
+{
+  return std::any_of(m_handles.begin(), m_handles.end(), [&path](const Handle& handle) {
+    return handle.opened && handle.wii_path.starts_with(path);
+  });
+}
+
+ResultCode MemoryFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
+{
+  if (!IsValidNonRootPath(path))
+    return ResultCode::Invalid;
+
+  const auto split_path = SplitPathAndBasename(path);
+
+  Entry* parent = GetEntryForPath(split_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+
+  if (!parent->CheckPermission(uid, gid, Mode::Write))
+    return ResultCode::AccessDenied;
+
+  const auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                               GetNamePredicate(split_path.file_name));
+  if (it == parent->children.end())
+    return ResultCode::NotFound;
+
+  if (it->data.is_file ? IsFileOpened(path) : IsDirectoryInUse(path))
+    return ResultCode::InUse;
+
+  parent->children.erase(it);
+  return ResultCode::Success;
+}
+
+ResultCode MemoryFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
+                                    const std::string& new_path)
+{
+  if (!IsValidNonRootPath(old_path) || !IsValidNonRootPath(new_path))
+    return ResultCode::Invalid;
+
+  const auto split_old_path = SplitPathAndBasename(old_path);
+  const auto split_new_path = SplitPathAndBasename(new_path);
+
+  const Entry* old_parent = GetEntryForPath(split_old_path.parent);
+  const Entry* new_parent = GetEntryForPath(split_new_path.parent);
+  if (!old_parent || !new_parent)
+    return ResultCode::NotFound;
+
+  if (!old_parent->CheckPermission(uid, gid, Mode::Write) ||
+      !new_parent->CheckPermission(uid, gid, Mode::Write))
+  {
+    return ResultCode::AccessDenied;
+  }
+
+  const Entry* entry = GetEntryForPath(old_path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  // For files, the file name is not allowed to change.
+  if (entry->data.is_file && split_old_path.file_name != split_new_path.file_name)
+    return ResultCode::Invalid;
+
+  if ((!entry->data.is_file && IsDirectoryInUse(old_path)) ||
+      (entry->data.is_file && IsFileOpened(old_path)))
+  {
+    return ResultCode::InUse;
+  }
+
+  // A directory cannot be moved inside of itself.
+  if (new_path.starts_with(old_path + '/'))
+    return ResultCode::Invalid;
+
+  if (old_path == new_path)
+    return ResultCode::Success;
+
+  // If there is already something of the same type at the new path, delete it.
+  // The entries have to be looked up again after that, as their addresses may have changed.
+  if (const Entry* existing = GetEntryForPath(new_path))
+  {
+    if (existing->data.is_file != entry->data.is_file)
+      return ResultCode::Invalid;
+    Entry* parent = GetEntryForPath(split_new_path.parent);
+    parent->children.erase(std::find_if(parent->children.begin(), parent->children.end(),
+                                        GetNamePredicate(split_new_path.file_name)));
+  }
+
+  Entry* parent = GetEntryForPath(split_old_path.parent);
+  if (!parent)
+    return ResultCode::NotFound;
+  const auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                               GetNamePredicate(split_old_path.file_name));
+  if (it == parent->children.end())
+    return ResultCode::NotFound;
+  Entry moved = std::move(*it);
+  parent->children.erase(it);
+
+  // Like on the Wii, the entry becomes the newest one in its new parent directory.
+  Entry* destination = GetEntryForPath(split_new_path.parent);
+  if (!destination)
+    return ResultCode::NotFound;
+  moved.name = split_new_path.file_name;
+  destination->children.push_back(std::move(moved));
+  return ResultCode::Success;
+}
+
+Result<std::vector<std::string>> MemoryFileSystem::ReadDirectory(Uid uid, Gid gid,
+                                                                 const std::string& path)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  const Entry* entry = GetEntryForPath(path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  if (!entry->CheckPermission(uid, gid, Mode::Read))
+    return ResultCode::AccessDenied;
+
+  if (entry->data.is_file)
+    return ResultCode::Invalid;
+
+  // Nintendo traverses a linked list in which new elements are inserted at the front.
+  std::vector<std::string> output;
+  output.reserve(entry->children.size());
+  for (auto it = entry->children.rbegin(); it != entry->children.rend(); ++it)
+    output.emplace_back(it->name);
+  return output;
+}
+
+Result<Metadata> MemoryFileSystem::GetMetadata(Uid uid, Gid gid, const std::string& path)
+{
+  const Entry* entry = nullptr;
+  if (path == "/")
+  {
+    entry = &m_nand->m_root;
+  }
+  else
+  {
+    if (!IsValidNonRootPath(path))
+      return ResultCode::Invalid;
+
+    const auto split_path = SplitPathAndBasename(path);
+    const Entry* parent = GetEntryForPath(split_path.parent);
+    if (!parent)
+      return ResultCode::NotFound;
+    if (!parent->CheckPermission(uid, gid, Mode::Read))
+      return ResultCode::AccessDenied;
+    entry = GetEntryForPath(path);
+  }
+
+  if (!entry)
+    return ResultCode::NotFound;
+
+  Metadata metadata = entry->data;
+  metadata.size = entry->data.is_file ? entry->GetSize() : 0;
+  return metadata;
+}
+
+ResultCode MemoryFileSystem::SetMetadata(Uid caller_uid, const std::string& path, Uid uid,
+                                         Gid gid, FileAttribute attr, Modes modes)
+{
+  if (!IsValidPath(path))
+    return ResultCode::Invalid;
+
+  Entry* entry = GetEntryForPath(path);
+  if (!entry)
+    return ResultCode::NotFound;
+
+  if (caller_uid != 0 && caller_uid != entry->data.uid)
+    return ResultCode::AccessDenied;
+  if (caller_uid != 0 && uid != entry->data.uid)
+    return ResultCode::AccessDenied;
+
+  if (entry->data.uid != uid && entry->data.is_file && entry->GetSize() != 0)
+    return ResultCode::FileNotEmpty;
+
+  entry->data.gid = gid;
+  entry->data.uid = uid;
+  entry->data.attribute = attr;
+  entry->data.modes = modes;
+  return ResultCode::Success;
+}
+
+Result<NandStats> MemoryFileSystem::GetNandStats()
+{
+  const auto root_stats = GetDirectoryStats("/");
+  if (!root_stats)
+    return root_stats.Error();
+
+  NandStats stats{};
+  stats.cluster_size = CLUSTER_SIZE;
+  stats.free_clusters = USABLE_CLUSTERS - root_stats->used_clusters;
+  stats.used_clusters = root_stats->used_clusters;
+  stats.bad_clusters = 0;
+  stats.reserved_clusters = RESERVED_CLUSTERS;
+  stats.free_inodes = TOTAL_INODES - root_stats->used_inodes;
+  stats.used_inodes = root_stats->used_inodes;
+
+  return stats;
+}
+
+Result<DirectoryStats> MemoryFileSystem::GetDirectoryStats(const std::string& wii_path)
+{
+  const auto result = GetExtendedDirectoryStats(wii_path);
+  if (!result)
+    return result.Error();
+
+  DirectoryStats stats{};
+  stats.used_inodes = static_cast<u32>(std::min<u64>(result->used_inodes, TOTAL_INODES));
+  stats.used_clusters = static_cast<u32>(std::min<u64>(result->used_clusters, USABLE_CLUSTERS));
+  return stats;
+}
+
+Result<ExtendedDirectoryStats>
+MemoryFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
+{
+  if (!IsValidPath(wii_path))
+    return ResultCode::Invalid;
+
+  const Entry* entry = GetEntryForPath(wii_path);
+  if (!entry)
+    return ResultCode::NotFound;
+  if (entry->data.is_file)
+    return ResultCode::Invalid;
+
+  ExtendedDirectoryStats stats{};
+  // add one for the folder itself
+  stats.used_inodes = 1;
+  const auto add_usage = [&stats](const auto& self, const Entry& directory) -> void {
+    for (const Entry& child : directory.children)
+    {
+      ++stats.used_inodes;
+      if (child.data.is_file)
+        stats.used_clusters += Common::AlignUp(u64(child.GetSize()), CLUSTER_SIZE) / CLUSTER_SIZE;
+      else
+        self(self, child);
+    }
+  };
+  add_usage(add_usage, *entry);
+  return stats;
+}
+
+void MemoryFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
+{
+  if (!nand_redirects.empty())
+    WARN_LOG_FMT(IOS_FS, "NAND redirects are not supported by the in-memory NAND, ignoring them");
+}
+}  // namespace IOS::HLE::FS
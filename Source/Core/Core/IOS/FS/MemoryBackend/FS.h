@@ -0,0 +1,150 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Core/IOS/FS/FileSystem.h"
+
+namespace IOS::HLE::FS
+{
+class HostFileSystem;
+
+/// NAND contents that are kept in memory.
+///
+/// One instance is shared by all the MemoryFileSystems of an emulation session,
+/// so that the contents survive IOS reloads.
+class MemoryNand final
+{
+public:
+  /// Uses the NAND in the host directory base_path (which may be empty or missing) as the
+  /// initial contents. The base is never written to: files are only read from it when they
+  /// are first needed, and all changes stay in memory.
+  explicit MemoryNand(std::string base_path = {});
+
+  /// Uses the directory nand_path of the NAND in the host directory base_path as the contents of
+  /// that directory, replacing what is there. Missing parent directories are created. Like for the
+  /// base of the whole NAND, files are only read when they are first needed.
+  /// Everything that is added is owned by the given uid and gid.
+  bool AddBaseDirectory(std::string base_path, const std::string& nand_path, Uid uid, Gid gid);
+
+  /// Writes the NAND to a host directory, replacing its contents.
+  /// The result can be used with HostFileSystem. Nothing is written if the directory is
+  /// neither empty nor a NAND.
+  bool Flush(std::string host_path);
+
+private:
+  friend class MemoryFileSystem;
+
+  struct Entry
+  {
+    bool CheckPermission(Uid uid, Gid gid, Mode requested_mode) const;
+    u32 GetSize() const;
+
+    std::string name;
+    Metadata data{};
+    /// Contents of a file. Shared with all handles that have the file opened, so that
+    /// writes are seen by all of them immediately, like on the Wii.
+    /// Null while the file has not been loaded from the base NAND yet.
+    std::shared_ptr<std::vector<u8>> contents;
+    /// Host path of the file in the base NAND, while it has not been loaded yet.
+    std::string base_path;
+    /// Digest of the file in the base NAND, if known. Files that were restored from a
+    /// savestate use the NAND snapshot store as their base.
+    std::optional<Common::SHA1::Digest> base_digest;
+    /// Children of this entry in creation order. Only valid for directories.
+    std::vector<Entry> children;
+  };
+
+  /// Adds the children of the directory path in a base NAND to entry.
+  static void AddBaseEntries(HostFileSystem& base, const std::string& base_path,
+                             const std::string& path, Entry* entry);
+
+  /// Loads the contents of a file from the base NAND if necessary.
+  static bool LoadContents(Entry* entry);
+
+  Entry m_root{};
+};
+
+/// Backend that keeps the whole NAND in memory, for temporary NANDs that are
+/// thrown away at the end of the session anyway.
+class MemoryFileSystem final : public FileSystem
+{
+public:
+  explicit MemoryFileSystem(std::shared_ptr<MemoryNand> nand);
+  ~MemoryFileSystem();
+
+  void DoState(PointerWrap& p) override;
+
+  ResultCode Format(Uid uid) override;
+
+  Result<FileHandle> OpenFile(Uid uid, Gid gid, const std::string& path, Mode mode) override;
+  ResultCode Close(Fd fd) override;
+  Result<u32> ReadBytesFromFile(Fd fd, u8* ptr, u32 size) override;
+  Result<u32> WriteBytesToFile(Fd fd, const u8* ptr, u32 size) override;
+  Result<u32> SeekFile(Fd fd, u32 offset, SeekMode mode) override;
+  Result<FileStatus> GetFileStatus(Fd fd) override;
+
+  ResultCode CreateFile(Uid caller_uid, Gid caller_gid, const std::string& path,
+                        FileAttribute attribute, Modes modes) override;
+
+  ResultCode CreateDirectory(Uid caller_uid, Gid caller_gid, const std::string& path,
+                             FileAttribute attribute, Modes modes) override;
+
+  ResultCode Delete(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode Rename(Uid caller_uid, Gid caller_gid, const std::string& old_path,
+                    const std::string& new_path) override;
+
+  Result<std::vector<std::string>> ReadDirectory(Uid caller_uid, Gid caller_gid,
+                                                 const std::string& path) override;
+
+  Result<Metadata> GetMetadata(Uid caller_uid, Gid caller_gid, const std::string& path) override;
+  ResultCode SetMetadata(Uid caller_uid, const std::string& path, Uid uid, Gid gid,
+                         FileAttribute attribute, Modes modes) override;
+
+  Result<NandStats> GetNandStats() override;
+  Result<DirectoryStats> GetDirectoryStats(const std::string& path) override;
+  Result<ExtendedDirectoryStats> GetExtendedDirectoryStats(const std::string& path) override;
+
+  void SetNandRedirects(std::vector<NandRedirect> nand_redirects) override;
+
+private:
+  using Entry = MemoryNand::Entry;
+
+  struct Handle
+  {
+    bool opened = false;
+    Mode mode = Mode::None;
+    std::string wii_path;
+    std::shared_ptr<std::vector<u8>> contents;
+    u32 file_offset = 0;
+  };
+  Handle* AssignFreeHandle();
+  Handle* GetHandleFromFd(Fd fd);
+  Fd ConvertHandleToFd(const Handle* handle) const;
+
+  /// Returns nullptr if the path is invalid or the file does not exist.
+  Entry* GetEntryForPath(const std::string& path);
+
+  ResultCode CreateFileOrDirectory(Uid uid, Gid gid, const std::string& path,
+                                   FileAttribute attribute, Modes modes, bool is_file);
+  bool IsFileOpened(const std::string& path) const;
+  bool IsDirectoryInUse(const std::string& path) const;
+
+  void DoStateEntry(PointerWrap& p, Entry* entry);
+  /// Like DoStateEntry, but only the digests of files are savestated. The contents are kept
+  /// in the NAND snapshot store, like for HostFileSystem.
+  bool DoSnapshotEntry(PointerWrap& p, Entry* entry);
+
+  std::shared_ptr<MemoryNand> m_nand;
+  std::array<Handle, 16> m_handles{};
+};
+
+}  // namespace IOS::HLE::FS
@@ -0,0 +1,101 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/IOS/FS/SnapshotStore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/StringUtil.h"
+
+namespace IOS::HLE::FS
+{
+std::string GetSnapshotBlobPath(const Common::SHA1::Digest& digest)
+{
+  return File::GetUserPath(D_STATESAVES_IDX) + "NAND/" + Common::BytesToHexString(digest);
+}
+
+namespace
+{
+// Mark the blob as still in use, so that PruneSnapshotBlobs keeps it around. This is also needed
+// for new blobs, as copying a file can keep its modification time.
+bool MarkSnapshotBlobUsed(const std::string& blob_path)
+{
+  std::error_code error;
+  std::filesystem::last_write_time(StringToPath(blob_path),
+                                   std::filesystem::file_time_type::clock::now(), error);
+  return !error;
+}
+}  // namespace
+
+bool StoreSnapshotBlob(const std::string& host_path, const Common::SHA1::Digest& digest)
+{
+  const std::string blob_path = GetSnapshotBlobPath(digest);
+  if (!File::Exists(blob_path))
+  {
+    // Blobs are only ever looked up by their hash, so make sure that they are never incomplete.
+    const std::string temp_path = blob_path + ".tmp";
+    if (!File::CopyRegularFile(host_path, temp_path) || !File::Rename(temp_path, blob_path))
+      return false;
+  }
+  return MarkSnapshotBlobUsed(blob_path);
+}
+
+bool StoreSnapshotBlob(const std::vector<u8>& contents, const Common::SHA1::Digest& digest)
+{
+  const std::string blob_path = GetSnapshotBlobPath(digest);
+  if (!File::Exists(blob_path))
+  {
+    const std::string temp_path = blob_path + ".tmp";
+    File::IOFile file(temp_path, "wb");
+    if (!file.WriteBytes(contents.data(), contents.size()) || !file.Close() ||
+        !File::Rename(temp_path, blob_path))
+    {
+      return false;
+    }
+  }
+  return MarkSnapshotBlobUsed(blob_path);
+}
+
+// Blobs are shared between savestates, so there is no single point at which one stops being used.
+// Instead, every savestate marks the blobs it references as used, and blobs that have not been
+// used since well before the oldest file in the savestate directory are removed, along with any
+// temporary files left behind by an interrupted copy. Savestates kept elsewhere may lose their
+// blobs; loading them then fails before anything in the NAND is modified.
+void PruneSnapshotBlobs()
+{
+  // Generously covers the time between a savestate marking its blobs and its file being written.
+  constexpr auto GRACE_PERIOD = std::chrono::hours(1);
+
+  const std::string states_path = File::GetUserPath(D_STATESAVES_IDX);
+  std::error_code error;
+
+  auto cutoff = std::filesystem::file_time_type::clock::now();
+  for (const File::FSTEntry& entry : File::ScanDirectoryTree(states_path, false).children)
+  {
+    if (entry.isDirectory)
+      continue;
+    const auto time = std::filesystem::last_write_time(StringToPath(entry.physicalName), error);
+    if (!error)
+      cutoff = std::min(cutoff, time);
+  }
+  cutoff -= GRACE_PERIOD;
+
+  for (const File::FSTEntry& entry : File::ScanDirectoryTree(states_path + "NAND", false).children)
+  {
+    if (entry.isDirectory)
+      continue;
+    const auto time = std::filesystem::last_write_time(StringToPath(entry.physicalName), error);
+    if (!error && time < cutoff)
+    {
+      INFO_LOG_FMT(IOS_FS, "Removing unused NAND snapshot blob {}", entry.physicalName);
+      File::Delete(entry.physicalName);
+    }
+  }
+}
+}  // namespace IOS::HLE::FS
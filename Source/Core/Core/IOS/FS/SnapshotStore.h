@@ -0,0 +1,28 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+
+namespace IOS::HLE::FS
+{
+// Savestates made during a movie don't contain the NAND files themselves, but their SHA-1 digests.
+// The contents are kept in the NAND snapshot store in the savestate directory, where every blob is
+// named after its digest, so files that don't change between savestates are only stored once.
+
+std::string GetSnapshotBlobPath(const Common::SHA1::Digest& digest);
+
+// Stores a copy of the file at host_path (whose contents have the given digest) in the store,
+// and marks the blob as used by the savestate that is being made.
+bool StoreSnapshotBlob(const std::string& host_path, const Common::SHA1::Digest& digest);
+// Same, for contents that are in memory.
+bool StoreSnapshotBlob(const std::vector<u8>& contents, const Common::SHA1::Digest& digest);
+
+// Removes the blobs that no savestate has used for a while.
+void PruneSnapshotBlobs();
+}  // namespace IOS::HLE::FS
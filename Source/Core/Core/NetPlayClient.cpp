@@ -1041,6 +1041,7 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
 {
   packet >> m_sync_save_data_count;
   m_sync_save_data_success_count = 0;
+  m_sync_data_reader.BeginSync();
 
   INFO_LOG_FMT(NETPLAY, "Initializing wait for {} savegame chunks.", m_sync_save_data_count);
 
@@ -1084,7 +1085,7 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = m_sync_data_reader.DecompressPacketIntoFile(packet, path);
   SyncSaveDataResponse(success);
 }
 
@@ -1116,7 +1117,7 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
     INFO_LOG_FMT(NETPLAY, "Received GCI: {}", file_name);
 
     if (!Common::IsFileNameSafe(file_name) ||
-        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name))
+        !m_sync_data_reader.DecompressPacketIntoFile(packet, path + DIR_SEP + file_name))
     {
       WARN_LOG_FMT(NETPLAY, "Received invalid GCI.");
       SyncSaveDataResponse(false);
@@ -1161,7 +1162,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
   {
     INFO_LOG_FMT(NETPLAY, "Received Mii data.");
 
-    auto buffer = DecompressPacketIntoBuffer(packet);
+    auto buffer = m_sync_data_reader.DecompressPacketIntoBuffer(packet);
 
     temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, "/shared2/menu/FaceLib/", 0,
                             fs_modes);
@@ -1240,7 +1241,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
 
       if (file.type == WiiSave::Storage::SaveFile::Type::File)
       {
-        auto buffer = DecompressPacketIntoBuffer(packet);
+        auto buffer = m_sync_data_reader.DecompressPacketIntoBuffer(packet);
         if (!buffer)
         {
           SyncSaveDataResponse(false);
@@ -1266,7 +1267,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
   if (has_redirected_save)
   {
     INFO_LOG_FMT(NETPLAY, "Received redirected save.");
-    if (!DecompressPacketIntoFolder(packet, redirect_path))
+    if (!m_sync_data_reader.DecompressPacketIntoFolder(packet, redirect_path))
     {
       PanicAlertFmtT("Failed to write redirected save.");
       SyncSaveDataResponse(false);
@@ -1295,7 +1296,7 @@ void NetPlayClient::OnSyncSaveDataGBA(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = m_sync_data_reader.DecompressPacketIntoFile(packet, path);
   SyncSaveDataResponse(success);
 }
 
@@ -1826,6 +1827,8 @@ void NetPlayClient::SyncSaveDataResponse(const bool success)
   {
     if (++m_sync_save_data_success_count >= m_sync_save_data_count)
     {
+      m_sync_data_reader.EndSync();
+
       sf::Packet response_packet;
       response_packet << MessageID::SyncSaveData;
       response_packet << SyncSaveDataID::Success;
@@ -4,90 +4,131 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include <fmt/format.h>
-#include <lzo/lzo1x.h>
+#include <xxhash.h>
+#include <zstd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
+#include "Common/ThreadPool.h"
+
+// The contents of a file are written as:
+//   u64 size. Nothing else follows if the size is 0.
+//   u64 low and u64 high half of the XXH3 128-bit hash of the contents.
+//   bool whether the contents follow. If not, the receiver already has them.
+//   For every CHUNK_SIZE bytes of the contents, a u32 size followed by that many bytes of
+//   zstd frame. This is the same layout as a string, so SFML can read it in one go.
 
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+constexpr u32 CHUNK_SIZE = 128 * 1024;
+// Players are usually connected by a fast link, so compression speed matters more than ratio.
+constexpr int COMPRESSION_LEVEL = 1;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+static Common::ThreadPool& GetThreadPool()
 {
-  File::IOFile file(file_path, "rb");
-  if (!file)
-  {
-    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
-    return false;
-  }
+  static Common::ThreadPool pool(
+      "NetPlay Sync", std::max<unsigned int>(1, std::thread::hardware_concurrency()) - 1);
+  return pool;
+}
 
-  const sf::Uint64 size = file.GetSize();
-  packet << size;
+static SyncDataHash GetHash(const u8* data, size_t size)
+{
+  const XXH128_hash_t hash = XXH3_128bits(data, size);
+  return {hash.low64, hash.high64};
+}
+
+static u64 GetChunkCount(u64 size)
+{
+  return size / CHUNK_SIZE + (size % CHUNK_SIZE != 0);
+}
+
+SyncDataWriter::SyncDataWriter(std::set<SyncDataHash> receiver_hashes)
+    : m_receiver_hashes(std::move(receiver_hashes))
+{
+}
+
+bool SyncDataWriter::CompressIntoPacket(const u8* data, size_t size, sf::Packet& packet)
+{
+  packet << sf::Uint64{size};
 
   if (size == 0)
     return true;
 
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  const SyncDataHash hash = GetHash(data, size);
+  packet << sf::Uint64{hash.first} << sf::Uint64{hash.second};
 
-  lzo_uint i = 0;
-  while (true)
+  // Contents that appear more than once in a sync are only sent the first time
+  const bool is_new = m_written_hashes.insert(hash).second;
+  const bool receiver_has_contents = !is_new || m_receiver_hashes.contains(hash);
+  packet << !receiver_has_contents;
+
+  if (receiver_has_contents)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
+    m_skipped_bytes += size;
+    return true;
+  }
 
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
+  const u32 chunk_count = static_cast<u32>(GetChunkCount(size));
+  std::vector<std::vector<u8>> chunks(chunk_count);
+  std::atomic<bool> success = true;
 
-    if (cur_len <= 0)
-      break;  // EOF
+  GetThreadPool().ParallelFor(chunk_count, [&](u32 i) {
+    const size_t offset = static_cast<size_t>(i) * CHUNK_SIZE;
+    const size_t chunk_size = std::min<size_t>(CHUNK_SIZE, size - offset);
 
-    if (!file.ReadBytes(in_buffer.data(), cur_len))
-    {
-      PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
-      return false;
-    }
+    std::vector<u8>& chunk = chunks[i];
+    chunk.resize(ZSTD_compressBound(chunk_size));
+    const size_t compressed_size = ZSTD_compress(chunk.data(), chunk.size(), data + offset,
+                                                 chunk_size, COMPRESSION_LEVEL);
+    if (ZSTD_isError(compressed_size))
+      success.store(false, std::memory_order_relaxed);
+    else
+      chunk.resize(compressed_size);
+  });
 
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
+  if (!success)
+  {
+    PanicAlertFmtT("Internal zstd error - compression failed");
+    return false;
+  }
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+  for (const std::vector<u8>& chunk : chunks)
+  {
+    packet << static_cast<u32>(chunk.size());
+    packet.append(chunk.data(), chunk.size());
+  }
 
-    if (cur_len != LZO_IN_LEN)
-      break;
+  return true;
+}
 
-    i += cur_len;
+bool SyncDataWriter::CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+{
+  File::IOFile file(file_path, "rb");
+  if (!file)
+  {
+    PanicAlertFmtT("Failed to open file \"{0}\".", file_path);
+    return false;
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
+  std::vector<u8> contents(file.GetSize());
+  if (!file.ReadBytes(contents.data(), contents.size()))
+  {
+    PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
+    return false;
+  }
 
-  return true;
+  return CompressIntoPacket(contents.data(), contents.size(), packet);
 }
 
-static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
+static bool CompressFolderIntoPacketInternal(SyncDataWriter& writer, const File::FSTEntry& folder,
+                                             sf::Packet& packet)
 {
   const sf::Uint64 size = folder.children.size();
   packet << size;
@@ -96,15 +137,15 @@ static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::P
     const bool is_folder = child.isDirectory;
     packet << child.virtualName;
     packet << is_folder;
-    const bool success = is_folder ? CompressFolderIntoPacketInternal(child, packet) :
-                                     CompressFileIntoPacket(child.physicalName, packet);
+    const bool success = is_folder ? CompressFolderIntoPacketInternal(writer, child, packet) :
+                                     writer.CompressFileIntoPacket(child.physicalName, packet);
     if (!success)
       return false;
   }
   return true;
 }
 
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet)
+bool SyncDataWriter::CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet)
 {
   if (!File::IsDirectory(folder_path))
   {
@@ -113,69 +154,137 @@ bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet
   }
 
   packet << true;
-  return CompressFolderIntoPacketInternal(File::ScanDirectoryTree(folder_path, true), packet);
+  return CompressFolderIntoPacketInternal(*this, File::ScanDirectoryTree(folder_path, true),
+                                          packet);
 }
 
-bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
+bool SyncDataWriter::CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
 {
-  const sf::Uint64 size = in_buffer.size();
-  packet << size;
+  return CompressIntoPacket(in_buffer.data(), in_buffer.size(), packet);
+}
 
-  if (size == 0)
-    return true;
+void ClientSyncedData::SetPendingHashes(std::set<SyncDataHash> hashes)
+{
+  m_pending_hashes = std::move(hashes);
+}
+
+void ClientSyncedData::DiscardPendingHashes()
+{
+  m_pending_hashes.clear();
+}
 
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+void ClientSyncedData::OnSyncSucceeded()
+{
+  m_hashes = std::move(m_pending_hashes);
+  m_pending_hashes.clear();
+}
 
-  lzo_uint i = 0;
-  while (true)
+void ClientSyncedData::OnSyncFailed()
+{
+  m_hashes.clear();
+  m_pending_hashes.clear();
+}
+
+std::set<SyncDataHash> GetCommonSyncedData(const std::vector<const ClientSyncedData*>& clients)
+{
+  if (clients.empty())
+    return {};
+
+  std::set<SyncDataHash> hashes = clients.front()->GetHashes();
+  for (const ClientSyncedData* client : clients)
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
+    std::erase_if(hashes, [client](const SyncDataHash& hash) {
+      return !client->GetHashes().contains(hash);
+    });
+  }
+  return hashes;
+}
 
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
+void SyncDataReader::BeginSync()
+{
+  m_contents.clear();
+}
+
+void SyncDataReader::EndSync()
+{
+  m_completed_contents = std::move(m_contents);
+  m_contents.clear();
+}
 
-    if (cur_len <= 0)
-      break;  // end of buffer
+SyncDataReader::Contents SyncDataReader::DecompressFromPacket(sf::Packet& packet)
+{
+  const u64 size = Common::PacketReadU64(packet);
+
+  if (size == 0)
+    return std::make_shared<const std::vector<u8>>();
+
+  SyncDataHash hash;
+  hash.first = Common::PacketReadU64(packet);
+  hash.second = Common::PacketReadU64(packet);
 
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
+  bool has_contents = false;
+  packet >> has_contents;
+  if (!packet)
+    return nullptr;
+
+  if (!has_contents)
+  {
+    auto it = m_contents.find(hash);
+    if (it == m_contents.end())
     {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
+      it = m_completed_contents.find(hash);
+      if (it == m_completed_contents.end() || it->second->size() != size)
+      {
+        ERROR_LOG_FMT(NETPLAY, "Received a reference to data that is not available.");
+        return nullptr;
+      }
+      m_contents.emplace(hash, it->second);
     }
+    return it->second;
+  }
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
+  // Read all chunks before allocating anything based on the size, which could be bogus
+  const u64 chunk_count = GetChunkCount(size);
+  std::vector<std::string> chunks;
+  while (chunks.size() < chunk_count)
+  {
+    packet >> chunks.emplace_back();
+    if (!packet)
+      return nullptr;
+  }
+
+  auto contents = std::make_shared<std::vector<u8>>(size);
+  std::atomic<bool> success = true;
+
+  GetThreadPool().ParallelFor(static_cast<u32>(chunk_count), [&](u32 i) {
+    const size_t offset = static_cast<size_t>(i) * CHUNK_SIZE;
+    const size_t chunk_size = std::min<size_t>(CHUNK_SIZE, size - offset);
+
+    const std::string& chunk = chunks[i];
+    if (ZSTD_decompress(contents->data() + offset, chunk_size, chunk.data(), chunk.size()) !=
+        chunk_size)
     {
-      packet << out_buffer[j];
+      success.store(false, std::memory_order_relaxed);
     }
+  });
 
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
+  if (!success || GetHash(contents->data(), contents->size()) != hash)
+  {
+    PanicAlertFmtT("Internal zstd error - decompression failed");
+    return nullptr;
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
-
-  return true;
+  m_contents.insert_or_assign(hash, contents);
+  return contents;
 }
 
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
+bool SyncDataReader::DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
 {
-  u64 file_size = Common::PacketReadU64(packet);
+  const Contents contents = DecompressFromPacket(packet);
+  if (!contents)
+    return false;
 
-  if (file_size == 0)
+  if (contents->empty())
     return true;
 
   File::IOFile file(file_path, "wb");
@@ -185,41 +294,17 @@ bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
     return false;
   }
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
-
-  while (true)
+  if (!file.WriteBytes(contents->data(), contents->size()))
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
-
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return false;
-    }
-
-    if (!file.WriteBytes(out_buffer.data(), new_len))
-    {
-      PanicAlertFmtT("Error writing file: {0}", file_path);
-      return false;
-    }
+    PanicAlertFmtT("Error writing file: {0}", file_path);
+    return false;
   }
 
   return true;
 }
 
-static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::string& folder_path)
+static bool DecompressPacketIntoFolderInternal(SyncDataReader& reader, sf::Packet& packet,
+                                               const std::string& folder_path)
 {
   if (!File::CreateFullPath(folder_path + "/"))
     return false;
@@ -243,58 +328,28 @@ static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::st
     bool is_folder;
     packet >> is_folder;
     std::string path = fmt::format("{}/{}", folder_path, name);
-    const bool success = is_folder ? DecompressPacketIntoFolderInternal(packet, path) :
-                                     DecompressPacketIntoFile(packet, path);
+    const bool success = is_folder ? DecompressPacketIntoFolderInternal(reader, packet, path) :
+                                     reader.DecompressPacketIntoFile(packet, path);
     if (!success)
       return false;
   }
   return true;
 }
 
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path)
+bool SyncDataReader::DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path)
 {
   bool folder_existed;
   packet >> folder_existed;
   if (!folder_existed)
     return true;
-  return DecompressPacketIntoFolderInternal(packet, folder_path);
+  return DecompressPacketIntoFolderInternal(*this, packet, folder_path);
 }
 
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
+std::optional<std::vector<u8>> SyncDataReader::DecompressPacketIntoBuffer(sf::Packet& packet)
 {
-  u64 size = Common::PacketReadU64(packet);
-
-  std::vector<u8> out_buffer(size);
-
-  if (size == 0)
-    return out_buffer;
-
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-
-  lzo_uint i = 0;
-  while (true)
-  {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
-
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return {};
-    }
-
-    i += new_len;
-  }
-
-  return out_buffer;
+  const Contents contents = DecompressFromPacket(packet);
+  if (!contents)
+    return std::nullopt;
+  return *contents;
 }
 }  // namespace NetPlay
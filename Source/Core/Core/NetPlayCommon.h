@@ -7,8 +7,12 @@
 
 #include <array>
 #include <chrono>
+#include <map>
+#include <memory>
 #include <optional>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -20,10 +24,79 @@ using namespace std::chrono_literals;
 // connection is disconnected
 constexpr std::chrono::milliseconds PEER_TIMEOUT = 30s;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
-bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+// Identifies the contents of a synced file. 128-bit content hashes are trusted to not collide.
+using SyncDataHash = std::pair<u64, u64>;
+
+// Writes file contents for data sync into packets. Contents are zstd compressed in chunks on
+// multiple threads, and contents the receivers already have are only sent as a hash.
+class SyncDataWriter
+{
+public:
+  SyncDataWriter() = default;
+  // receiver_hashes are the contents every receiver has kept from its last completed data sync.
+  explicit SyncDataWriter(std::set<SyncDataHash> receiver_hashes);
+
+  bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
+  bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
+  bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
+
+  // The contents written so far. The receivers have all of them once they've read the packets.
+  const std::set<SyncDataHash>& GetWrittenHashes() const { return m_written_hashes; }
+  u64 GetSkippedBytes() const { return m_skipped_bytes; }
+
+private:
+  bool CompressIntoPacket(const u8* data, size_t size, sf::Packet& packet);
+
+  std::set<SyncDataHash> m_receiver_hashes;
+  std::set<SyncDataHash> m_written_hashes;
+  u64 m_skipped_bytes = 0;
+};
+
+// What the server knows about the contents a client has kept from data syncs.
+class ClientSyncedData
+{
+public:
+  // The contents the client has kept from its last completed sync.
+  const std::set<SyncDataHash>& GetHashes() const { return m_hashes; }
+
+  // Records the contents of a sync that is about to be sent to the client.
+  void SetPendingHashes(std::set<SyncDataHash> hashes);
+  // The sync won't be completed, e.g. because it was aborted.
+  void DiscardPendingHashes();
+  // The client has received and processed all data of the sync.
+  void OnSyncSucceeded();
+  // The client failed to process the data of the sync.
+  void OnSyncFailed();
+
+private:
+  std::set<SyncDataHash> m_hashes;
+  std::set<SyncDataHash> m_pending_hashes;
+};
+
+// The contents that all of the given clients have kept.
+std::set<SyncDataHash> GetCommonSyncedData(const std::vector<const ClientSyncedData*>& clients);
+
+// Reads file contents written by SyncDataWriter. Keeps the contents of the last completed data
+// sync, since the writer may refer to them instead of sending them again.
+class SyncDataReader
+{
+public:
+  // Starts a new data sync.
+  void BeginSync();
+  // Completes the data sync. Its contents replace the ones of the last completed sync.
+  void EndSync();
+
+  bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
+  bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
+  std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+
+private:
+  using Contents = std::shared_ptr<const std::vector<u8>>;
+
+  // Returns nullptr on failure
+  Contents DecompressFromPacket(sf::Packet& packet);
+
+  std::map<SyncDataHash, Contents> m_completed_contents;
+  std::map<SyncDataHash, Contents> m_contents;
+};
 }  // namespace NetPlay
@@ -1142,6 +1142,11 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     {
     case SyncSaveDataID::Success:
     {
+      {
+        std::lock_guard lkp(m_crit.players);
+        player.synced_data.OnSyncSucceeded();
+      }
+
       if (m_start_pending)
       {
         m_save_data_synced_players++;
@@ -1170,6 +1175,11 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
 
     case SyncSaveDataID::Failure:
     {
+      {
+        std::lock_guard lkp(m_crit.players);
+        player.synced_data.OnSyncFailed();
+      }
+
       m_dialog->AppendChat(Common::FmtFormatT("{0} failed to synchronize.", player.name));
       m_dialog->OnGameStartAborted();
       ChunkedDataAbort();
@@ -1798,6 +1808,20 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
 
   m_save_data_synced_players = 0;
 
+  // Contents that every client has kept from the previous sync don't need to be sent again
+  SyncDataWriter writer;
+  {
+    std::lock_guard lkp(m_crit.players);
+    std::vector<const ClientSyncedData*> clients;
+    for (auto& [pid, player] : m_players)
+    {
+      player.synced_data.DiscardPendingHashes();
+      if (!player.IsHost())
+        clients.push_back(&player.synced_data);
+    }
+    writer = SyncDataWriter(GetCommonSyncedData(clients));
+  }
+
   {
     sf::Packet pac;
     pac << MessageID::SyncSaveData;
@@ -1811,6 +1835,8 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
   if (sync_info.save_count == 0)
     return true;
 
+  std::vector<std::pair<sf::Packet, std::string>> packets;
+
   const auto game_region = sync_info.game->GetRegion();
   const auto gamecube_region = Config::ToGameCubeRegion(game_region);
   const std::string region = Config::GetDirectoryForRegion(gamecube_region);
@@ -1837,7 +1863,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of raw memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
-        if (!CompressFileIntoPacket(path, pac))
+        if (!writer.CompressFileIntoPacket(path, pac))
           return false;
       }
       else
@@ -1848,7 +1874,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << sf::Uint64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
+      packets.emplace_back(std::move(pac),
                            fmt::format("Memory Card {} Synchronization", is_slot_a ? 'A' : 'B'));
     }
     else if (Config::Get(Config::GetInfoForEXIDevice(slot)) ==
@@ -1876,7 +1902,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           const std::string filename = file.substr(file.find_last_of('/') + 1);
           INFO_LOG_FMT(NETPLAY, "Sending GCI {}.", filename);
           pac << filename;
-          if (!CompressFileIntoPacket(file, pac))
+          if (!writer.CompressFileIntoPacket(file, pac))
             return false;
         }
       }
@@ -1888,7 +1914,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << static_cast<u8>(0);
       }
 
-      SendChunkedToClients(std::move(pac), 1,
+      packets.emplace_back(std::move(pac),
                            fmt::format("GCI Folder {} Synchronization", is_slot_a ? 'A' : 'B'));
     }
   }
@@ -1904,7 +1930,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
     {
       INFO_LOG_FMT(NETPLAY, "Sending Mii data.");
       pac << true;
-      if (!CompressBufferIntoPacket(*sync_info.mii_data, pac))
+      if (!writer.CompressBufferIntoPacket(*sync_info.mii_data, pac))
         return false;
     }
     else
@@ -1965,7 +1991,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           if (file.type == WiiSave::Storage::SaveFile::Type::File)
           {
             const std::optional<std::vector<u8>>& data = *file.data;
-            if (!data || !CompressBufferIntoPacket(*data, pac))
+            if (!data || !writer.CompressBufferIntoPacket(*data, pac))
               return false;
           }
         }
@@ -1982,7 +2008,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       INFO_LOG_FMT(NETPLAY, "Sending redirected save at {}.",
                    sync_info.redirected_save->m_target_path);
       pac << true;
-      if (!CompressFolderIntoPacket(sync_info.redirected_save->m_target_path, pac))
+      if (!writer.CompressFolderIntoPacket(sync_info.redirected_save->m_target_path, pac))
         return false;
     }
     else
@@ -1991,7 +2017,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       pac << false;  // no redirected save
     }
 
-    SendChunkedToClients(std::move(pac), 1, "Wii Save Synchronization");
+    packets.emplace_back(std::move(pac), "Wii Save Synchronization");
   }
 
   for (size_t i = 0; i < m_gba_config.size(); ++i)
@@ -2011,7 +2037,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       if (File::Exists(path))
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of GBA save at {} for slot {}.", path, i);
-        if (!CompressFileIntoPacket(path, pac))
+        if (!writer.CompressFileIntoPacket(path, pac))
           return false;
       }
       else
@@ -2021,11 +2047,24 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
         pac << sf::Uint64{0};
       }
 
-      SendChunkedToClients(std::move(pac), 1,
-                           fmt::format("GBA{} Save File Synchronization", i + 1));
+      packets.emplace_back(std::move(pac), fmt::format("GBA{} Save File Synchronization", i + 1));
     }
   }
 
+  INFO_LOG_FMT(NETPLAY, "Skipped {} bytes of save data that all clients already have.",
+               writer.GetSkippedBytes());
+
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (auto& [pid, player] : m_players)
+      player.synced_data.SetPendingHashes(writer.GetWrittenHashes());
+  }
+
+  // Only send the data once the server knows what the clients will have after receiving it, since
+  // they acknowledge it right away
+  for (auto& [pac, title] : packets)
+    SendChunkedToClients(std::move(pac), 1, title);
+
   return true;
 }
 
@@ -2493,6 +2532,13 @@ void NetPlayServer::ChunkedDataSend(sf::Packet&& packet, const PlayerId pid,
 
 void NetPlayServer::ChunkedDataAbort()
 {
+  // The clients won't get the rest of the data, so a late acknowledgement doesn't mean they have it
+  {
+    std::lock_guard lkp(m_crit.players);
+    for (auto& [pid, player] : m_players)
+      player.synced_data.DiscardPendingHashes();
+  }
+
   m_abort_chunked_data = true;
   m_chunked_data_event.Set();
   m_chunked_data_complete_event.Set();
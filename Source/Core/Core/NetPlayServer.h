@@ -21,6 +21,7 @@
 #include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -93,6 +94,9 @@ private:
     u32 ping = 0;
     u32 current_game = 0;
 
+    // Guarded by m_crit.players
+    ClientSyncedData synced_data;
+
     Common::QoSSession qos_session;
 
     bool operator==(const Client& other) const { return this == &other; }
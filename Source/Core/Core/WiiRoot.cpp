@@ -18,11 +18,13 @@
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/CommonTitles.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Config/SessionSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/WiiSave.h"
 #include "Core/IOS/ES/ES.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/MemoryBackend/FS.h"
 #include "Core/IOS/IOS.h"
 #include "Core/IOS/Uids.h"
 #include "Core/Movie.h"
@@ -37,6 +39,7 @@ static std::string s_temp_wii_root;
 static std::string s_temp_redirect_root;
 static bool s_wii_root_initialized = false;
 static std::vector<IOS::HLE::FS::NandRedirect> s_nand_redirects;
+static std::shared_ptr<FS::MemoryNand> s_memory_nand;
 
 // When Temp NAND + Redirects are both active, we need to keep track of where each redirect path
 // should be copied back to after a successful session finish.
@@ -52,6 +55,11 @@ const std::vector<IOS::HLE::FS::NandRedirect>& GetActiveNandRedirects()
   return s_nand_redirects;
 }
 
+std::shared_ptr<FS::MemoryNand> GetSessionMemoryNand()
+{
+  return s_memory_nand;
+}
+
 static bool CopyBackupFile(const std::string& path_from, const std::string& path_to)
 {
   if (!File::Exists(path_from))
@@ -95,6 +103,40 @@ static void CopySave(FS::FileSystem* source, FS::FileSystem* dest, const u64 tit
   WiiSave::Copy(source_save.get(), dest_save.get());
 }
 
+// Uses the save in the configured NAND as the base of the save in the in-memory NAND, so that its
+// files are only read when they are needed. The result is the same as with CopySave.
+static bool AddSaveFromConfiguredNand(FS::FileSystem* configured_fs, FS::FileSystem* session_fs,
+                                      const u64 title_id)
+{
+  const std::string data_path = Common::GetTitleDataPath(title_id);
+  const std::string banner_path = data_path + "/banner.bin";
+  // WiiSave::Copy doesn't copy saves without a banner.
+  if (!configured_fs->GetMetadata(IOS::PID_KERNEL, IOS::PID_KERNEL, banner_path))
+    return false;
+
+  session_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, data_path + '/', 0,
+                             {FS::Mode::ReadWrite, FS::Mode::ReadWrite, FS::Mode::ReadWrite});
+  const auto metadata = session_fs->GetMetadata(IOS::PID_KERNEL, IOS::PID_KERNEL, data_path);
+  if (!metadata || !s_memory_nand->AddBaseDirectory(File::GetUserPath(D_WIIROOT_IDX), data_path,
+                                                    metadata->uid, metadata->gid))
+  {
+    return false;
+  }
+
+  // WiiSave::Copy also removes the nocopy flag from the banner.
+  constexpr u32 BANNER_FLAGS_OFFSET = 7;
+  const auto banner =
+      session_fs->OpenFile(IOS::PID_KERNEL, IOS::PID_KERNEL, banner_path, FS::Mode::ReadWrite);
+  u8 flags = 0;
+  if (!banner || !banner->Seek(BANNER_FLAGS_OFFSET, FS::SeekMode::Set) ||
+      !banner->Read(&flags, 1))
+  {
+    return false;
+  }
+  flags &= ~1;
+  return banner->Seek(BANNER_FLAGS_OFFSET, FS::SeekMode::Set) && banner->Write(&flags, 1);
+}
+
 static bool CopyNandFile(FS::FileSystem* source_fs, const std::string& source_file,
                          FS::FileSystem* dest_fs, const std::string& dest_file)
 {
@@ -157,7 +199,11 @@ static void InitializeDeterministicWiiSaves(FS::FileSystem* session_fs,
     if (Movie::IsMovieActive() && !NetPlay::IsNetPlayRunning())
     {
       INFO_LOG_FMT(CORE, "Wii Save Init: Copying {0:016x}.", title_id);
-      CopySave(source_fs, session_fs, title_id);
+      if (sync_fs || !s_memory_nand ||
+          !AddSaveFromConfiguredNand(configured_fs.get(), session_fs, title_id))
+      {
+        CopySave(source_fs, session_fs, title_id);
+      }
     }
     else
     {
@@ -218,6 +264,17 @@ void InitializeWiiRoot(bool use_temporary)
     MoveToBackupIfExists(s_temp_redirect_root);
 
     File::SetUserPath(D_SESSION_WIIROOT_IDX, s_temp_wii_root);
+
+    if (Config::Get(Config::MAIN_WII_SESSION_NAND_IN_MEMORY))
+    {
+      WARN_LOG_FMT(IOS_FS, "Keeping the temporary NAND in memory");
+      // The directory is still used for the files that are not part of the NAND,
+      // like the emulated Wii Remote EEPROMs.
+      File::CreateFullPath(s_temp_wii_root);
+      // The temporary NAND starts out empty. Saves that are copied from the configured NAND
+      // use it as their base (see AddSaveFromConfiguredNand).
+      s_memory_nand = std::make_shared<FS::MemoryNand>();
+    }
   }
   else
   {
@@ -232,6 +289,14 @@ void ShutdownWiiRoot()
 {
   if (WiiRootIsTemporary())
   {
+    if (s_memory_nand)
+    {
+      const std::string flush_path = Config::Get(Config::MAIN_WII_SESSION_NAND_FLUSH_PATH);
+      if (!flush_path.empty())
+        s_memory_nand->Flush(flush_path);
+      s_memory_nand.reset();
+    }
+
     File::DeleteDirRecursively(s_temp_wii_root);
     s_temp_wii_root.clear();
     File::DeleteDirRecursively(s_temp_redirect_root);
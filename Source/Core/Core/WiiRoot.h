@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -12,6 +13,7 @@ class BootSessionData;
 
 namespace IOS::HLE::FS
 {
+class MemoryNand;
 struct NandRedirect;
 }
 
@@ -39,4 +41,7 @@ void InitializeWiiFileSystemContents(
 void CleanUpWiiFileSystemContents(const BootSessionData& boot_session_data);
 
 const std::vector<IOS::HLE::FS::NandRedirect>& GetActiveNandRedirects();
+
+// Returns the NAND of the session if it is kept in memory, nullptr otherwise.
+std::shared_ptr<IOS::HLE::FS::MemoryNand> GetSessionMemoryNand();
 }  // namespace Core
@@ -14,6 +14,7 @@
 // automatically do the right thing.
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -194,6 +195,26 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// Where the time of a conversion was spent. Stages that run on several threads at once
+// report the sum over all threads, so they can add up to more than the total time.
+struct ConversionStats
+{
+  size_t threads = 0;
+  u64 bytes_read = 0;
+  u64 bytes_written = 0;
+  std::chrono::nanoseconds total_time{};
+  // Reading the input
+  std::chrono::nanoseconds read_time{};
+  // Waiting for the compression threads to make room for more input
+  std::chrono::nanoseconds read_wait_time{};
+  // Decrypting and rehashing Wii partition data
+  std::chrono::nanoseconds decryption_time{};
+  // Everything else the compression threads do, such as compressing
+  std::chrono::nanoseconds compression_time{};
+  // Writing the output
+  std::chrono::nanoseconds write_time{};
+};
+
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
                   CompressCB callback);
@@ -202,6 +223,6 @@ bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, CompressCB callback, ConversionStats* stats = nullptr);
 
 }  // namespace DiscIO
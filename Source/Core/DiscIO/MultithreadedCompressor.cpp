@@ -0,0 +1,50 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/MultithreadedCompressor.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace DiscIO
+{
+static std::mutex s_budget_mutex;
+static std::condition_variable s_budget_released;
+static size_t s_budget_threads = 0;
+static size_t s_budget_busy_threads = 0;
+
+void CompressionThreadBudget::SetThreads(size_t threads)
+{
+  std::lock_guard guard(s_budget_mutex);
+  ASSERT(s_budget_busy_threads == 0);
+  s_budget_threads = threads;
+}
+
+size_t CompressionThreadBudget::GetThreads()
+{
+  std::lock_guard guard(s_budget_mutex);
+  return s_budget_threads;
+}
+
+void CompressionThreadBudget::Acquire()
+{
+  std::unique_lock lock(s_budget_mutex);
+  if (s_budget_threads == 0)
+    return;
+
+  s_budget_released.wait(lock, [] { return s_budget_busy_threads < s_budget_threads; });
+  ++s_budget_busy_threads;
+}
+
+void CompressionThreadBudget::Release()
+{
+  {
+    std::lock_guard guard(s_budget_mutex);
+    if (s_budget_threads == 0)
+      return;
+
+    --s_budget_busy_threads;
+  }
+  s_budget_released.notify_one();
+}
+}  // namespace DiscIO
@@ -3,16 +3,19 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
-#include <memory>
+#include <map>
+#include <mutex>
 #include <thread>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "Common/Assert.h"
-#include "Common/Event.h"
 #include "Common/Result.h"
 
 namespace DiscIO
@@ -29,6 +32,21 @@ enum class ConversionResultCode
 template <typename T>
 using ConversionResult = Common::Result<ConversionResultCode, T>;
 
+// Limits how many compression threads can be busy at once across all MultithreadedCompressors,
+// so that several conversions can run side by side without oversubscribing the CPU.
+// By default there is no shared limit, and each compressor uses one thread per CPU core.
+class CompressionThreadBudget
+{
+public:
+  // 0 removes the limit. Must not be called while anything is being compressed.
+  static void SetThreads(size_t threads);
+  static size_t GetThreads();
+
+  // Blocks until a thread from the budget is free. Does nothing if there is no limit.
+  static void Acquire();
+  static void Release();
+};
+
 // This class starts a number of compression threads and one output thread.
 // The set_up_compress_thread_state function is called at the start of each compression thread.
 // When CompressAndWrite is called, the compress function will be called on one of the
@@ -37,6 +55,9 @@ using ConversionResult = Common::Result<ConversionResultCode, T>;
 // but the compression threads are not guaranteed to handle data in a predictable order.
 // Remember to check GetStatus regularly and cancel if it doesn't return Success,
 // and call Shutdown when you want to ensure that everything finishes.
+//
+// CompressAndWrite only blocks once a few submissions per thread are waiting to be compressed
+// or output, so the caller can read ahead while a slow piece of data is being compressed.
 template <typename CompressThreadState, typename CompressParameters, typename OutputParameters>
 class MultithreadedCompressor
 {
@@ -48,15 +69,16 @@ public:
       std::function<ConversionResultCode(OutputParameters)> output)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(CompressionThreadBudget::GetThreads() != 0 ?
+                      CompressionThreadBudget::GetThreads() :
+                      std::max<unsigned int>(1, std::thread::hardware_concurrency())),
+        m_max_in_flight(m_threads * 2)
   {
-    m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
-
+    m_compress_threads.reserve(m_threads);
     for (size_t i = 0; i < m_threads; ++i)
     {
-      m_compress_threads[i].thread =
-          std::thread(std::mem_fn(&MultithreadedCompressor::CompressThreadFunction), this,
-                      &m_compress_threads[i]);
+      m_compress_threads.emplace_back(
+          std::mem_fn(&MultithreadedCompressor::CompressThreadFunction), this);
     }
 
     m_output_thread =
@@ -69,20 +91,25 @@ public:
       Shutdown();
   }
 
+  size_t GetThreadCount() const { return m_threads; }
+
   void CompressAndWrite(CompressParameters parameters)
   {
     if (GetStatus() != ConversionResultCode::Success)
       return;
 
-    CompressThread& compress_thread = m_compress_threads[m_current_index];
+    std::unique_lock lock(m_mutex);
+    m_space_available.wait(lock, [this] {
+      return m_in_flight < m_max_in_flight || GetStatus() != ConversionResultCode::Success;
+    });
+    if (GetStatus() != ConversionResultCode::Success)
+      return;
 
-    compress_thread.compress_ready_event.Wait();
-    compress_thread.compress_parameters = std::move(parameters);
-    compress_thread.compress_event.Set();
+    m_compress_queue.emplace_back(m_next_index++, std::move(parameters));
+    ++m_in_flight;
+    lock.unlock();
 
-    ++m_current_index;
-    if (m_current_index >= m_threads)
-      m_current_index -= m_threads;
+    m_compress_available.notify_one();
   }
 
   void SetError(ConversionResultCode result)
@@ -92,48 +119,35 @@ public:
     // If we already have an error, don't overwrite it
     ConversionResultCode expected = ConversionResultCode::Success;
     m_result.compare_exchange_strong(expected, result);
+
+    // Wake up CompressAndWrite and Shutdown, which stop waiting once there is an error
+    std::lock_guard guard(m_mutex);
+    m_space_available.notify_all();
   }
 
   ConversionResultCode GetStatus() const { return m_result.load(); }
 
   void Shutdown()
   {
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_ready_event.Wait();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_done_event.Wait();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_ready_event.Wait();
-
-    m_shutting_down.store(true);
+    {
+      std::unique_lock lock(m_mutex);
+      m_space_available.wait(lock, [this] {
+        return m_in_flight == 0 || GetStatus() != ConversionResultCode::Success;
+      });
+      m_shutting_down.store(true);
+    }
 
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].compress_event.Set();
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_event.Set();
+    m_compress_available.notify_all();
+    m_output_available.notify_all();
 
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].thread.join();
+    for (std::thread& thread : m_compress_threads)
+      thread.join();
 
     m_output_thread.join();
   }
 
 private:
-  struct CompressThread
-  {
-    std::thread thread;
-
-    Common::Event compress_ready_event;
-    Common::Event compress_event;
-    Common::Event compress_done_event;
-    Common::Event output_ready_event;
-    Common::Event output_event;
-
-    CompressParameters compress_parameters;
-    OutputParameters output_parameters;
-  };
-
-  void CompressThreadFunction(CompressThread* state)
+  void CompressThreadFunction()
   {
     CompressThreadState compress_thread_state;
 
@@ -141,67 +155,68 @@ private:
     if (setup_result != ConversionResultCode::Success)
       SetError(setup_result);
 
-    state->compress_ready_event.Set();
-    state->compress_done_event.Set();
-
     while (true)
     {
-      state->compress_event.Wait();
+      std::unique_lock lock(m_mutex);
+      m_compress_available.wait(
+          lock, [this] { return m_shutting_down.load() || !m_compress_queue.empty(); });
 
       if (m_shutting_down.load())
         return;
 
-      CompressParameters parameters = std::move(state->compress_parameters);
-
-      state->compress_done_event.Reset();
-      state->compress_ready_event.Set();
+      auto [index, parameters] = std::move(m_compress_queue.front());
+      m_compress_queue.pop_front();
+      lock.unlock();
 
+      CompressionThreadBudget::Acquire();
       ConversionResult<OutputParameters> result =
           m_compress(&compress_thread_state, std::move(parameters));
+      CompressionThreadBudget::Release();
 
-      if (result)
-      {
-        state->output_ready_event.Wait();
-        state->output_parameters = std::move(*result);
-        state->output_event.Set();
-      }
-      else
+      if (!result)
       {
         SetError(result.Error());
+        continue;
       }
 
-      state->compress_done_event.Set();
+      lock.lock();
+      m_output_queue.emplace(index, std::move(*result));
+      const bool is_next_to_output = index == m_next_output_index;
+      lock.unlock();
+
+      if (is_next_to_output)
+        m_output_available.notify_one();
     }
   }
 
   void OutputThreadFunction()
   {
-    for (size_t i = 0; i < m_threads; ++i)
-      m_compress_threads[i].output_ready_event.Set();
-
-    size_t index = 0;
-
     while (true)
     {
-      CompressThread& compress_thread = m_compress_threads[index];
-
-      compress_thread.output_event.Wait();
+      std::unique_lock lock(m_mutex);
+      m_output_available.wait(lock, [this] {
+        return m_shutting_down.load() || m_output_queue.contains(m_next_output_index);
+      });
 
       if (m_shutting_down.load())
         return;
 
-      OutputParameters parameters = std::move(compress_thread.output_parameters);
-
-      compress_thread.output_ready_event.Set();
+      const auto it = m_output_queue.find(m_next_output_index);
+      OutputParameters parameters = std::move(it->second);
+      m_output_queue.erase(it);
+      lock.unlock();
 
       const ConversionResultCode result = m_output(std::move(parameters));
 
       if (result != ConversionResultCode::Success)
         SetError(result);
 
-      ++index;
-      if (index >= m_threads)
-        index -= m_threads;
+      lock.lock();
+      ++m_next_output_index;
+      --m_in_flight;
+      lock.unlock();
+
+      m_space_available.notify_all();
     }
   }
 
@@ -210,12 +225,24 @@ private:
       m_compress;
   std::function<ConversionResultCode(OutputParameters)> m_output;
 
-  // We can't use std::vector for this, because Common::Event is not movable
-  std::unique_ptr<CompressThread[]> m_compress_threads;
+  std::vector<std::thread> m_compress_threads;
   std::thread m_output_thread;
 
   const size_t m_threads;
-  size_t m_current_index = 0;
+  // How many submissions may be waiting to be compressed or output at once
+  const size_t m_max_in_flight;
+
+  std::mutex m_mutex;
+  std::condition_variable m_compress_available;
+  std::condition_variable m_output_available;
+  std::condition_variable m_space_available;
+
+  // Submissions are numbered so that the output thread can put them back in order
+  std::deque<std::pair<size_t, CompressParameters>> m_compress_queue;
+  std::map<size_t, OutputParameters> m_output_queue;
+  size_t m_next_index = 0;
+  size_t m_next_output_index = 0;
+  size_t m_in_flight = 0;
 
   std::atomic<ConversionResultCode> m_result = ConversionResultCode::Success;
   std::atomic<bool> m_shutting_down = false;
@@ -7,9 +7,11 @@
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -358,6 +360,7 @@ RedumpVerifier::Result RedumpVerifier::Finish(const Hashes<std::vector<u8>>& has
 }
 
 constexpr u64 DEFAULT_READ_SIZE = 0x20000;  // Arbitrary value
+constexpr u64 MAX_BYTES_IN_FLIGHT = 64 * 1024 * 1024;
 
 VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
                                Hashes<bool> hashes_to_calculate)
@@ -374,6 +377,7 @@ VolumeVerifier::VolumeVerifier(const Volume& volume, bool redump_verification,
 VolumeVerifier::~VolumeVerifier()
 {
   WaitForAsyncOperations();
+  m_data.reset();
 }
 
 Hashes<bool> VolumeVerifier::GetDefaultHashesToCalculate()
@@ -1065,56 +1069,126 @@ void VolumeVerifier::SetUpHashing()
   std::sort(m_groups.begin(), m_groups.end(),
             [](const GroupToVerify& a, const GroupToVerify& b) { return a.offset < b.offset; });
 
+  // Each hash is calculated on its own thread, in the order the data is read. Contents and groups
+  // don't depend on each other, so they are verified on as many threads as are left.
   if (m_hashes_to_calculate.crc32)
+  {
     m_crc32_context = Common::StartCRC32();
+    m_crc32_thread.Reset("CRC32 Hashing", [this](HashInput input) {
+      m_crc32_context = Common::UpdateCRC32(m_crc32_context, input.chunk->data(), input.size);
+    });
+  }
 
   if (m_hashes_to_calculate.md5)
   {
     mbedtls_md5_init(&m_md5_context);
     mbedtls_md5_starts_ret(&m_md5_context);
+    m_md5_thread.Reset("MD5 Hashing", [this](HashInput input) {
+      mbedtls_md5_update_ret(&m_md5_context, input.chunk->data(), input.size);
+    });
   }
 
   if (m_hashes_to_calculate.sha1)
   {
     m_sha1_context = Common::SHA1::CreateContext();
+    m_sha1_thread.Reset("SHA1 Hashing", [this](HashInput input) {
+      m_sha1_context->Update(input.chunk->data(), input.size);
+    });
+  }
+
+  if (!m_groups.empty() || !m_content_offsets.empty())
+  {
+    // The partition keys and H3 tables that the verification needs were already loaded by
+    // CheckPartitions, so the volume is only read from here on.
+    const u32 threads = std::thread::hardware_concurrency();
+    m_verification_pool.Start("Disc Verification", threads > 4 ? threads - 4 : 1);
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_crc32_thread.WaitForCompletion();
+  m_md5_thread.WaitForCompletion();
+  m_sha1_thread.WaitForCompletion();
+  m_verification_pool.Wait(m_verification_group);
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+bool VolumeVerifier::ReadChunk(u64 bytes_to_read)
 {
-  std::vector<u8> data(bytes_to_read);
+  auto data = std::make_unique<std::vector<u8>>(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+    std::memcpy(data->data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
+  m_data.reset();
 
+  {
+    std::unique_lock lock(m_chunk_mutex);
+    m_chunk_released.wait(lock, [this, size = data->size()] {
+      return m_bytes_in_flight == 0 || m_bytes_in_flight + size <= MAX_BYTES_IN_FLIGHT;
+    });
+    m_bytes_in_flight += data->size();
+  }
+
+  bool success = true;
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
-                       PARTITION_NONE))
+    success = m_volume.Read(m_progress + bytes_to_copy, bytes_to_read,
+                            data->data() + bytes_to_copy, PARTITION_NONE);
+  }
+
+  m_data = Chunk(data.release(), [this](const std::vector<u8>* chunk) { ReleaseChunk(chunk); });
+  return success;
+}
+
+void VolumeVerifier::ReleaseChunk(const std::vector<u8>* data)
+{
+  {
+    std::lock_guard lock(m_chunk_mutex);
+    m_bytes_in_flight -= data->size();
+  }
+  m_chunk_released.notify_one();
+
+  delete data;
+}
+
+void VolumeVerifier::VerifyGroup(const GroupToVerify& group, const Chunk& chunk, bool read_failed)
+{
+  u64 biggest_verified_offset = 0;
+  size_t block_errors = 0;
+  size_t unused_block_errors = 0;
+
+  u64 offset_in_group = 0;
+  for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
+       ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+  {
+    const u64 block_offset = group.offset + offset_in_group;
+
+    if (!read_failed && m_volume.CheckBlockIntegrity(
+                            block_index, chunk->data() + offset_in_group, group.partition))
     {
-      return false;
+      biggest_verified_offset = block_offset + VolumeWii::BLOCK_TOTAL_SIZE;
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        unused_block_errors++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        block_errors++;
+      }
     }
   }
 
-  WaitForAsyncOperations();
-  m_data = std::move(data);
-  return true;
+  std::lock_guard lock(m_verification_mutex);
+  m_biggest_verified_offset = std::max(m_biggest_verified_offset, biggest_verified_offset);
+  m_block_errors[group.partition] += block_errors;
+  m_unused_block_errors[group.partition] += unused_block_errors;
 }
 
 void VolumeVerifier::Process()
@@ -1188,7 +1262,7 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const bool read_failed = is_data_needed && !ReadChunk(bytes_to_read);
 
   if (read_failed)
   {
@@ -1203,73 +1277,41 @@ void VolumeVerifier::Process()
 
   if (m_calculating_any_hash)
   {
+    const HashInput input{m_data, static_cast<size_t>(byte_increment)};
+
     if (m_hashes_to_calculate.crc32)
-    {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
-      });
-    }
+      m_crc32_thread.Push(input);
 
     if (m_hashes_to_calculate.md5)
-    {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
-      });
-    }
+      m_md5_thread.Push(input);
 
     if (m_hashes_to_calculate.sha1)
-    {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
-      });
-    }
+      m_sha1_thread.Push(input);
   }
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
-      {
-        AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
-      }
-    });
+    m_verification_pool.Submit(
+        [this, read_failed, content, chunk = m_data] {
+          if (read_failed || !m_volume.CheckContentIntegrity(content, *chunk, m_ticket))
+          {
+            std::lock_guard lock(m_verification_mutex);
+            AddProblem(Severity::High,
+                       Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
+          }
+        },
+        &m_verification_group);
 
     m_content_index++;
   }
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
-    });
+    m_verification_pool.Submit(
+        [this, read_failed, group_index = m_group_index, chunk = m_data] {
+          VerifyGroup(m_groups[group_index], chunk, read_failed);
+        },
+        &m_verification_group);
 
     m_group_index++;
   }
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,6 +16,8 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ThreadPool.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -144,6 +148,15 @@ private:
     size_t block_index_end;
   };
 
+  // Data read by Process. Shared by the threads that hash and verify it.
+  using Chunk = std::shared_ptr<const std::vector<u8>>;
+
+  struct HashInput
+  {
+    Chunk chunk;
+    size_t size;
+  };
+
   std::vector<Partition> CheckPartitions();
   bool CheckPartition(const Partition& partition);  // Returns false if partition should be ignored
   std::string GetPartitionName(std::optional<u32> type) const;
@@ -156,8 +169,10 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void WaitForAsyncOperations();
+  bool ReadChunk(u64 bytes_to_read);
+  void ReleaseChunk(const std::vector<u8>* data);
+  void VerifyGroup(const GroupToVerify& group, const Chunk& chunk, bool read_failed);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -179,12 +194,15 @@ private:
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  Chunk m_data;
+
+  // Limits how far reading can get ahead of hashing and verification
+  std::mutex m_chunk_mutex;
+  std::condition_variable m_chunk_released;
+  u64 m_bytes_in_flight = 0;
+
+  // Guards the results of content and group verification, which run on several threads
+  std::mutex m_verification_mutex;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -203,6 +221,13 @@ private:
   u64 m_progress = 0;
   u64 m_max_progress = 0;
   DataSizeType m_data_size_type;
+
+  // Declared last so that the threads are stopped before anything they use is destroyed
+  Common::WorkQueueThread<HashInput> m_crc32_thread;
+  Common::WorkQueueThread<HashInput> m_md5_thread;
+  Common::WorkQueueThread<HashInput> m_sha1_thread;
+  Common::ThreadPool m_verification_pool;
+  Common::ThreadPool::WaitGroup m_verification_group;
 };
 
 }  // namespace DiscIO
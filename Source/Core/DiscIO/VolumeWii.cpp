@@ -7,7 +7,6 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
-#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -23,6 +22,7 @@
 #include "Common/Crypto/SHA1.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
@@ -35,6 +35,16 @@
 
 namespace DiscIO
 {
+// Shared by everything that hashes or encrypts groups, instead of starting new threads for every
+// group. Threads waiting for their jobs help with running them, so using this from more than one
+// thread at a time (like the WIA/RVZ compression threads do) can't deadlock.
+static Common::ThreadPool& GetGroupThreadPool()
+{
+  static Common::ThreadPool pool(
+      "Wii Group Crypto", std::max<unsigned int>(1, std::thread::hardware_concurrency()) - 1);
+  return pool;
+}
+
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
     : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
       m_last_decrypted_block(UINT64_MAX)
@@ -512,71 +522,62 @@ bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GR
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
+  Common::ThreadPool& pool = GetGroupThreadPool();
+  Common::ThreadPool::WaitGroup group;
   bool success = true;
 
   for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
   {
-    if (read_function && success)
-      success = read_function(i);
-
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i]() {
-      const size_t h1_base = Common::AlignDown(i, 8);
+    if (read_function && !read_function(i))
+    {
+      success = false;
+      break;
+    }
 
-      if (success)
-      {
-        // H0 hashes
-        for (size_t j = 0; j < 31; ++j)
-          out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
+    pool.Submit(
+        [in, out, i] {
+          const size_t h1_base = Common::AlignDown(i, 8);
 
-        // H0 padding
-        out[i].padding_0 = {};
+          // H0 hashes
+          for (size_t j = 0; j < 31; ++j)
+            out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
 
-        // H1 hash
-        out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
-      }
+          // H0 padding
+          out[i].padding_0 = {};
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
+          // H1 hash
+          out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
+        },
+        &group);
+  }
 
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
+  // Wait for all the hashing jobs to finish
+  pool.Wait(group);
 
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+  if (!success)
+    return false;
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+  for (size_t h1_base = 0; h1_base < BLOCKS_PER_GROUP; h1_base += 8)
+  {
+    // H1 padding
+    out[h1_base].padding_1 = {};
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+    // H1 copies
+    for (size_t j = 1; j < 8; ++j)
+      out[h1_base + j].h1 = out[h1_base].h1;
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
-
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
-    });
+    // H2 hash
+    out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[h1_base].h1);
   }
 
-  // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  // H2 padding
+  out[0].padding_2 = {};
+
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
 
-  return success;
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
@@ -611,34 +612,31 @@ bool VolumeWii::EncryptGroup(
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
 
-  const unsigned int threads =
-      std::min(BLOCKS_PER_GROUP, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
-
-  std::vector<std::future<void>> encryption_futures(threads);
-
   auto aes_context = Common::AES::CreateContextEncrypt(key.data());
 
-  for (size_t i = 0; i < threads; ++i)
-  {
-    encryption_futures[i] = std::async(
-        std::launch::async,
-        [&unencrypted_data, &unencrypted_hashes, &aes_context, &out](size_t start, size_t end) {
-          for (size_t j = start; j < end; ++j)
-          {
-            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
-
-            aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[j]), out_ptr,
-                                     BLOCK_HEADER_SIZE);
-
-            aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[j].data(),
-                               out_ptr + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE);
-          }
-        },
-        i * BLOCKS_PER_GROUP / threads, (i + 1) * BLOCKS_PER_GROUP / threads);
-  }
+  // Every block is encrypted on its own, so the blocks are encrypted several at a time
+  // to make use of all the AES units, and spread over the thread pool
+  constexpr u32 BLOCKS_PER_JOB = 8;
+  GetGroupThreadPool().ParallelFor(BLOCKS_PER_GROUP / BLOCKS_PER_JOB, [&](u32 job) {
+    std::array<const u8*, BLOCKS_PER_JOB> headers_in, data_in, data_ivs;
+    std::array<u8*, BLOCKS_PER_JOB> headers_out, data_out;
+    for (u32 i = 0; i < BLOCKS_PER_JOB; ++i)
+    {
+      const u32 block = job * BLOCKS_PER_JOB + i;
+      u8* out_ptr = out->data() + block * BLOCK_TOTAL_SIZE;
+
+      headers_in[i] = reinterpret_cast<const u8*>(&unencrypted_hashes[block]);
+      headers_out[i] = out_ptr;
+      data_in[i] = unencrypted_data[block].data();
+      data_ivs[i] = out_ptr + 0x3D0;
+      data_out[i] = out_ptr + BLOCK_HEADER_SIZE;
+    }
 
-  for (std::future<void>& future : encryption_futures)
-    future.get();
+    aes_context->CryptMultiple(nullptr, headers_in.data(), headers_out.data(), BLOCKS_PER_JOB,
+                               BLOCK_HEADER_SIZE);
+    aes_context->CryptMultiple(data_ivs.data(), data_in.data(), data_out.data(), BLOCKS_PER_JOB,
+                               BLOCK_DATA_SIZE);
+  });
 
   return true;
 }
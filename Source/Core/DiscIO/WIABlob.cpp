@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <limits>
 #include <map>
@@ -1387,6 +1389,8 @@ WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressPa
         const u64 blocks_in_this_group =
             std::min<u64>(VolumeWii::BLOCKS_PER_GROUP, blocks - i * VolumeWii::BLOCKS_PER_GROUP);
 
+        const auto decryption_start = std::chrono::steady_clock::now();
+
         for (u32 j = 0; j < VolumeWii::BLOCKS_PER_GROUP; ++j)
         {
           if (j < blocks_in_this_group)
@@ -1403,6 +1407,8 @@ WIARVZFileReader<RVZ>::ProcessAndCompress(CompressThreadState* state, CompressPa
 
         VolumeWii::HashGroup(state->decryption_buffer.data(), state->hash_buffer.data());
 
+        state->decryption_time += std::chrono::steady_clock::now() - decryption_start;
+
         for (u64 j = 0; j < blocks_in_this_group; ++j)
         {
           const u64 chunk_index = j / blocks_per_chunk;
@@ -1735,8 +1741,12 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               ConversionStats* stats)
 {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start_time = Clock::now();
+
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
 
@@ -1810,6 +1820,12 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   std::map<ReuseID, GroupEntry> reusable_groups;
   std::mutex reusable_groups_mutex;
 
+  Clock::duration read_time{};
+  Clock::duration read_wait_time{};
+  Clock::duration write_time{};
+  std::atomic<Clock::rep> decryption_time = 0;
+  std::atomic<Clock::rep> compression_time = 0;
+
   const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
     SetUpCompressor(&state->compressor, compression_type, compression_level, nullptr);
     return ConversionResultCode::Success;
@@ -1823,16 +1839,27 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 
     const bool compression = compression_type != WIARVZCompressionType::None;
 
-    return ProcessAndCompress(state, std::move(parameters), partition_entries, data_entries,
-                              file_system, &reusable_groups, &reusable_groups_mutex,
-                              chunks_per_wii_group, exception_lists_per_chunk,
-                              compressed_exception_lists, compression);
+    const Clock::time_point process_start = Clock::now();
+
+    auto result = ProcessAndCompress(state, std::move(parameters), partition_entries,
+                                     data_entries, file_system, &reusable_groups,
+                                     &reusable_groups_mutex, chunks_per_wii_group,
+                                     exception_lists_per_chunk, compressed_exception_lists,
+                                     compression);
+
+    const Clock::duration decryption = std::exchange(state->decryption_time, {});
+    decryption_time += decryption.count();
+    compression_time += (Clock::now() - process_start - decryption).count();
+
+    return result;
   };
 
   const auto output = [&](OutputParameters parameters) {
+    const Clock::time_point write_start = Clock::now();
     const ConversionResultCode result =
         Output(&parameters.entries, outfile, &reusable_groups, &reusable_groups_mutex,
                &group_entries[parameters.group_index], &bytes_written);
+    write_time += Clock::now() - write_start;
 
     if (result != ConversionResultCode::Success)
       return result;
@@ -1903,13 +1930,18 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
         bytes_to_read = std::max<u64>(bytes_to_read, VolumeWii::GROUP_TOTAL_SIZE);
       bytes_to_read = std::min<u64>(bytes_to_read, data_offset + data_size - bytes_read);
 
-      buffer.resize(bytes_to_read);
-      if (!infile->Read(bytes_read, bytes_to_read, buffer.data()))
+      const Clock::time_point read_start = Clock::now();
+      std::vector<u8> data(bytes_to_read);
+      if (!infile->Read(bytes_read, bytes_to_read, data.data()))
         return ConversionResultCode::ReadFailed;
       bytes_read += bytes_to_read;
 
+      const Clock::time_point read_end = Clock::now();
+      read_time += read_end - read_start;
+
       mt_compressor.CompressAndWrite(CompressParameters{
-          buffer, &data_entry, data_offset_in_partition, bytes_read, groups_processed});
+          std::move(data), &data_entry, data_offset_in_partition, bytes_read, groups_processed});
+      read_wait_time += Clock::now() - read_end;
 
       data_offset += bytes_to_read;
       data_size -= bytes_to_read;
@@ -2028,13 +2060,26 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   if (!outfile->WriteArray(&header_2, 1))
     return ConversionResultCode::WriteFailed;
 
+  if (stats)
+  {
+    stats->threads = mt_compressor.GetThreadCount();
+    stats->bytes_read = bytes_read;
+    stats->bytes_written = outfile->GetSize();
+    stats->total_time = Clock::now() - start_time;
+    stats->read_time = read_time;
+    stats->read_wait_time = read_wait_time;
+    stats->decryption_time = Clock::duration(decryption_time.load());
+    stats->compression_time = Clock::duration(compression_time.load());
+    stats->write_time = write_time;
+  }
+
   return ConversionResultCode::Success;
 }
 
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, ConversionStats* stats)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2052,7 +2097,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, stats);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
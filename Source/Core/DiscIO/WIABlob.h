@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
@@ -69,7 +70,8 @@ public:
 
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      ConversionStats* stats = nullptr);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -285,6 +287,9 @@ private:
 
     std::vector<VolumeWii::HashBlock> hash_buffer =
         std::vector<VolumeWii::HashBlock>(VolumeWii::BLOCKS_PER_GROUP);
+
+    // Added to by ProcessAndCompress
+    std::chrono::steady_clock::duration decryption_time{};
   };
 
   struct CompressParameters
@@ -26,43 +26,54 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
                                  u64 partition_data_decrypted_size, const Key& key,
                                  const HashExceptionCallback& hash_exception_callback)
 {
-  // Only allocate memory if this function actually ends up getting called
-  if (!m_cache)
-  {
-    m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
-    m_cached_offset = std::numeric_limits<u64>::max();
-  }
-
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
   const u64 group_offset_in_partition =
       offset / VolumeWii::GROUP_TOTAL_SIZE * VolumeWii::GROUP_DATA_SIZE;
   const u64 group_offset_on_disc = partition_data_offset + offset;
 
-  if (m_cached_offset != group_offset_on_disc)
+  // Look for the group, and otherwise replace the least recently used one.
+  // Unused entries have never been used, so they are replaced first.
+  CachedGroup* entry = &m_cache[0];
+  for (CachedGroup& cached_group : m_cache)
   {
-    std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
-
-    if (hash_exception_callback)
+    if (cached_group.data && cached_group.offset == group_offset_on_disc)
     {
-      hash_exception_callback_2 =
-          [offset, &hash_exception_callback](
-              VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
-            return hash_exception_callback(hash_blocks, offset);
-          };
+      cached_group.last_used = ++m_use_counter;
+      return cached_group.data.get();
     }
 
-    if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
-                                 partition_data_decrypted_size, key, m_blob, m_cache.get(),
-                                 hash_exception_callback_2))
-    {
-      m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
-      return nullptr;
-    }
+    if (cached_group.last_used < entry->last_used)
+      entry = &cached_group;
+  }
 
-    m_cached_offset = group_offset_on_disc;
+  // Only allocate memory if it actually ends up getting used
+  if (!entry->data)
+    entry->data = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
+
+  std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
+
+  if (hash_exception_callback)
+  {
+    hash_exception_callback_2 =
+        [offset, &hash_exception_callback](
+            VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
+          return hash_exception_callback(hash_blocks, offset);
+        };
+  }
+
+  if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
+                               partition_data_decrypted_size, key, m_blob, entry->data.get(),
+                               hash_exception_callback_2))
+  {
+    // Invalidate the entry
+    entry->offset = std::numeric_limits<u64>::max();
+    entry->last_used = 0;
+    return nullptr;
   }
 
-  return m_cache.get();
+  entry->offset = group_offset_on_disc;
+  entry->last_used = ++m_use_counter;
+  return entry->data.get();
 }
 
 bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
@@ -33,6 +33,10 @@ public:
   WiiEncryptionCache(const WiiEncryptionCache&) = delete;
   WiiEncryptionCache& operator=(const WiiEncryptionCache&) = delete;
 
+  // The number of most recently used groups that are kept around, so that random reads don't
+  // need to re-encrypt the same groups over and over.
+  static constexpr size_t CACHED_GROUPS = 8;
+
   // Encrypts exactly one group.
   // If the returned pointer is nullptr, reading from the blob failed.
   // If the returned pointer is not nullptr, it is guaranteed to be valid until
@@ -48,9 +52,16 @@ public:
                      const HashExceptionCallback& hash_exception_callback = {});
 
 private:
+  struct CachedGroup
+  {
+    std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> data;
+    u64 offset = std::numeric_limits<u64>::max();
+    u64 last_used = 0;
+  };
+
   BlobReader* m_blob;
-  std::unique_ptr<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>> m_cache;
-  u64 m_cached_offset = 0;
+  std::array<CachedGroup, CACHED_GROUPS> m_cache;
+  u64 m_use_counter = 0;
 };
 
 }  // namespace DiscIO
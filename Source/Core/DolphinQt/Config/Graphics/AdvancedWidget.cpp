@@ -186,9 +186,15 @@ void AdvancedWidget::CreateWidgets()
       new ConfigBool(tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION);
   m_manual_texture_sampling =
       new ConfigBool(tr("Manual Texture Sampling"), Config::GFX_HACK_FAST_TEXTURE_SAMPLING, true);
+  m_fast_texture_hashing =
+      new ConfigBool(tr("Fast Texture Hashing"), Config::GFX_HACK_FAST_TEXTURE_HASHING);
+  m_async_texture_decoding =
+      new ConfigBool(tr("Asynchronous Texture Decoding"), Config::GFX_HACK_ASYNC_TEXTURE_DECODING);
 
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
   experimental_layout->addWidget(m_manual_texture_sampling, 0, 1);
+  experimental_layout->addWidget(m_fast_texture_hashing, 1, 0);
+  experimental_layout->addWidget(m_async_texture_decoding, 1, 1);
 
   main_layout->addWidget(performance_box);
   main_layout->addWidget(debugging_box);
@@ -397,6 +403,21 @@ void AdvancedWidget::AddDescriptions()
       "resolutions; additionally, Anisotropic Filtering is currently incompatible with Manual "
       "Texture Sampling.<br><br>"
       "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_FAST_TEXTURE_HASHING_DESCRIPTION[] = QT_TR_NOOP(
+      "Uses the vectorized XXH3 hash to detect changes in texture memory instead of the legacy "
+      "texture cache hash. This is considerably faster for large textures, especially when "
+      "Texture Cache Accuracy is set to Safe.<br><br>"
+      "This only affects texture cache lookups; the names of dumped and custom textures do not "
+      "change.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
+  static const char TR_ASYNC_TEXTURE_DECODING_DESCRIPTION[] = QT_TR_NOOP(
+      "Decodes large textures on worker threads without waiting for them to finish. Until a "
+      "texture is ready, which is at most until the end of the frame, a transparent placeholder "
+      "is drawn in its place.<br><br>"
+      "This reduces stuttering when many new textures are loaded at once, e.g. during scene "
+      "transitions, but can cause brief flickering. Has no effect with GPU Texture "
+      "Decoding.<br><br>"
+      "<dolphin_emphasis>If unsure, leave this unchecked.</dolphin_emphasis>");
 
 #ifdef _WIN32
   static const char TR_BORDERLESS_FULLSCREEN_DESCRIPTION[] = QT_TR_NOOP(
@@ -458,4 +479,6 @@ void AdvancedWidget::AddDescriptions()
 #endif
   m_defer_efb_access_invalidation->SetDescription(tr(TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION));
   m_manual_texture_sampling->SetDescription(tr(TR_MANUAL_TEXTURE_SAMPLING_DESCRIPTION));
+  m_fast_texture_hashing->SetDescription(tr(TR_FAST_TEXTURE_HASHING_DESCRIPTION));
+  m_async_texture_decoding->SetDescription(tr(TR_ASYNC_TEXTURE_DECODING_DESCRIPTION));
 }
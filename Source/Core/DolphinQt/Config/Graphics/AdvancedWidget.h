@@ -75,4 +75,6 @@ private:
   // Experimental
   ConfigBool* m_defer_efb_access_invalidation;
   ConfigBool* m_manual_texture_sampling;
+  ConfigBool* m_fast_texture_hashing;
+  ConfigBool* m_async_texture_decoding;
 };
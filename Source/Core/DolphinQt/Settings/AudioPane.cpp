@@ -52,11 +52,16 @@ void AudioPane::CreateWidgets()
   m_dsp_hle = new QRadioButton(tr("DSP HLE (recommended)"));
   m_dsp_lle = new QRadioButton(tr("DSP LLE Recompiler (slow)"));
   m_dsp_interpreter = new QRadioButton(tr("DSP LLE Interpreter (very slow)"));
+  m_dsp_hle_thread = new QCheckBox(tr("Run DSP HLE on a Separate Thread"));
+  m_dsp_hle_thread->setToolTip(
+      tr("Renders DSP HLE audio on a separate thread. Can improve performance on systems with "
+         "enough cores. Has no effect during NetPlay or movie recording or playback."));
 
   dsp_layout->addStretch(1);
   dsp_layout->addWidget(m_dsp_hle);
   dsp_layout->addWidget(m_dsp_lle);
   dsp_layout->addWidget(m_dsp_interpreter);
+  dsp_layout->addWidget(m_dsp_hle_thread);
   dsp_layout->addStretch(1);
 
   auto* volume_box = new QGroupBox(tr("Volume"));
@@ -187,6 +192,7 @@ void AudioPane::ConnectWidgets()
   connect(m_dsp_hle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_lle, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
   connect(m_dsp_interpreter, &QRadioButton::toggled, this, &AudioPane::SaveSettings);
+  connect(m_dsp_hle_thread, &QCheckBox::toggled, this, &AudioPane::SaveSettings);
 
 #ifdef _WIN32
   connect(m_wasapi_device_combo, &QComboBox::currentIndexChanged, this, &AudioPane::SaveSettings);
@@ -207,6 +213,7 @@ void AudioPane::LoadSettings()
     m_dsp_lle->setChecked(Config::Get(Config::MAIN_DSP_JIT));
     m_dsp_interpreter->setChecked(!Config::Get(Config::MAIN_DSP_JIT));
   }
+  m_dsp_hle_thread->setChecked(Config::Get(Config::MAIN_DSP_HLE_THREAD));
 
   // Backend
   const auto current = Config::Get(Config::MAIN_AUDIO_BACKEND);
@@ -275,6 +282,7 @@ void AudioPane::SaveSettings()
   }
   Config::SetBaseOrCurrent(Config::MAIN_DSP_HLE, m_dsp_hle->isChecked());
   Config::SetBaseOrCurrent(Config::MAIN_DSP_JIT, m_dsp_lle->isChecked());
+  Config::SetBaseOrCurrent(Config::MAIN_DSP_HLE_THREAD, m_dsp_hle_thread->isChecked());
 
   // Backend
   const auto selection =
@@ -335,6 +343,8 @@ void AudioPane::OnDspChanged()
 {
   const auto backend = Config::Get(Config::MAIN_AUDIO_BACKEND);
 
+  m_dsp_hle_thread->setEnabled(m_dsp_hle->isChecked());
+
   m_dolby_pro_logic->setEnabled(AudioCommon::SupportsDPL2Decoder(backend) &&
                                 !m_dsp_hle->isChecked());
   EnableDolbyQualityWidgets(AudioCommon::SupportsDPL2Decoder(backend) && !m_dsp_hle->isChecked() &&
@@ -379,6 +389,7 @@ void AudioPane::OnEmulationStateChanged(bool running)
   m_dsp_hle->setEnabled(!running);
   m_dsp_lle->setEnabled(!running);
   m_dsp_interpreter->setEnabled(!running);
+  m_dsp_hle_thread->setEnabled(!running && m_dsp_hle->isChecked());
   m_backend_label->setEnabled(!running);
   m_backend_combo->setEnabled(!running);
   if (AudioCommon::SupportsDPL2Decoder(Config::Get(Config::MAIN_AUDIO_BACKEND)) &&
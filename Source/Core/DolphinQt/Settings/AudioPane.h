@@ -50,6 +50,7 @@ private:
   QRadioButton* m_dsp_hle;
   QRadioButton* m_dsp_lle;
   QRadioButton* m_dsp_interpreter;
+  QCheckBox* m_dsp_hle_thread;
 
   // Volume
   QSlider* m_volume_slider;
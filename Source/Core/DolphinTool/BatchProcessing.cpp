@@ -0,0 +1,155 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/BatchProcessing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
+
+namespace DolphinTool
+{
+std::optional<std::vector<BatchInput>> FindBatchInputs(const std::string& path)
+{
+  std::vector<BatchInput> inputs;
+
+  if (File::IsDirectory(path))
+  {
+    static const std::vector<std::string> extensions = {
+        ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs"};
+
+    const auto directory = StringToPath(path);
+    for (std::string& file : Common::DoFileSearch({path}, extensions, true))
+    {
+      std::string relative_path = PathToString(StringToPath(file).lexically_relative(directory));
+      std::replace(relative_path.begin(), relative_path.end(), '\\', '/');
+      inputs.push_back(BatchInput{std::move(file), std::move(relative_path)});
+    }
+  }
+  else
+  {
+    std::string list;
+    if (!File::ReadFileToString(path, list))
+      return std::nullopt;
+
+    for (const std::string& line : SplitString(list, '\n'))
+    {
+      std::string file(StripWhitespace(line));
+      if (file.empty())
+        continue;
+
+      std::string file_name = PathToFileName(file);
+      inputs.push_back(BatchInput{std::move(file), std::move(file_name)});
+    }
+  }
+
+  std::sort(inputs.begin(), inputs.end(),
+            [](const BatchInput& a, const BatchInput& b) { return a.path < b.path; });
+  return inputs;
+}
+
+bool BatchManifest::Open(const std::string& path)
+{
+  std::string contents;
+  if (File::Exists(path) && !File::ReadFileToString(path, contents))
+    return false;
+
+  // Lines that can't be parsed, like one that was cut off by an interruption, are ignored
+  for (const std::string& line : SplitString(contents, '\n'))
+  {
+    picojson::value entry;
+    if (!picojson::parse(entry, line).empty() || !entry.is<picojson::object>())
+      continue;
+
+    const picojson::value& input = entry.get("input");
+    const picojson::value& success = entry.get("success");
+    if (input.is<std::string>() && success.is<bool>() && success.get<bool>())
+      m_succeeded.insert(input.get<std::string>());
+  }
+
+  if (!m_file.Open(path, "ab"))
+    return false;
+
+  // Don't append to a line that was cut off
+  if (!contents.empty() && contents.back() != '\n')
+    return m_file.WriteString("\n");
+
+  return true;
+}
+
+bool BatchManifest::HasSucceeded(const std::string& input) const
+{
+  std::lock_guard guard(m_mutex);
+  return m_succeeded.contains(input);
+}
+
+bool BatchManifest::Add(const picojson::object& entry)
+{
+  const std::string line = picojson::value(entry).serialize() + '\n';
+
+  std::lock_guard guard(m_mutex);
+  return m_file.WriteString(line) && m_file.Flush();
+}
+
+bool RunBatch(const std::vector<BatchInput>& inputs, u32 jobs, BatchManifest* manifest,
+              const BatchFunction& function)
+{
+  std::vector<const BatchInput*> remaining;
+  for (const BatchInput& input : inputs)
+  {
+    if (!manifest->HasSucceeded(input.path))
+      remaining.push_back(&input);
+  }
+
+  if (remaining.size() != inputs.size())
+  {
+    fmt::print(std::cerr, "Skipping {} of {} files that were already done\n",
+               inputs.size() - remaining.size(), inputs.size());
+  }
+
+  std::mutex print_mutex;
+  std::atomic<size_t> files_done = 0;
+  std::atomic<bool> all_succeeded = true;
+
+  // This thread runs jobs too while it waits
+  Common::ThreadPool pool("Batch Job", std::max<u32>(1, jobs) - 1);
+  Common::ThreadPool::WaitGroup group;
+  for (const BatchInput* input : remaining)
+  {
+    pool.Submit(
+        [&, input] {
+          picojson::object entry;
+          entry["input"] = picojson::value(input->path);
+
+          const bool success = function(*input, &entry);
+          entry["success"] = picojson::value(success);
+
+          if (!manifest->Add(entry))
+          {
+            std::lock_guard guard(print_mutex);
+            fmt::print(std::cerr, "Error: Could not write to the manifest\n");
+          }
+
+          if (!success)
+            all_succeeded = false;
+
+          std::lock_guard guard(print_mutex);
+          fmt::print(std::cerr, "[{}/{}] {}: {}\n", ++files_done, remaining.size(), input->path,
+                     success ? "OK" : "FAILED");
+        },
+        &group);
+  }
+  pool.Wait(group);
+
+  return all_succeeded;
+}
+}  // namespace DolphinTool
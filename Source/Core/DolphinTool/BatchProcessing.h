@@ -0,0 +1,56 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace DolphinTool
+{
+struct BatchInput
+{
+  std::string path;
+  // Path relative to the directory that was searched, or the file name for inputs from a list
+  std::string relative_path;
+};
+
+// Returns the disc images in a directory and its subdirectories, or the paths listed in a text
+// file with one path per line.
+std::optional<std::vector<BatchInput>> FindBatchInputs(const std::string& path);
+
+// Results of a batch run. Each input gets one JSON object on its own line, written as soon as the
+// input is done, so that an interrupted run leaves behind a manifest it can resume from.
+class BatchManifest
+{
+public:
+  // Loads the results of earlier runs from the file, if it exists, and appends to it.
+  bool Open(const std::string& path);
+
+  bool HasSucceeded(const std::string& input) const;
+
+  // Can be called from any thread.
+  bool Add(const picojson::object& entry);
+
+private:
+  mutable std::mutex m_mutex;
+  File::IOFile m_file;
+  std::set<std::string> m_succeeded;
+};
+
+// Calls function for each input that doesn't already have a successful result in the manifest,
+// for up to jobs inputs at once. The function returns whether it succeeded and can add results to
+// the manifest entry for its input. Returns false if any input failed.
+using BatchFunction = std::function<bool(const BatchInput& input, picojson::object* entry)>;
+bool RunBatch(const std::vector<BatchInput>& inputs, u32 jobs, BatchManifest* manifest,
+              const BatchFunction& function);
+}  // namespace DolphinTool
@@ -3,28 +3,49 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
 #include <optional>
+#include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <picojson.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscUtils.h"
+#include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/ScrubbedBlob.h"
 #include "DiscIO/Volume.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/WIABlob.h"
+#include "DolphinTool/BatchProcessing.h"
 #include "UICommon/UICommon.h"
 
 namespace DolphinTool
 {
+namespace
+{
+struct ConversionSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+};
+}  // namespace
+
 static std::optional<DiscIO::WIARVZCompressionType>
 ParseCompressionTypeString(const std::string& compression_str)
 {
@@ -56,6 +77,236 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
   return std::nullopt;
 }
 
+static std::string GetExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  default:
+    return ".iso";
+  }
+}
+
+static void PrintConversionStats(const DiscIO::ConversionStats& stats)
+{
+  const auto seconds = [](std::chrono::nanoseconds time) {
+    return std::chrono::duration<double>(time).count();
+  };
+  const double mib = stats.bytes_read / 1048576.0;
+
+  fmt::print(std::cout, "Converted {:.1f} MiB to {:.1f} MiB in {:.2f} s ({:.1f} MiB/s) using {} "
+                        "compression threads\n",
+             mib, stats.bytes_written / 1048576.0, seconds(stats.total_time),
+             mib / seconds(stats.total_time), stats.threads);
+
+  // Throughput is per thread for the stages that run on several threads
+  const auto print_stage = [&](std::string_view name, std::chrono::nanoseconds time) {
+    fmt::print(std::cout, "  {:<12} {:9.2f} s {:10.1f} MiB/s\n", name, seconds(time),
+               time.count() == 0 ? 0.0 : mib / seconds(time));
+  };
+  print_stage("Read", stats.read_time);
+  print_stage("Read wait", stats.read_wait_time);
+  print_stage("Decryption", stats.decryption_time);
+  print_stage("Compression", stats.compression_time);
+  print_stage("Write", stats.write_time);
+}
+
+static bool ConvertFile(const std::string& input_file_path, const std::string& output_file_path,
+                        const ConversionSettings& settings, DiscIO::ConversionStats* stats,
+                        std::string_view message_prefix = {})
+{
+  // In batch mode, messages are prefixed with the input they are about.
+  const auto print_message = [message_prefix](std::string_view message) {
+    fmt::print(std::cerr, "{}{}\n", message_prefix, message);
+  };
+
+  const DiscIO::BlobType format = settings.format;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    print_message("Error: The input file could not be opened.");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (settings.scrub)
+    {
+      print_message("Error: Scrubbing is only supported for GC/Wii disc images.");
+      return false;
+    }
+
+    print_message("Warning: The input file is not a GC/Wii disc image. Continuing anyway.");
+  }
+
+  if (settings.scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      print_message("Error: Scrubbing a Datel disc is not supported.");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      print_message("Error: Unable to process disc image. Try again without --scrub.");
+      return false;
+    }
+  }
+
+  if (settings.scrub && format == DiscIO::BlobType::RVZ)
+  {
+    print_message("Warning: Scrubbing an RVZ container does not offer significant space "
+                  "advantages. Continuing anyway.");
+  }
+
+  if (settings.scrub && format == DiscIO::BlobType::PLAIN)
+  {
+    print_message("Warning: Scrubbing does not save space when converting to ISO unless using "
+                  "external compression. Continuing anyway.");
+  }
+
+  if (!settings.scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    print_message("Warning: Converting Wii disc images to GCZ without scrubbing may not offer "
+                  "space advantages over ISO. Continuing anyway.");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    print_message("Warning: Converting an NKit file, output will still be NKit! Continuing "
+                  "anyway.");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    print_message("Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
+                  "must be an integer multiple of the block size and must not be an integer "
+                  "multiple of the block size multiplied by 32. Continuing anyway.");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
+                                   settings.block_size.value(), NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        settings.compression.value(), settings.compression_level.value(),
+        settings.block_size.value(), NOOP_STATUS_CALLBACK, stats);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  return success;
+}
+
+static bool ConvertBatch(const std::vector<BatchInput>& inputs, const std::string& output_directory,
+                         const ConversionSettings& settings, u32 jobs, BatchManifest* manifest)
+{
+  // The converted images keep the directory structure of the input
+  std::vector<std::string> output_paths;
+  std::set<std::string> unique_output_paths;
+  for (const BatchInput& input : inputs)
+  {
+    auto relative_path = StringToPath(input.relative_path);
+    relative_path.replace_extension(GetExtension(settings.format));
+    std::string output_path = output_directory + '/' + PathToString(relative_path);
+
+    if (!unique_output_paths.insert(output_path).second)
+    {
+      fmt::print(std::cerr, "Error: More than one input would be converted to {}\n", output_path);
+      return false;
+    }
+    output_paths.push_back(std::move(output_path));
+  }
+
+  return RunBatch(inputs, jobs, manifest, [&](const BatchInput& input, picojson::object* entry) {
+    const std::string& output_path = output_paths[&input - inputs.data()];
+    (*entry)["output"] = picojson::value(output_path);
+
+    // Convert to a temporary file first, so that an interrupted conversion can't be mistaken for
+    // a finished one
+    const std::string temporary_path = output_path + ".part";
+    if (!File::CreateFullPath(output_path))
+    {
+      fmt::print(std::cerr, "{}: Error: Could not create the directory for {}\n", input.path,
+                 output_path);
+      return false;
+    }
+
+    // Don't leave partial output behind if anything goes wrong
+    DiscIO::ConversionStats stats;
+    if (!ConvertFile(input.path, temporary_path, settings, &stats, input.path + ": "))
+    {
+      File::Delete(temporary_path, File::IfAbsentBehavior::NoConsoleWarning);
+      return false;
+    }
+    if (!File::Rename(temporary_path, output_path))
+    {
+      fmt::print(std::cerr, "{}: Error: Could not rename {} to {}\n", input.path, temporary_path,
+                 output_path);
+      File::Delete(temporary_path, File::IfAbsentBehavior::NoConsoleWarning);
+      return false;
+    }
+
+    (*entry)["input_size"] = picojson::value(static_cast<double>(File::GetSize(input.path)));
+    (*entry)["output_size"] = picojson::value(static_cast<double>(File::GetSize(output_path)));
+    if (stats.threads != 0)
+    {
+      (*entry)["seconds"] =
+          picojson::value(std::chrono::duration<double>(stats.total_time).count());
+    }
+    return true;
+  });
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
@@ -78,7 +329,7 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-o", "--output")
       .type("string")
       .action("store")
-      .help("Path to the destination FILE.")
+      .help("Path to the destination FILE, or DIRECTORY for --batch.")
       .metavar("FILE");
 
   parser.add_option("-f", "--format")
@@ -110,6 +361,36 @@ int ConvertCommand(const std::vector<std::string>& args)
       .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
             "zstd: 5");
 
+  parser.add_option("--stats")
+      .action("store_true")
+      .help("Print how much time each stage of the conversion took. Only for WIA/RVZ.");
+
+  parser.add_option("--batch")
+      .type("string")
+      .action("store")
+      .help("Convert all disc images in DIRECTORY and its subdirectories, or all the images listed "
+            "in a text FILE (one per line), instead of --input.")
+      .metavar("PATH");
+
+  parser.add_option("-m", "--manifest")
+      .type("string")
+      .action("store")
+      .help("Required for --batch. Results are added to FILE as one JSON object per line, and "
+            "images that it lists as converted are skipped, so that a batch can be resumed.")
+      .metavar("FILE");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of images to convert at once with --batch. Default is 2.")
+      .set_default(2);
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Number of compression threads shared by all images with --batch. Default is the "
+            "number of CPU threads.");
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -119,13 +400,23 @@ int ConvertCommand(const std::vector<std::string>& args)
 
   // Validate options
 
-  // --input
-  if (!options.is_set("input"))
+  // --input, --batch
+  const bool batch = options.is_set("batch");
+  if (!options.is_set("input") && !batch)
   {
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  if (options.is_set("input") && batch)
+  {
+    fmt::print(std::cerr, "Error: --input and --batch can't be used together\n");
+    return EXIT_FAILURE;
+  }
+  if (batch && !options.is_set("manifest"))
+  {
+    fmt::print(std::cerr, "Error: No manifest set\n");
+    return EXIT_FAILURE;
+  }
 
   // --output
   if (!options.is_set("output"))
@@ -144,73 +435,6 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
-  // --scrub
-  const bool scrub = static_cast<bool>(options.get("scrub"));
-
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
-  if (scrub && format == DiscIO::BlobType::RVZ)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
-                          "advantages. Continuing anyway.\n");
-  }
-
-  if (scrub && format == DiscIO::BlobType::PLAIN)
-  {
-    fmt::print(std::cerr, "Warning: Scrubbing does not save space when converting to ISO unless "
-                          "using external compression. Continuing anyway.\n");
-  }
-
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
@@ -237,15 +461,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,58 +511,55 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
-
-  bool success = false;
+  const ConversionSettings settings{format, static_cast<bool>(options.get("scrub")), block_size_o,
+                                    compression_o, compression_level_o};
 
-  switch (format)
+  if (batch)
   {
-  case DiscIO::BlobType::PLAIN:
-  {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
-  }
+    const std::optional<std::vector<BatchInput>> inputs = FindBatchInputs(options["batch"]);
+    if (!inputs)
+    {
+      fmt::print(std::cerr, "Error: Could not read {}\n", options["batch"]);
+      return EXIT_FAILURE;
+    }
 
-  case DiscIO::BlobType::GCZ:
-  {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    BatchManifest manifest;
+    if (!manifest.Open(options["manifest"]))
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: Could not open the manifest\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
-  }
+    // Share the compression threads between all the images being converted at once, instead
+    // of giving each of them a thread per CPU core
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    if (options.is_set("threads"))
+      threads = static_cast<int>(options.get("threads"));
+    const int jobs = static_cast<int>(options.get("jobs"));
+    if (threads < 1 || jobs < 1)
+    {
+      fmt::print(std::cerr, "Error: The number of jobs and threads must be at least 1\n");
+      return EXIT_FAILURE;
+    }
+    DiscIO::CompressionThreadBudget::SetThreads(static_cast<size_t>(threads));
 
-  default:
-  {
-    ASSERT(false);
-    break;
-  }
+    const bool success = ConvertBatch(*inputs, output_file_path, settings,
+                                      static_cast<u32>(jobs), &manifest);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
-  if (!success)
+  const std::string& input_file_path = options["input"];
+
+  DiscIO::ConversionStats stats;
+  if (!ConvertFile(input_file_path, output_file_path, settings, &stats))
   {
     fmt::print(std::cerr, "Error: Conversion failed\n");
     return EXIT_FAILURE;
   }
 
+  if (static_cast<bool>(options.get("stats")) && stats.threads != 0)
+    PrintConversionStats(stats);
+
   return EXIT_SUCCESS;
 }
 }  // namespace DolphinTool
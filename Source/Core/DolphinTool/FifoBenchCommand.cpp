@@ -0,0 +1,257 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FifoBenchCommand.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/IOFile.h"
+#include "Common/ScopeGuard.h"
+#include "Common/WindowSystemInfo.h"
+#include "Core/Boot/Boot.h"
+#include "Core/BootManager.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/GPUStageTimings.h"
+
+namespace DolphinTool
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+struct BenchmarkState
+{
+  u32 warmup_loops = 0;
+  u32 loops = 0;
+
+  // Written by the CPU thread, read once done is set.
+  u32 loop_starts = 0;
+  Clock::time_point start;
+  Clock::time_point end;
+  std::vector<double> loop_seconds;
+  VideoCommon::GPUStageTimingMap timings;
+  std::atomic<bool> done = false;
+};
+
+// Called by the FIFO player on the CPU thread before each frame is written.
+void OnFrameWritten(BenchmarkState* state)
+{
+  const FifoPlayer& player = FifoPlayer::GetInstance();
+  if (state->done.load(std::memory_order_relaxed) ||
+      player.GetCurrentFrameNum() != player.GetFrameRangeStart())
+  {
+    return;
+  }
+
+  const u32 loop = state->loop_starts++;
+  if (loop < state->warmup_loops)
+    return;
+
+  const Clock::time_point now = Clock::now();
+  if (loop == state->warmup_loops)
+  {
+    VideoCommon::GPUStageTimings::Reset();
+    state->start = now;
+    state->end = now;
+    return;
+  }
+
+  state->loop_seconds.push_back(std::chrono::duration<double>(now - state->end).count());
+  state->end = now;
+
+  if (loop == state->warmup_loops + state->loops)
+  {
+    state->timings = VideoCommon::GPUStageTimings::Get();
+    state->done.store(true, std::memory_order_release);
+  }
+}
+
+picojson::value StageToJSON(const VideoCommon::GPUStageTiming& timing)
+{
+  picojson::object json;
+  json["calls"] = picojson::value(static_cast<double>(timing.count));
+  json["seconds"] = picojson::value(std::chrono::duration<double>(timing.time).count());
+  return picojson::value(json);
+}
+}  // namespace
+
+int FifoBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: fifobench [options]...");
+  parser.description("Plays a FIFO log (.dff) without a window and prints how much time was "
+                     "spent in each stage of GPU command processing as JSON.");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the FIFO log FILE.")
+      .metavar("FILE");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Write the results to FILE instead of the standard output.")
+      .metavar("FILE");
+
+  parser.add_option("-b", "--backend")
+      .type("string")
+      .action("store")
+      .help("Video backend to use for drawing. Default is null. [%choices]")
+      .choices({"null", "software"})
+      .set_default("null");
+
+  parser.add_option("-n", "--loops")
+      .type("int")
+      .action("store")
+      .help("Number of times to play the log. Default is 5.")
+      .set_default(5);
+
+  parser.add_option("-w", "--warmup")
+      .type("int")
+      .action("store")
+      .help("Number of times to play the log before measuring, so that shaders and textures are "
+            "already cached. Default is 1.")
+      .set_default(1);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  const int loops = static_cast<int>(options.get("loops"));
+  const int warmup_loops = static_cast<int>(options.get("warmup"));
+  if (loops < 1 || warmup_loops < 0)
+  {
+    fmt::print(std::cerr, "Error: Invalid number of loops\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string backend =
+      options["backend"] == "software" ? "Software Renderer" : std::string("Null");
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+  Common::ScopeGuard ui_common_guard([] { UICommon::Shutdown(); });
+
+  // Run the GPU on the CPU thread so that frame boundaries line up with the work done for them,
+  // and don't limit the speed to that of the console.
+  Config::SetCurrent(Config::MAIN_GFX_BACKEND, backend);
+  Config::SetCurrent(Config::MAIN_AUDIO_BACKEND, std::string(BACKEND_NULLSOUND));
+  Config::SetCurrent(Config::MAIN_CPU_THREAD, false);
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+
+  BenchmarkState state;
+  state.warmup_loops = static_cast<u32>(warmup_loops);
+  state.loops = static_cast<u32>(loops);
+
+  VideoCommon::GPUStageTimings::SetEnabled(true);
+  FifoPlayer& player = FifoPlayer::GetInstance();
+  player.SetFrameWrittenCallback([&state] { OnFrameWritten(&state); });
+  Common::ScopeGuard player_guard([&player] {
+    player.SetFrameWrittenCallback(nullptr);
+    VideoCommon::GPUStageTimings::SetEnabled(false);
+  });
+
+  WindowSystemInfo wsi;
+  wsi.type = WindowSystemType::Headless;
+  if (!BootManager::BootCore(BootParameters::GenerateFromFile(input_file_path), wsi))
+  {
+    fmt::print(std::cerr, "Error: Could not play {}\n", input_file_path);
+    return EXIT_FAILURE;
+  }
+
+  while (!state.done.load(std::memory_order_acquire) &&
+         Core::GetState() != Core::State::Uninitialized)
+  {
+    Core::HostDispatchJobs();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  Core::Stop();
+  Core::Shutdown();
+
+  if (!state.done.load(std::memory_order_acquire))
+  {
+    fmt::print(std::cerr, "Error: Playback of {} stopped early\n", input_file_path);
+    return EXIT_FAILURE;
+  }
+
+  const u32 frames_per_loop = player.GetFrameRangeEnd() - player.GetFrameRangeStart() + 1;
+  const double seconds = std::chrono::duration<double>(state.end - state.start).count();
+  const VideoCommon::GPUStageTiming& draws = state.timings[VideoCommon::GPUStage::Draw];
+
+  picojson::array loop_seconds;
+  for (const double s : state.loop_seconds)
+    loop_seconds.emplace_back(s);
+
+  picojson::object stages;
+  stages["command_processing"] =
+      StageToJSON(state.timings[VideoCommon::GPUStage::CommandProcessing]);
+  stages["vertex_loading"] = StageToJSON(state.timings[VideoCommon::GPUStage::VertexLoading]);
+  stages["texture_loading"] = StageToJSON(state.timings[VideoCommon::GPUStage::TextureLoading]);
+  stages["shader_uids"] = StageToJSON(state.timings[VideoCommon::GPUStage::ShaderUids]);
+  stages["pipeline_lookup"] = StageToJSON(state.timings[VideoCommon::GPUStage::PipelineLookup]);
+  stages["draw"] = StageToJSON(draws);
+
+  picojson::object json;
+  json["file"] = picojson::value(input_file_path);
+  json["backend"] = picojson::value(backend);
+  json["loops"] = picojson::value(static_cast<double>(loops));
+  json["warmup_loops"] = picojson::value(static_cast<double>(warmup_loops));
+  json["frames_per_loop"] = picojson::value(static_cast<double>(frames_per_loop));
+  json["seconds"] = picojson::value(seconds);
+  json["loop_seconds"] = picojson::value(loop_seconds);
+  json["frames_per_second"] = picojson::value(frames_per_loop * loops / seconds);
+  json["draws"] = picojson::value(static_cast<double>(draws.count));
+  json["draws_per_second"] = picojson::value(draws.count / seconds);
+  json["stages"] = picojson::value(stages);
+
+  const std::string result = picojson::value(json).serialize(true);
+  if (!options.is_set("output"))
+  {
+    std::cout << result;
+    return EXIT_SUCCESS;
+  }
+
+  const std::string& output_file_path = options["output"];
+  File::IOFile file(output_file_path, "wb");
+  if (!file.WriteString(result))
+  {
+    fmt::print(std::cerr, "Error: Could not write {}\n", output_file_path);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
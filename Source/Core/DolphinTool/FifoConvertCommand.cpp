@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FifoConvertCommand.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileUtil.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+namespace DolphinTool
+{
+int FifoConvertCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: fifoconvert [options]...");
+  parser.description("Rewrites a FIFO log (.dff) of any version in the current format, which "
+                     "compresses frames and stores repeated memory updates only once.");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to the FIFO log FILE.")
+      .metavar("FILE");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the destination FILE.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  if (!options.is_set("output"))
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& output_file_path = options["output"];
+
+  // Frames are read from the input while the output is written.
+  if (input_file_path == output_file_path)
+  {
+    fmt::print(std::cerr, "Error: The input and output must be different files\n");
+    return EXIT_FAILURE;
+  }
+
+  if (!FifoDataFile::Convert(input_file_path, output_file_path))
+  {
+    fmt::print(std::cerr, "Error: Conversion failed\n");
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Converted {} ({} bytes) to {} ({} bytes)\n", input_file_path,
+             File::GetSize(input_file_path), output_file_path, File::GetSize(output_file_path));
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
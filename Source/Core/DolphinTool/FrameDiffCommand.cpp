@@ -0,0 +1,167 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/FrameDiffCommand.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Image.h"
+#include "VideoCommon/FrameDumpArchive.h"
+
+namespace DolphinTool
+{
+namespace
+{
+// Same convention as diff(1)
+constexpr int EXIT_SAME = 0;
+constexpr int EXIT_DIFFERENT = 1;
+constexpr int EXIT_ERROR = 2;
+
+bool WriteImages(const std::string& directory, size_t index, u32 width, u32 height,
+                 const std::vector<u8>& first, const std::vector<u8>& second)
+{
+  // Differences are amplified so that small ones are still visible.
+  std::vector<u8> difference(first.size());
+  for (size_t i = 0; i < first.size(); ++i)
+    difference[i] = static_cast<u8>(std::min(std::abs(first[i] - second[i]) * 8, 255));
+
+  const std::string prefix = fmt::format("{}/frame_{}", directory, index);
+  const u32 stride = width * 3;
+  return Common::SavePNG(prefix + "_first.png", first.data(), Common::ImageByteFormat::RGB, width,
+                         height, stride, 1) &&
+         Common::SavePNG(prefix + "_second.png", second.data(), Common::ImageByteFormat::RGB,
+                         width, height, stride, 1) &&
+         Common::SavePNG(prefix + "_diff.png", difference.data(), Common::ImageByteFormat::RGB,
+                         width, height, stride, 1);
+}
+}  // namespace
+
+int FrameDiffCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: framediff [options]... FIRST SECOND");
+  parser.description("Compares two frame dump archives (.dfa) frame by frame. Exits with 0 if "
+                     "they match, 1 if they differ and 2 on errors.");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Optional. Write both versions of each differing frame and their difference as PNG "
+            "images to DIRECTORY.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-q", "--quiet")
+      .action("store_true")
+      .help("Optional. Only print the summary.");
+
+  const optparse::Values& options = parser.parse_args(args);
+  const std::vector<std::string> paths = parser.args();
+
+  // Validate options
+  if (paths.size() != 2)
+  {
+    fmt::print(std::cerr, "Error: Expected two frame dumps\n");
+    return EXIT_ERROR;
+  }
+
+  const std::string& output_directory = options["output"];
+  const bool quiet = options.is_set_by_user("quiet");
+
+  std::unique_ptr<VideoCommon::FrameDumpArchive> first =
+      VideoCommon::FrameDumpArchive::Open(paths[0]);
+  std::unique_ptr<VideoCommon::FrameDumpArchive> second =
+      VideoCommon::FrameDumpArchive::Open(paths[1]);
+  if (!first || !second)
+  {
+    fmt::print(std::cerr, "Error: Unable to open {}\n", first ? paths[1] : paths[0]);
+    return EXIT_ERROR;
+  }
+
+  if (!output_directory.empty() && !File::CreateFullPath(output_directory + "/"))
+  {
+    fmt::print(std::cerr, "Error: Unable to create {}\n", output_directory);
+    return EXIT_ERROR;
+  }
+
+  const auto& first_frames = first->GetFrames();
+  const auto& second_frames = second->GetFrames();
+  const size_t count = std::min(first_frames.size(), second_frames.size());
+
+  // Frames with equal hashes are taken as identical, only the others are decompressed to find
+  // out how much they differ.
+  size_t different_frames = 0;
+  std::vector<u8> first_pixels;
+  std::vector<u8> second_pixels;
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto& a = first_frames[i];
+    const auto& b = second_frames[i];
+    if (a.width == b.width && a.height == b.height && a.hash == b.hash)
+      continue;
+
+    ++different_frames;
+    if (a.width != b.width || a.height != b.height)
+    {
+      if (!quiet)
+      {
+        fmt::print(std::cout, "Frame {} (#{}): size {}x{} vs {}x{}\n", i, a.frame_number, a.width,
+                   a.height, b.width, b.height);
+      }
+      continue;
+    }
+
+    if (quiet && output_directory.empty())
+      continue;
+
+    if (!first->ReadFrame(i, &first_pixels) || !second->ReadFrame(i, &second_pixels))
+    {
+      fmt::print(std::cerr, "Error: Unable to read frame {}\n", i);
+      return EXIT_ERROR;
+    }
+
+    size_t different_pixels = 0;
+    int largest_difference = 0;
+    for (size_t pixel = 0; pixel < first_pixels.size(); pixel += 3)
+    {
+      int difference = 0;
+      for (size_t channel = pixel; channel < pixel + 3; ++channel)
+        difference = std::max(difference, std::abs(first_pixels[channel] - second_pixels[channel]));
+      different_pixels += difference != 0;
+      largest_difference = std::max(largest_difference, difference);
+    }
+
+    if (!quiet)
+    {
+      fmt::print(std::cout, "Frame {} (#{}): {} of {} pixels differ, by up to {}\n", i,
+                 a.frame_number, different_pixels, first_pixels.size() / 3, largest_difference);
+    }
+
+    if (!output_directory.empty() &&
+        !WriteImages(output_directory, i, a.width, a.height, first_pixels, second_pixels))
+    {
+      fmt::print(std::cerr, "Error: Unable to write the images of frame {}\n", i);
+      return EXIT_ERROR;
+    }
+  }
+
+  fmt::print(std::cout, "{} of {} frames differ\n", different_frames, count);
+  if (first_frames.size() != second_frames.size())
+  {
+    fmt::print(std::cout, "The dumps have a different number of frames: {} vs {}\n",
+               first_frames.size(), second_frames.size());
+  }
+
+  const bool same = different_frames == 0 && first_frames.size() == second_frames.size();
+  return same ? EXIT_SAME : EXIT_DIFFERENT;
+}
+}  // namespace DolphinTool
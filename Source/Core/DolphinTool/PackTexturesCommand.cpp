@@ -0,0 +1,122 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/PackTexturesCommand.h"
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileSearch.h"
+#include "Common/StringUtil.h"
+#include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TexturePackLibrary.h"
+
+namespace DolphinTool
+{
+int PackTexturesCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: packtextures [options]...");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to a custom texture DIRECTORY, searched recursively.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Path to the texture pack FILE to write. Should end in .dtp to be found by Dolphin.")
+      .metavar("FILE");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  const std::string& input_directory = options["input"];
+  if (input_directory.empty())
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+
+  const std::string& output_file_path = options["output"];
+  if (output_file_path.empty())
+  {
+    fmt::print(std::cerr, "Error: No output set\n");
+    return EXIT_FAILURE;
+  }
+
+  // Use the same naming rules as HiresTexture::Update, additional mip levels are picked up by
+  // the library when loading the base level
+  std::map<std::string, std::string> textures;
+  for (const std::string& path :
+       Common::DoFileSearch({input_directory}, {".png", ".dds"}, /*recursive*/ true))
+  {
+    std::string filename;
+    SplitPath(path, nullptr, &filename, nullptr);
+    if (!filename.starts_with("tex1_") || filename.find("_mip") != std::string::npos)
+      continue;
+
+    if (!textures.try_emplace(filename, path).second)
+      fmt::print(std::cerr, "Warning: Skipping duplicate texture '{}'\n", path);
+  }
+
+  if (textures.empty())
+  {
+    fmt::print(std::cerr, "Error: No custom textures found in '{}'\n", input_directory);
+    return EXIT_FAILURE;
+  }
+
+  VideoCommon::TexturePackLibrary::Writer writer;
+  if (!writer.Open(output_file_path))
+  {
+    fmt::print(std::cerr, "Error: Unable to open output file '{}'\n", output_file_path);
+    return EXIT_FAILURE;
+  }
+
+  VideoCommon::DirectFilesystemAssetLibrary library;
+  size_t num_packed = 0;
+  for (const auto& [filename, path] : textures)
+  {
+    VideoCommon::TexturePackLibrary::TextureInfo info{filename};
+    const size_t arb_index = info.asset_id.rfind("_arb");
+    info.has_arbitrary_mipmaps = arb_index != std::string::npos;
+    if (info.has_arbitrary_mipmaps)
+      info.asset_id.erase(arb_index, 4);
+
+    library.SetAssetIDMapData(info.asset_id, {{"texture", StringToPath(path)}});
+
+    VideoCommon::TextureData data;
+    if (library.LoadGameTexture(info.asset_id, &data).m_bytes_loaded == 0)
+    {
+      fmt::print(std::cerr, "Warning: Unable to load texture '{}'\n", path);
+      continue;
+    }
+
+    if (!writer.AddTexture(info, data.m_texture))
+    {
+      fmt::print(std::cerr, "Error: Unable to write to output file '{}'\n", output_file_path);
+      return EXIT_FAILURE;
+    }
+    ++num_packed;
+  }
+
+  if (!writer.Finish())
+  {
+    fmt::print(std::cerr, "Error: Unable to write to output file '{}'\n", output_file_path);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Packed {} of {} textures\n", num_packed, textures.size());
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
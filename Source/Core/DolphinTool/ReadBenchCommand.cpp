@@ -0,0 +1,208 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/ReadBenchCommand.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+#include <picojson.h>
+
+#include "Common/Align.h"
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+#include "DiscIO/VolumeWii.h"
+#include "UICommon/UICommon.h"
+
+namespace DolphinTool
+{
+int ReadBenchCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: readbench [options]...");
+  parser.description("Reads random ranges of a disc image the way the emulated disc drive does "
+                     "and prints how long the reads took as JSON. For Wii discs, the reads are "
+                     "done from the encrypted game partition, so formats that store Wii data "
+                     "decrypted (like RVZ) have to encrypt it again.");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path, required for temporary processing files. "
+            "Will be automatically created if this option is not set.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("store")
+      .help("Path to disc image FILE.")
+      .metavar("FILE");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Write the results to FILE instead of the standard output.")
+      .metavar("FILE");
+
+  parser.add_option("-n", "--reads")
+      .type("int")
+      .action("store")
+      .help("Number of reads. Default is 1000.")
+      .set_default(1000);
+
+  parser.add_option("-s", "--size")
+      .type("int")
+      .action("store")
+      .help("Size of each read in bytes. Default is 32768.")
+      .set_default(32768);
+
+  parser.add_option("-r", "--range")
+      .type("int")
+      .action("store")
+      .help("Only read from the first MIB mebibytes of the disc or partition, to measure how well "
+            "reads that are close to each other are cached. Default is 0, the whole disc.")
+      .metavar("MIB")
+      .set_default(0);
+
+  parser.add_option("--seed")
+      .type("int")
+      .action("store")
+      .help("Seed for choosing the read offsets. Default is 0.")
+      .set_default(0);
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  // Validate options
+  if (!options.is_set("input"))
+  {
+    fmt::print(std::cerr, "Error: No input set\n");
+    return EXIT_FAILURE;
+  }
+  const std::string& input_file_path = options["input"];
+
+  const int reads = static_cast<int>(options.get("reads"));
+  const int read_size = static_cast<int>(options.get("size"));
+  const int range_mib = static_cast<int>(options.get("range"));
+  if (reads < 1 || read_size < 1 || range_mib < 0)
+  {
+    fmt::print(std::cerr, "Error: The number of reads and the read size must be at least 1\n");
+    return EXIT_FAILURE;
+  }
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+
+  // The volume is only used for finding the area to read from. The reads go straight to the blob,
+  // so that they aren't decrypted again by the volume.
+  const std::unique_ptr<DiscIO::VolumeDisc> volume = DiscIO::CreateDisc(input_file_path);
+  std::unique_ptr<DiscIO::BlobReader> blob = DiscIO::CreateBlobReader(input_file_path);
+  if (!volume || !blob)
+  {
+    fmt::print(std::cerr, "Error: Unable to open disc image\n");
+    return EXIT_FAILURE;
+  }
+
+  u64 area_offset = 0;
+  u64 area_size = blob->GetDataSize();
+  const DiscIO::Partition partition = volume->GetGamePartition();
+  const bool encrypted = volume->HasWiiEncryption() && partition != DiscIO::PARTITION_NONE;
+  if (encrypted)
+  {
+    const std::optional<u64> data_offset =
+        volume->ReadSwappedAndShifted(partition.offset + 0x2b8, DiscIO::PARTITION_NONE);
+    const std::optional<u64> data_size =
+        volume->ReadSwappedAndShifted(partition.offset + 0x2bc, DiscIO::PARTITION_NONE);
+    if (!data_offset || !data_size)
+    {
+      fmt::print(std::cerr, "Error: Unable to read the partition header\n");
+      return EXIT_FAILURE;
+    }
+    area_offset = partition.offset + *data_offset;
+    area_size = std::min(*data_size, area_size - std::min(area_size, area_offset));
+  }
+  if (range_mib != 0)
+    area_size = std::min<u64>(area_size, static_cast<u64>(range_mib) * 1024 * 1024);
+
+  if (area_size < static_cast<u64>(read_size))
+  {
+    fmt::print(std::cerr, "Error: The read size is larger than the area to read from\n");
+    return EXIT_FAILURE;
+  }
+
+  // Reads start at block boundaries, like the reads IOS makes for Wii discs
+  std::mt19937_64 rng(static_cast<u64>(static_cast<int>(options.get("seed"))));
+  std::uniform_int_distribution<u64> distribution(0, area_size - read_size);
+
+  std::vector<u8> buffer(read_size);
+  std::vector<double> read_seconds;
+  read_seconds.reserve(reads);
+
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point start = Clock::now();
+  for (int i = 0; i < reads; ++i)
+  {
+    const u64 offset =
+        area_offset + Common::AlignDown(distribution(rng), DiscIO::VolumeWii::BLOCK_TOTAL_SIZE);
+
+    const Clock::time_point read_start = Clock::now();
+    if (!blob->Read(offset, buffer.size(), buffer.data()))
+    {
+      fmt::print(std::cerr, "Error: Reading {} bytes at {:#x} failed\n", buffer.size(), offset);
+      return EXIT_FAILURE;
+    }
+    read_seconds.push_back(std::chrono::duration<double>(Clock::now() - read_start).count());
+  }
+  const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::sort(read_seconds.begin(), read_seconds.end());
+  const auto percentile = [&read_seconds](double p) {
+    return read_seconds[static_cast<size_t>(p * (read_seconds.size() - 1))];
+  };
+
+  picojson::object json;
+  json["file"] = picojson::value(input_file_path);
+  json["format"] = picojson::value(DiscIO::GetName(blob->GetBlobType(), false));
+  json["encrypted"] = picojson::value(encrypted);
+  json["reads"] = picojson::value(static_cast<double>(reads));
+  json["read_size"] = picojson::value(static_cast<double>(read_size));
+  json["range"] = picojson::value(static_cast<double>(area_size));
+  json["seconds"] = picojson::value(seconds);
+  json["reads_per_second"] = picojson::value(reads / seconds);
+  json["mib_per_second"] = picojson::value(static_cast<double>(reads) * read_size / seconds /
+                                           (1024 * 1024));
+  json["median_read_seconds"] = picojson::value(percentile(0.5));
+  json["p99_read_seconds"] = picojson::value(percentile(0.99));
+  json["max_read_seconds"] = picojson::value(read_seconds.back());
+
+  const std::string result = picojson::value(json).serialize(true);
+  if (!options.is_set("output"))
+  {
+    std::cout << result;
+    return EXIT_SUCCESS;
+  }
+
+  const std::string& output_file_path = options["output"];
+  File::IOFile file(output_file_path, "wb");
+  if (!file.WriteString(result))
+  {
+    fmt::print(std::cerr, "Error: Could not write {}\n", output_file_path);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
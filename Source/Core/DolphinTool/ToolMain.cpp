@@ -17,14 +17,20 @@
 #include "Core/Core.h"
 
 #include "DolphinTool/ConvertCommand.h"
+#include "DolphinTool/FifoBenchCommand.h"
+#include "DolphinTool/FifoConvertCommand.h"
+#include "DolphinTool/FrameDiffCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/PackTexturesCommand.h"
+#include "DolphinTool/ReadBenchCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header]\n");
+                        "commands supported: [convert, verify, header, packtextures, framediff, "
+                        "fifoconvert, fifobench, readbench]\n");
 }
 
 #ifdef _WIN32
@@ -51,6 +57,16 @@ int main(int argc, char* argv[])
     return DolphinTool::VerifyCommand(args);
   else if (command_str == "header")
     return DolphinTool::HeaderCommand(args);
+  else if (command_str == "packtextures")
+    return DolphinTool::PackTexturesCommand(args);
+  else if (command_str == "framediff")
+    return DolphinTool::FrameDiffCommand(args);
+  else if (command_str == "fifoconvert")
+    return DolphinTool::FifoConvertCommand(args);
+  else if (command_str == "fifobench")
+    return DolphinTool::FifoBenchCommand(args);
+  else if (command_str == "readbench")
+    return DolphinTool::ReadBenchCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
@@ -4,16 +4,19 @@
 #include "DolphinTool/VerifyCommand.h"
 
 #include <cstdlib>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <picojson.h>
 
 #include "Common/StringUtil.h"
 #include "DiscIO/VolumeDisc.h"
 #include "DiscIO/VolumeVerifier.h"
+#include "DolphinTool/BatchProcessing.h"
 #include "UICommon/UICommon.h"
 
 namespace DolphinTool
@@ -29,6 +32,64 @@ static std::string HashToHexString(const std::vector<u8>& hash)
   return ss.str();
 }
 
+static const char* GetSeverityString(DiscIO::VolumeVerifier::Severity severity)
+{
+  switch (severity)
+  {
+  case DiscIO::VolumeVerifier::Severity::Low:
+    return "Low";
+  case DiscIO::VolumeVerifier::Severity::Medium:
+    return "Medium";
+  case DiscIO::VolumeVerifier::Severity::High:
+    return "High";
+  case DiscIO::VolumeVerifier::Severity::None:
+    return "None";
+  default:
+    ASSERT(false);
+    return "";
+  }
+}
+
+static std::optional<DiscIO::VolumeVerifier::Result>
+VerifyFile(const std::string& input_file_path, const DiscIO::Hashes<bool>& hashes_to_calculate)
+{
+  // Open the volume
+  const std::unique_ptr<DiscIO::VolumeDisc> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+    return std::nullopt;
+
+  // Verify the volume
+  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  {
+    verifier.Process();
+  }
+  verifier.Finish();
+  return verifier.GetResult();
+}
+
+static void AddResultToManifestEntry(const DiscIO::VolumeVerifier::Result& result,
+                                     picojson::object* entry)
+{
+  if (!result.hashes.crc32.empty())
+    (*entry)["crc32"] = picojson::value(HashToHexString(result.hashes.crc32));
+  if (!result.hashes.md5.empty())
+    (*entry)["md5"] = picojson::value(HashToHexString(result.hashes.md5));
+  if (!result.hashes.sha1.empty())
+    (*entry)["sha1"] = picojson::value(HashToHexString(result.hashes.sha1));
+
+  picojson::array problems;
+  for (const auto& problem : result.problems)
+  {
+    picojson::object problem_object;
+    problem_object["severity"] = picojson::value(GetSeverityString(problem.severity));
+    problem_object["text"] = picojson::value(problem.text);
+    problems.emplace_back(std::move(problem_object));
+  }
+  (*entry)["problems"] = picojson::value(std::move(problems));
+}
+
 static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
 {
   if (!result.hashes.crc32.empty())
@@ -50,25 +111,7 @@ static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
 
   for (const auto& problem : result.problems)
   {
-    fmt::print(std::cout, "\nSeverity: ");
-    switch (problem.severity)
-    {
-    case DiscIO::VolumeVerifier::Severity::Low:
-      fmt::print(std::cout, "Low");
-      break;
-    case DiscIO::VolumeVerifier::Severity::Medium:
-      fmt::print(std::cout, "Medium");
-      break;
-    case DiscIO::VolumeVerifier::Severity::High:
-      fmt::print(std::cout, "High");
-      break;
-    case DiscIO::VolumeVerifier::Severity::None:
-      fmt::print(std::cout, "None");
-      break;
-    default:
-      ASSERT(false);
-      break;
-    }
+    fmt::print(std::cout, "\nSeverity: {}", GetSeverityString(problem.severity));
     fmt::print(std::cout, "\nSummary: {}\n\n", problem.text);
   }
 }
@@ -99,6 +142,26 @@ int VerifyCommand(const std::vector<std::string>& args)
             "[%choices]")
       .choices({"crc32", "md5", "sha1"});
 
+  parser.add_option("--batch")
+      .type("string")
+      .action("store")
+      .help("Verify all disc images in DIRECTORY and its subdirectories, or all the images listed "
+            "in a text FILE (one per line), instead of --input.")
+      .metavar("PATH");
+
+  parser.add_option("-m", "--manifest")
+      .type("string")
+      .action("store")
+      .help("Required for --batch. Results are added to FILE as one JSON object per line, and "
+            "images that it lists as verified are skipped, so that a batch can be resumed.")
+      .metavar("FILE");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of images to verify at once with --batch. Default is 2.")
+      .set_default(2);
+
   const optparse::Values& options = parser.parse_args(args);
 
   // Initialize the dolphin user directory, required for temporary processing files
@@ -107,12 +170,22 @@ int VerifyCommand(const std::vector<std::string>& args)
   UICommon::Init();
 
   // Validate options
-  if (!options.is_set("input"))
+  const bool batch = options.is_set("batch");
+  if (!options.is_set("input") && !batch)
   {
     fmt::print(std::cerr, "Error: No input set\n");
     return EXIT_FAILURE;
   }
-  const std::string& input_file_path = options["input"];
+  if (options.is_set("input") && batch)
+  {
+    fmt::print(std::cerr, "Error: --input and --batch can't be used together\n");
+    return EXIT_FAILURE;
+  }
+  if (batch && !options.is_set("manifest"))
+  {
+    fmt::print(std::cerr, "Error: No manifest set\n");
+    return EXIT_FAILURE;
+  }
 
   DiscIO::Hashes<bool> hashes_to_calculate{};
   const bool algorithm_is_set = options.is_set("algorithm");
@@ -138,23 +211,52 @@ int VerifyCommand(const std::vector<std::string>& args)
     return EXIT_FAILURE;
   }
 
-  // Open the volume
-  const std::unique_ptr<DiscIO::VolumeDisc> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
+  if (batch)
   {
-    fmt::print(std::cerr, "Error: Unable to open disc image\n");
-    return EXIT_FAILURE;
+    const std::optional<std::vector<BatchInput>> inputs = FindBatchInputs(options["batch"]);
+    if (!inputs)
+    {
+      fmt::print(std::cerr, "Error: Could not read {}\n", options["batch"]);
+      return EXIT_FAILURE;
+    }
+
+    BatchManifest manifest;
+    if (!manifest.Open(options["manifest"]))
+    {
+      fmt::print(std::cerr, "Error: Could not open the manifest\n");
+      return EXIT_FAILURE;
+    }
+
+    const int jobs = static_cast<int>(options.get("jobs"));
+    if (jobs < 1)
+    {
+      fmt::print(std::cerr, "Error: The number of jobs must be at least 1\n");
+      return EXIT_FAILURE;
+    }
+
+    // An image counts as done once it has been verified, even if problems were found in it
+    const bool success = RunBatch(
+        *inputs, static_cast<u32>(jobs), &manifest,
+        [&](const BatchInput& input, picojson::object* entry) {
+          const std::optional<DiscIO::VolumeVerifier::Result> result =
+              VerifyFile(input.path, hashes_to_calculate);
+          if (!result)
+            return false;
+
+          AddResultToManifestEntry(*result, entry);
+          return true;
+        });
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
   }
 
-  // Verify the volume
-  DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
-  verifier.Start();
-  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+  const std::optional<DiscIO::VolumeVerifier::Result> result_o =
+      VerifyFile(options["input"], hashes_to_calculate);
+  if (!result_o)
   {
-    verifier.Process();
+    fmt::print(std::cerr, "Error: Unable to open disc image\n");
+    return EXIT_FAILURE;
   }
-  verifier.Finish();
-  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+  const DiscIO::VolumeVerifier::Result& result = *result_o;
 
   // Print the report
   if (!algorithm_is_set)
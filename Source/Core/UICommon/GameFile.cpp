@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -63,6 +64,19 @@ bool UseGameCovers()
   return Config::Get(Config::MAIN_USE_GAME_COVERS);
 #endif
 }
+
+void GetHostFileStamp(const std::string& path, u64* size, s64* time)
+{
+  const std::filesystem::path fs_path = StringToPath(path);
+
+  std::error_code error;
+  *size = std::filesystem::file_size(fs_path, error);
+  if (error)
+    *size = 0;
+
+  const auto last_write_time = std::filesystem::last_write_time(fs_path, error);
+  *time = error ? 0 : static_cast<s64>(last_write_time.time_since_epoch().count());
+}
 }  // Anonymous namespace
 
 DiscIO::Language GameFile::GetConfigLanguage() const
@@ -104,6 +118,7 @@ GameFile::GameFile() = default;
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  GetHostFileStamp(m_file_path, &m_host_file_size, &m_host_file_time);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -197,6 +212,14 @@ bool GameFile::IsValid() const
   return true;
 }
 
+bool GameFile::HostFileChanged() const
+{
+  u64 size;
+  s64 time;
+  GetHostFileStamp(m_file_path, &size, &time);
+  return size != m_host_file_size || time != m_host_file_time;
+}
+
 bool GameFile::CustomCoverChanged()
 {
   if (!m_custom_cover.buffer.empty() || !UseGameCovers())
@@ -295,6 +318,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_valid);
   p.Do(m_file_path);
   p.Do(m_file_name);
+  p.Do(m_host_file_size);
+  p.Do(m_host_file_time);
 
   p.Do(m_file_size);
   p.Do(m_volume_size);
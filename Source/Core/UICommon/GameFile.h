@@ -57,6 +57,8 @@ public:
   ~GameFile();
 
   bool IsValid() const;
+  // Returns true if the size or modification time of the file has changed since it was scanned.
+  bool HostFileChanged() const;
   const std::string& GetFilePath() const { return m_file_path; }
   const std::string& GetFileName() const { return m_file_name; }
   const std::string& GetName(const Core::TitleDatabase& title_database) const;
@@ -142,6 +144,8 @@ private:
   bool m_valid{};
   std::string m_file_path;
   std::string m_file_name;
+  u64 m_host_file_size{};
+  s64 m_host_file_time{};
 
   u64 m_file_size{};
   u64 m_volume_size{};
@@ -5,11 +5,13 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +21,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,7 +29,45 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 24;  // Last changed in PR 11557
+static constexpr u32 CACHE_REVISION = 25;  // Last changed for the append-only cache file
+
+// The cache file is the u32 CACHE_REVISION followed by a log of records. Each record is a u32 size
+// followed by that many bytes: a RecordType, then a GameFile for Add, or the path of a file that
+// was removed from the cache for Remove. A later record for a path replaces the earlier ones.
+enum class RecordType : u8
+{
+  Add = 0,
+  Remove = 1,
+};
+
+// Save rewrites the cache file instead of appending to it once it has more records than this,
+// or than twice the number of cached files, whichever is higher.
+static constexpr size_t MIN_RECORDS_FOR_REWRITE = 64;
+
+static u32 GetScanThreadCount()
+{
+  // Scanning mostly waits for the storage, so it can be worth using every core even when that is
+  // slow. The limit keeps network shares and hard drives from being flooded with requests.
+  return std::clamp<u32>(std::thread::hardware_concurrency(), 1, 16);
+}
+
+template <typename Function>
+static void AppendRecord(std::vector<u8>* buffer, Function do_state)
+{
+  // Measure the size of the record.
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  do_state(p_measure);
+  const u32 record_size = static_cast<u32>(reinterpret_cast<size_t>(ptr));
+
+  // Then actually do the write.
+  const size_t offset = buffer->size();
+  buffer->resize(offset + sizeof(record_size) + record_size);
+  std::memcpy(buffer->data() + offset, &record_size, sizeof(record_size));
+  ptr = buffer->data() + offset + sizeof(record_size);
+  PointerWrap p(&ptr, record_size, PointerWrap::Mode::Write);
+  do_state(p);
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -39,7 +80,11 @@ std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& direct
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
 }
 
-GameFileCache::GameFileCache() : m_path(File::GetUserPath(D_CACHE_IDX) + "gamelist.cache")
+GameFileCache::GameFileCache() : GameFileCache(File::GetUserPath(D_CACHE_IDX) + "gamelist.cache")
+{
+}
+
+GameFileCache::GameFileCache(std::string path) : m_path(std::move(path))
 {
 }
 
@@ -57,7 +102,10 @@ size_t GameFileCache::GetSize() const
 void GameFileCache::Clear(DeleteOnDisk delete_on_disk)
 {
   if (delete_on_disk != DeleteOnDisk::No)
+  {
     File::Delete(m_path);
+    ResetCacheFileState();
+  }
 
   m_cached_files.clear();
 }
@@ -129,23 +177,67 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     m_cached_files.erase(it, m_cached_files.end());
   }
 
-  // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
+  // Now that the previous loop has run, m_cached_files only contains files that are still present
+  // and game_paths only contains paths that aren't in m_cached_files. Rescan the cached files that
+  // have changed on disk and scan the new ones. Opening thousands of files one at a time can take
+  // minutes on slow storage, so this is spread over a pool of threads.
+  std::mutex mutex;
+  std::vector<std::shared_ptr<GameFile>> new_files;
+
+  Common::ThreadPool pool("Game List Scan", GetScanThreadCount() - 1);
+  Common::ThreadPool::WaitGroup group;
+
+  for (std::shared_ptr<GameFile>& cached_file : m_cached_files)
+  {
+    pool.Submit(
+        [&, entry = &cached_file] {
+          if (processing_halted || !(*entry)->HostFileChanged())
+            return;
+
+          auto file = std::make_shared<GameFile>((*entry)->GetFilePath());
+
+          std::lock_guard guard(mutex);
+          if (game_removed_from_cache)
+            game_removed_from_cache((*entry)->GetFilePath());
+
+          if (file->IsValid() && game_added_to_cache)
+            game_added_to_cache(file);
+
+          cache_changed = true;
+          if (file->IsValid())
+            *entry = std::move(file);
+          else
+            entry->reset();
+        },
+        &group);
+  }
+
   for (const std::string& path : game_paths)
   {
-    if (processing_halted)
-      break;
+    pool.Submit(
+        [&, path = &path] {
+          if (processing_halted)
+            return;
+
+          auto file = std::make_shared<GameFile>(*path);
+          if (!file->IsValid())
+            return;
+
+          std::lock_guard guard(mutex);
+          if (game_added_to_cache)
+            game_added_to_cache(file);
+
+          cache_changed = true;
+          new_files.push_back(std::move(file));
+        },
+        &group);
+  }
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+  pool.Wait(group);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
-  }
+  std::erase(m_cached_files, nullptr);
+  m_cached_files.insert(m_cached_files.end(), std::make_move_iterator(new_files.begin()),
+                        std::make_move_iterator(new_files.end()));
 
   return cache_changed;
 }
@@ -153,18 +245,25 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
 bool GameFileCache::UpdateAdditionalMetadata(const GameUpdatedFn& game_updated,
                                              const std::atomic_bool& processing_halted)
 {
-  bool cache_changed = false;
+  std::mutex mutex;
+  std::atomic_bool cache_changed = false;
 
-  for (std::shared_ptr<GameFile>& file : m_cached_files)
-  {
+  Common::ThreadPool pool("Game List Metadata", GetScanThreadCount() - 1);
+  pool.ParallelFor(static_cast<u32>(m_cached_files.size()), [&](u32 i) {
     if (processing_halted)
-      break;
+      return;
 
-    const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
+    std::shared_ptr<GameFile>& file = m_cached_files[i];
+    if (!UpdateAdditionalMetadata(&file))
+      return;
+
+    cache_changed = true;
+    if (game_updated)
+    {
+      std::lock_guard guard(mutex);
       game_updated(file);
-  }
+    }
+  });
 
   return cache_changed;
 }
@@ -208,79 +307,188 @@ bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_fil
 
 bool GameFileCache::Load()
 {
-  return SyncCacheFile(false);
-}
-
-bool GameFileCache::Save()
-{
-  return SyncCacheFile(true);
-}
-
-bool GameFileCache::SyncCacheFile(bool save)
-{
-  const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
+  File::IOFile f(m_path, "rb");
   if (!f)
     return false;
-  bool success = false;
-  if (save)
+
+  std::vector<u8> buffer(f.GetSize());
+  u32 revision = 0;
+  bool success = buffer.size() >= sizeof(revision) && f.ReadBytes(buffer.data(), buffer.size());
+  if (success)
   {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-    DoState(&p_measure);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-    // Then actually do the write.
-    std::vector<u8> buffer(buffer_size);
-    ptr = buffer.data();
-    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-    DoState(&p, buffer_size);
-    if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
+    std::memcpy(&revision, buffer.data(), sizeof(revision));
+    success = revision == CACHE_REVISION;
   }
-  else
+
+  std::vector<std::shared_ptr<GameFile>> files;
+  std::unordered_map<std::string, size_t> indices;
+  size_t records = 0;
+  bool truncated = false;
+
+  size_t offset = sizeof(revision);
+  while (success && offset < buffer.size())
   {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+    // A record that is cut off is left over from a Save that was interrupted. The records before
+    // it are still usable, but the cache file has to be rewritten before anything else is appended.
+    u32 record_size;
+    if (buffer.size() - offset < sizeof(record_size))
+    {
+      truncated = true;
+      break;
+    }
+    std::memcpy(&record_size, buffer.data() + offset, sizeof(record_size));
+    offset += sizeof(record_size);
+    if (buffer.size() - offset < record_size)
+    {
+      truncated = true;
+      break;
+    }
+
+    u8* ptr = buffer.data() + offset;
+    PointerWrap p(&ptr, record_size, PointerWrap::Mode::Read);
+    RecordType type{};
+    p.Do(type);
+
+    std::shared_ptr<GameFile> file;
+    std::string removed_path;
+    if (type == RecordType::Add)
+    {
+      file = std::make_shared<GameFile>();
+      file->DoState(p);
+    }
+    else if (type == RecordType::Remove)
+    {
+      p.Do(removed_path);
+    }
+    else
+    {
+      p.SetMeasureMode();
+    }
+
+    if (!p.IsReadMode())
+    {
+      success = false;
+      break;
+    }
+
+    if (file)
+    {
+      const auto [it, inserted] = indices.emplace(file->GetFilePath(), files.size());
+      if (inserted)
+        files.push_back(std::move(file));
+      else
+        files[it->second] = std::move(file);
+    }
+    else if (const auto it = indices.find(removed_path); it != indices.end())
     {
-      u8* ptr = buffer.data();
-      PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
-      DoState(&p, buffer.size());
-      if (p.IsReadMode())
-        success = true;
+      const size_t index = it->second;
+      indices.erase(it);
+      if (index != files.size() - 1)
+      {
+        files[index] = std::move(files.back());
+        indices[files[index]->GetFilePath()] = index;
+      }
+      files.pop_back();
     }
+
+    offset += record_size;
+    ++records;
   }
+
   if (!success)
   {
     // If some file operation failed, try to delete the probably-corrupted cache
     f.Close();
     File::Delete(m_path);
+    ResetCacheFileState();
+    return false;
   }
-  return success;
+
+  m_cached_files = std::move(files);
+  m_saved_files.clear();
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    m_saved_files.emplace(file->GetFilePath(), file);
+  m_records_in_cache_file = records;
+  m_can_append_to_cache_file = !truncated;
+  return true;
 }
 
-void GameFileCache::DoState(PointerWrap* p, u64 size)
+bool GameFileCache::Save()
 {
-  struct
+  // Find the files that changed since the cache file was last written
+  std::unordered_map<std::string, std::shared_ptr<const GameFile>> files;
+  files.reserve(m_cached_files.size());
+  std::vector<std::shared_ptr<GameFile>> changed_files;
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+  {
+    files.emplace(file->GetFilePath(), file);
+
+    const auto it = m_saved_files.find(file->GetFilePath());
+    if (it == m_saved_files.end() || it->second != file)
+      changed_files.push_back(file);
+  }
+
+  std::vector<std::string> removed_paths;
+  for (const auto& [path, file] : m_saved_files)
   {
-    u32 revision;
-    u64 expected_size;
-  } header = {CACHE_REVISION, size};
-  p->Do(header);
-  if (p->IsReadMode())
+    if (!files.contains(path))
+      removed_paths.push_back(path);
+  }
+
+  const size_t records = m_records_in_cache_file + changed_files.size() + removed_paths.size();
+  const bool rewrite = !m_can_append_to_cache_file || !File::Exists(m_path) ||
+                       records > std::max(MIN_RECORDS_FOR_REWRITE, files.size() * 2);
+  if (!rewrite && changed_files.empty() && removed_paths.empty())
+    return true;
+
+  std::vector<u8> buffer;
+  if (rewrite)
   {
-    if (header.revision != CACHE_REVISION || header.expected_size != size)
-    {
-      p->SetMeasureMode();
-      return;
-    }
+    changed_files = m_cached_files;
+    removed_paths.clear();
+
+    buffer.resize(sizeof(CACHE_REVISION));
+    std::memcpy(buffer.data(), &CACHE_REVISION, sizeof(CACHE_REVISION));
   }
-  p->DoEachElement(m_cached_files, [](PointerWrap& state, std::shared_ptr<GameFile>& elem) {
-    if (state.IsReadMode())
-      elem = std::make_shared<GameFile>();
-    elem->DoState(state);
-  });
+
+  for (const std::shared_ptr<GameFile>& file : changed_files)
+  {
+    AppendRecord(&buffer, [&file](PointerWrap& p) {
+      RecordType type = RecordType::Add;
+      p.Do(type);
+      file->DoState(p);
+    });
+  }
+  for (std::string& path : removed_paths)
+  {
+    AppendRecord(&buffer, [&path](PointerWrap& p) {
+      RecordType type = RecordType::Remove;
+      p.Do(type);
+      p.Do(path);
+    });
+  }
+
+  File::IOFile f(m_path, rewrite ? "wb" : "ab");
+  if (!f || !f.WriteBytes(buffer.data(), buffer.size()))
+  {
+    // If some file operation failed, try to delete the probably-corrupted cache
+    f.Close();
+    File::Delete(m_path);
+    ResetCacheFileState();
+    return false;
+  }
+
+  m_saved_files = std::move(files);
+  m_records_in_cache_file = rewrite ? m_cached_files.size() : records;
+  m_can_append_to_cache_file = true;
+  return true;
+}
+
+void GameFileCache::ResetCacheFileState()
+{
+  m_saved_files.clear();
+  m_records_in_cache_file = 0;
+  m_can_append_to_cache_file = false;
 }
 
 }  // namespace UICommon
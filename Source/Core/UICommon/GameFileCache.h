@@ -9,12 +9,11 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 
-class PointerWrap;
-
 namespace UICommon
 {
 class GameFile;
@@ -37,6 +36,7 @@ public:
   using GameUpdatedFn = std::function<void(const std::shared_ptr<const GameFile>&)>;
 
   GameFileCache();
+  explicit GameFileCache(std::string path);
 
   void ForEach(const ForEachFn& f) const;
 
@@ -47,6 +47,10 @@ public:
   std::shared_ptr<const GameFile> AddOrGet(const std::string& path, bool* cache_changed);
 
   // These functions return true if the call modified the cache.
+  // Files are processed on several threads at once. The callbacks can be called from any of them,
+  // but never more than one at a time.
+  // Update also rescans files whose size or modification time has changed. These are reported as
+  // removed and then added again.
   bool Update(std::span<const std::string> all_game_paths,
               const GameAddedToCacheFn& game_added_to_cache = {},
               const GameRemovedFromCacheFn& game_removed_from_cache = {},
@@ -55,16 +59,23 @@ public:
                                 const std::atomic_bool& processing_halted = false);
 
   bool Load();
+  // Only writes the files that changed since the last Load or Save, unless the cache file
+  // has accumulated enough outdated entries to be worth rewriting.
   bool Save();
 
 private:
   bool UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file);
 
-  bool SyncCacheFile(bool save);
-  void DoState(PointerWrap* p, u64 size = 0);
+  void ResetCacheFileState();
 
   std::string m_path;
   std::vector<std::shared_ptr<GameFile>> m_cached_files;
+
+  // The entries of the cache file. Cached files are never modified once they are shared,
+  // so a file has changed since it was saved if it isn't the same object anymore.
+  std::unordered_map<std::string, std::shared_ptr<const GameFile>> m_saved_files;
+  size_t m_records_in_cache_file = 0;
+  bool m_can_append_to_cache_file = false;
 };
 
 }  // namespace UICommon
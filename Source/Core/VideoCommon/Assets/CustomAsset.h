@@ -28,6 +28,12 @@ public:
   // Loads the asset from the library returning a pass/fail result
   bool Load();
 
+  // Frees the loaded data, the asset has to be loaded again before it can be used
+  void Unload();
+
+  // Returns whether the asset has been loaded and not unloaded since
+  bool IsLoaded() const;
+
   // Queries the last time the asset was modified or standard epoch time
   // if the asset hasn't been modified yet
   // Note: not thread safe, expected to be called by the loader
@@ -48,6 +54,7 @@ protected:
 
 private:
   virtual CustomAssetLibrary::LoadInfo LoadImpl(const CustomAssetLibrary::AssetID& asset_id) = 0;
+  virtual void UnloadImpl() = 0;
   CustomAssetLibrary::AssetID m_asset_id;
 
   mutable std::mutex m_info_lock;
@@ -83,6 +90,14 @@ protected:
   bool m_loaded = false;
   mutable std::mutex m_data_lock;
   std::shared_ptr<UnderlyingType> m_data;
+
+private:
+  void UnloadImpl() override
+  {
+    std::lock_guard lk(m_data_lock);
+    m_loaded = false;
+    m_data.reset();
+  }
 };
 
 // A helper struct that contains
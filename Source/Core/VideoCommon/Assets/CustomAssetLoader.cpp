@@ -3,8 +3,18 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Common/CPUDetect.h"
+#include "Common/Config/Config.h"
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/ScopeGuard.h"
+#include "Common/Thread.h"
+#include "Core/Config/GraphicsSettings.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
 namespace VideoCommon
@@ -19,6 +29,10 @@ void CustomAssetLoader::Init()
   m_max_memory_available =
       (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
 
+  const int memory_budget_mib = Config::Get(Config::GFX_CUSTOM_ASSET_MEMORY_BUDGET);
+  if (memory_budget_mib > 0)
+    m_max_memory_available = size_t(memory_budget_mib) * 1024 * 1024;
+
   m_asset_monitor_thread = std::thread([this]() {
     Common::SetCurrentThreadName("Asset monitor");
     while (true)
@@ -30,58 +44,228 @@ void CustomAssetLoader::Init()
 
       std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
 
-      std::lock_guard lk(m_asset_load_lock);
-      for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
+      std::vector<std::pair<std::shared_ptr<CustomAsset>, bool>> assets_to_retry;
       {
-        if (auto ptr = asset_to_monitor.lock())
+        std::lock_guard lk(m_asset_load_lock);
+        for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
         {
-          const auto write_time = ptr->GetLastWriteTime();
-          if (write_time > ptr->GetLastLoadedTime())
+          if (auto ptr = asset_to_monitor.lock())
           {
-            (void)ptr->Load();
+            const auto write_time = ptr->GetLastWriteTime();
+            if (write_time > ptr->GetLastLoadedTime())
+            {
+              (void)ptr->Load();
+            }
           }
         }
-      }
-    }
-  });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (ptr->Load())
-      {
-        std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        if (m_max_memory_available >= m_total_bytes_loaded + asset_memory_size)
+        for (auto it = m_failed_assets.begin(); it != m_failed_assets.end();)
         {
-          m_total_bytes_loaded += asset_memory_size;
-          m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        }
-        else
-        {
-          ERROR_LOG_FMT(VIDEO, "Failed to load asset {} because there was not enough memory.",
-                        ptr->GetAssetId());
+          auto ptr = it->second.asset.lock();
+          if (ptr && ptr->GetLastWriteTime() == it->second.write_time)
+          {
+            ++it;
+            continue;
+          }
+
+          if (ptr)
+            assets_to_retry.emplace_back(std::move(ptr), it->second.evictable);
+          it = m_failed_assets.erase(it);
         }
       }
+
+      for (auto& [asset, evictable] : assets_to_retry)
+        QueueAssetLoad(asset, LoadPriority::High, evictable);
     }
   });
+
+  m_asset_load_pool.Start("Custom Asset Loader",
+                         static_cast<u32>(std::clamp(cpu_info.num_cores / 2, 1, 4)));
 }
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  // Drop everything that hasn't started loading yet, the queued jobs will find nothing to do
+  {
+    std::lock_guard lk(m_pending_loads_lock);
+    m_high_priority_loads.clear();
+    m_prefetch_loads.clear();
+    m_queued_high_priority_assets.clear();
+  }
+  m_asset_load_pool.Shutdown();
 
   m_asset_monitor_thread_shutdown.Set();
   m_asset_monitor_thread.join();
   m_assets_to_monitor.clear();
+  m_failed_assets.clear();
+  m_lru_assets.clear();
+  m_lru_positions.clear();
   m_total_bytes_loaded = 0;
 }
 
+void CustomAssetLoader::MarkGameTextureUsed(const std::shared_ptr<GameTextureAsset>& asset)
+{
+  MarkAssetUsed(asset, true);
+}
+
+void CustomAssetLoader::MarkAssetUsed(const std::shared_ptr<CustomAsset>& asset, bool evictable)
+{
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    if (const auto it = m_lru_positions.find(asset->GetAssetId()); it != m_lru_positions.end())
+    {
+      m_lru_assets.splice(m_lru_assets.end(), m_lru_assets, it->second);
+      return;
+    }
+
+    // Loading it again would fail the same way, the asset monitor retries it once it changes
+    if (m_failed_assets.contains(asset->GetAssetId()))
+      return;
+  }
+
+  // Either still waiting to be loaded, or unloaded to stay within the memory budget
+  if (!asset->IsLoaded())
+    QueueAssetLoad(asset, LoadPriority::High, evictable);
+}
+
+void CustomAssetLoader::QueueAssetLoad(std::weak_ptr<CustomAsset> asset, LoadPriority priority,
+                                       bool evictable)
+{
+  const auto ptr = asset.lock();
+  if (!ptr)
+    return;
+
+  {
+    std::lock_guard lk(m_pending_loads_lock);
+    if (priority == LoadPriority::High)
+    {
+      if (!m_queued_high_priority_assets.insert(ptr->GetAssetId()).second)
+        return;
+      m_high_priority_loads.push_back({std::move(asset), ptr->GetAssetId(), priority, evictable});
+    }
+    else
+    {
+      m_prefetch_loads.push_back({std::move(asset), ptr->GetAssetId(), priority, evictable});
+    }
+  }
+
+  m_asset_load_pool.Submit([this] { LoadNextAsset(); });
+}
+
+void CustomAssetLoader::LoadNextAsset()
+{
+  PendingLoad load;
+  {
+    std::lock_guard lk(m_pending_loads_lock);
+    if (!m_high_priority_loads.empty())
+    {
+      load = std::move(m_high_priority_loads.front());
+      m_high_priority_loads.pop_front();
+    }
+    else if (!m_prefetch_loads.empty())
+    {
+      load = std::move(m_prefetch_loads.front());
+      m_prefetch_loads.pop_front();
+    }
+    else
+    {
+      return;
+    }
+
+    // Another thread is already loading the asset
+    if (!m_loading_assets.insert(load.asset_id).second)
+    {
+      if (load.priority == LoadPriority::High)
+        m_queued_high_priority_assets.erase(load.asset_id);
+      return;
+    }
+  }
+
+  // Only done once the memory of the asset has been accounted for
+  Common::ScopeGuard load_done_guard([this, &load] {
+    std::lock_guard lk(m_pending_loads_lock);
+    m_loading_assets.erase(load.asset_id);
+    if (load.priority == LoadPriority::High)
+      m_queued_high_priority_assets.erase(load.asset_id);
+  });
+
+  auto ptr = load.asset.lock();
+  if (!ptr)
+    return;
+
+  // An asset can be queued more than once, e.g. when a prefetched asset is needed right away
+  if (ptr->IsLoaded())
+    return;
+
+  if (load.priority == LoadPriority::Prefetch)
+  {
+    // Prefetching must not push out assets that were actually used
+    std::lock_guard lk(m_asset_load_lock);
+    if (m_total_bytes_loaded >= m_max_memory_available)
+      return;
+  }
+
+  const auto write_time = ptr->GetLastWriteTime();
+  if (!ptr->Load())
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    m_failed_assets.insert_or_assign(ptr->GetAssetId(),
+                                     FailedAsset{ptr, write_time, load.evictable});
+    return;
+  }
+
+  std::lock_guard lk(m_asset_load_lock);
+  const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
+  if (load.priority == LoadPriority::High)
+    FreeMemory(asset_memory_size);
+
+  if (m_max_memory_available >= m_total_bytes_loaded + asset_memory_size)
+  {
+    m_total_bytes_loaded += asset_memory_size;
+    m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
+    if (load.evictable)
+    {
+      m_lru_assets.emplace_back(ptr->GetAssetId(), ptr);
+      m_lru_positions.insert_or_assign(ptr->GetAssetId(), std::prev(m_lru_assets.end()));
+    }
+  }
+  else
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to load asset {} because there was not enough memory.",
+                  ptr->GetAssetId());
+    if (load.evictable)
+    {
+      ptr->Unload();
+      m_failed_assets.insert_or_assign(ptr->GetAssetId(),
+                                       FailedAsset{ptr, write_time, load.evictable});
+    }
+  }
+}
+
+void CustomAssetLoader::FreeMemory(std::size_t bytes_needed)
+{
+  while (m_total_bytes_loaded + bytes_needed > m_max_memory_available && !m_lru_assets.empty())
+  {
+    auto [asset_id, asset] = std::move(m_lru_assets.front());
+    m_lru_assets.pop_front();
+    m_lru_positions.erase(asset_id);
+
+    if (const auto ptr = asset.lock())
+    {
+      m_total_bytes_loaded -= ptr->GetByteSizeInMemory();
+      m_assets_to_monitor.erase(asset_id);
+      ptr->Unload();
+    }
+  }
+}
+
 std::shared_ptr<GameTextureAsset>
 CustomAssetLoader::LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
-                                   std::shared_ptr<CustomAssetLibrary> library)
+                                   std::shared_ptr<CustomAssetLibrary> library,
+                                   LoadPriority priority)
 {
-  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library));
+  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library),
+                                             priority);
 }
 
 std::shared_ptr<PixelShaderAsset>
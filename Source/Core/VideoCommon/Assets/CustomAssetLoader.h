@@ -4,13 +4,17 @@
 #pragma once
 
 #include <chrono>
+#include <deque>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
+#include <type_traits>
 
 #include "Common/Flag.h"
-#include "Common/WorkQueueThread.h"
+#include "Common/ThreadPool.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/ShaderAsset.h"
@@ -23,6 +27,14 @@ namespace VideoCommon
 class CustomAssetLoader
 {
 public:
+  enum class LoadPriority
+  {
+    // The asset is needed right away, these are loaded before any prefetched assets
+    High,
+    // The asset is loaded ahead of time, these are skipped once the memory budget is used up
+    Prefetch,
+  };
+
   CustomAssetLoader() = default;
   ~CustomAssetLoader() = default;
   CustomAssetLoader(const CustomAssetLoader&) = delete;
@@ -39,7 +51,8 @@ public:
   // Callees are expected to query the underlying data with 'GetData()'
   // from the 'CustomLoadableAsset' class to determine if the data is ready for use
   std::shared_ptr<GameTextureAsset> LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
-                                                    std::shared_ptr<CustomAssetLibrary> library);
+                                                    std::shared_ptr<CustomAssetLibrary> library,
+                                                    LoadPriority priority = LoadPriority::High);
 
   std::shared_ptr<PixelShaderAsset> LoadPixelShader(const CustomAssetLibrary::AssetID& asset_id,
                                                     std::shared_ptr<CustomAssetLibrary> library);
@@ -47,34 +60,70 @@ public:
   std::shared_ptr<MaterialAsset> LoadMaterial(const CustomAssetLibrary::AssetID& asset_id,
                                               std::shared_ptr<CustomAssetLibrary> library);
 
+  // Game textures are kept in memory in least recently used order, and are unloaded once the
+  // memory budget is needed for other assets. This marks a game texture as used, queueing it to be
+  // loaded again if it was unloaded.
+  void MarkGameTextureUsed(const std::shared_ptr<GameTextureAsset>& asset);
+
 private:
+  struct PendingLoad
+  {
+    std::weak_ptr<CustomAsset> asset;
+    CustomAssetLibrary::AssetID asset_id;
+    LoadPriority priority = LoadPriority::High;
+    bool evictable = false;
+  };
+
   // TODO C++20: use a 'derived_from' concept against 'CustomAsset' when available
   template <typename AssetType>
   std::shared_ptr<AssetType>
   LoadOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
                     std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
-                    std::shared_ptr<CustomAssetLibrary> library)
+                    std::shared_ptr<CustomAssetLibrary> library,
+                    LoadPriority priority = LoadPriority::High)
   {
+    // Only textures are unloaded to stay within the memory budget, other assets are expected
+    // to stay loaded by their users
+    constexpr bool evictable = std::is_same_v<AssetType, GameTextureAsset>;
+
     auto [it, inserted] = asset_map.try_emplace(asset_id);
     if (!inserted)
     {
       auto shared = it->second.lock();
       if (shared)
+      {
+        if (priority == LoadPriority::High)
+          MarkAssetUsed(shared, evictable);
         return shared;
+      }
     }
     std::shared_ptr<AssetType> ptr(new AssetType(std::move(library), asset_id), [&](AssetType* a) {
       {
         std::lock_guard lk(m_asset_load_lock);
         m_total_bytes_loaded -= a->GetByteSizeInMemory();
         m_assets_to_monitor.erase(a->GetAssetId());
+        m_failed_assets.erase(a->GetAssetId());
+        if (const auto lru_it = m_lru_positions.find(a->GetAssetId());
+            lru_it != m_lru_positions.end())
+        {
+          m_lru_assets.erase(lru_it->second);
+          m_lru_positions.erase(lru_it);
+        }
       }
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    QueueAssetLoad(ptr, priority, evictable);
     return ptr;
   }
 
+  void MarkAssetUsed(const std::shared_ptr<CustomAsset>& asset, bool evictable);
+  void QueueAssetLoad(std::weak_ptr<CustomAsset> asset, LoadPriority priority, bool evictable);
+  void LoadNextAsset();
+
+  // Unloads the least recently used game textures until there is room for the given size
+  void FreeMemory(std::size_t bytes_needed);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<GameTextureAsset>> m_game_textures;
@@ -88,9 +137,36 @@ private:
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
 
+  // Assets that failed to load or didn't fit in the memory budget, with the write time they had
+  // then. Using them doesn't queue them again, they are retried once they change.
+  struct FailedAsset
+  {
+    std::weak_ptr<CustomAsset> asset;
+    CustomAssetLibrary::TimeType write_time;
+    bool evictable = false;
+  };
+  std::map<CustomAssetLibrary::AssetID, FailedAsset> m_failed_assets;
+
+  // Loaded game textures, least recently used first
+  using LRUList = std::list<std::pair<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>>>;
+  LRUList m_lru_assets;
+  std::map<CustomAssetLibrary::AssetID, LRUList::iterator> m_lru_positions;
+
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
   // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+
+  // Every queued load submits one job to the pool, which then picks the pending load with the
+  // highest priority
+  std::mutex m_pending_loads_lock;
+  std::deque<PendingLoad> m_high_priority_loads;
+  std::deque<PendingLoad> m_prefetch_loads;
+  // High priority loads that are queued or in progress, so that using an asset while it loads
+  // doesn't queue it again
+  std::set<CustomAssetLibrary::AssetID> m_queued_high_priority_assets;
+  // Loads in progress. An asset is only loaded by one thread at a time, so that its memory is only
+  // accounted for once.
+  std::set<CustomAssetLibrary::AssetID> m_loading_assets;
+  Common::ThreadPool m_asset_load_pool;
 };
 }  // namespace VideoCommon
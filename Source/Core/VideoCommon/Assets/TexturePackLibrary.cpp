@@ -0,0 +1,355 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/Assets/TexturePackLibrary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+#include <zstd.h>
+
+#include "Common/Logging/Log.h"
+#include "Common/ScopeGuard.h"
+#include "Common/Swap.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 TEXTURE_PACK_MAGIC = 0x50544444;  // "DDTP"
+constexpr u32 TEXTURE_PACK_VERSION = 1;
+
+constexpr int ZSTD_COMPRESSION_LEVEL = 9;
+
+struct TexturePackHeader
+{
+  u32 magic;
+  u32 version;
+  u64 index_offset;
+  u64 index_size;
+  u32 num_textures;
+  u32 reserved;
+};
+static_assert(sizeof(TexturePackHeader) == 32);
+
+struct LevelRecord
+{
+  u32 format;
+  u32 width;
+  u32 height;
+  u32 row_length;
+  u64 offset;
+  u64 stored_size;
+  u64 size;
+};
+static_assert(sizeof(LevelRecord) == 40);
+
+template <typename T>
+void Append(std::vector<u8>* buffer, const T& value)
+{
+  const size_t offset = buffer->size();
+  buffer->resize(offset + sizeof(T));
+  std::memcpy(buffer->data() + offset, &value, sizeof(T));
+}
+
+class IndexReader
+{
+public:
+  explicit IndexReader(const std::vector<u8>& buffer) : m_buffer(buffer) {}
+
+  template <typename T>
+  std::optional<T> Read()
+  {
+    if (m_buffer.size() - m_position < sizeof(T))
+      return std::nullopt;
+
+    T value;
+    std::memcpy(&value, m_buffer.data() + m_position, sizeof(T));
+    m_position += sizeof(T);
+    return value;
+  }
+
+  std::optional<std::string> ReadString(u32 length)
+  {
+    if (m_buffer.size() - m_position < length)
+      return std::nullopt;
+
+    std::string value(reinterpret_cast<const char*>(m_buffer.data() + m_position), length);
+    m_position += length;
+    return value;
+  }
+
+private:
+  const std::vector<u8>& m_buffer;
+  size_t m_position = 0;
+};
+}  // namespace
+
+std::shared_ptr<TexturePackLibrary> TexturePackLibrary::Open(const std::string& path)
+{
+  auto library = std::make_shared<TexturePackLibrary>();
+  if (!library->m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open texture pack '{}'", path);
+    return nullptr;
+  }
+
+  if (!library->ReadIndex())
+  {
+    ERROR_LOG_FMT(VIDEO, "Texture pack '{}' is invalid", path);
+    return nullptr;
+  }
+
+  library->m_path = path;
+  library->m_idle_files.push_back(std::move(library->m_file));
+  library->m_open_time = std::chrono::system_clock::now();
+  return library;
+}
+
+File::IOFile TexturePackLibrary::AcquireFile()
+{
+  {
+    std::lock_guard lk(m_idle_files_lock);
+    if (!m_idle_files.empty())
+    {
+      File::IOFile file = std::move(m_idle_files.back());
+      m_idle_files.pop_back();
+      return file;
+    }
+  }
+
+  // A duplicated descriptor would share its file position, so the pack is opened again instead
+  return File::IOFile(m_path, "rb");
+}
+
+void TexturePackLibrary::ReleaseFile(File::IOFile file)
+{
+  if (!file.IsOpen())
+    return;
+
+  file.ClearError();
+  std::lock_guard lk(m_idle_files_lock);
+  m_idle_files.push_back(std::move(file));
+}
+
+bool TexturePackLibrary::ReadIndex()
+{
+  TexturePackHeader header;
+  if (!m_file.ReadArray(&header, 1) || header.magic != TEXTURE_PACK_MAGIC ||
+      header.version != TEXTURE_PACK_VERSION)
+  {
+    return false;
+  }
+
+  // The index is at the end of the file, after the data of all levels
+  const u64 file_size = m_file.GetSize();
+  if (header.index_offset < sizeof(TexturePackHeader) || header.index_offset > file_size ||
+      header.index_size > file_size - header.index_offset)
+  {
+    return false;
+  }
+
+  std::vector<u8> index(header.index_size);
+  if (!m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadBytes(index.data(), index.size()))
+  {
+    return false;
+  }
+
+  IndexReader reader(index);
+  // Every texture takes at least 9 bytes of the index
+  m_textures.reserve(std::min<u64>(header.num_textures, header.index_size / 9));
+  for (u32 i = 0; i < header.num_textures; ++i)
+  {
+    const auto id_length = reader.Read<u32>();
+    const auto asset_id = id_length ? reader.ReadString(*id_length) : std::nullopt;
+    const auto has_arbitrary_mipmaps = reader.Read<u8>();
+    const auto num_slices = reader.Read<u32>();
+    if (!asset_id || !has_arbitrary_mipmaps || !num_slices || *num_slices == 0)
+      return false;
+
+    Entry entry;
+    entry.has_arbitrary_mipmaps = *has_arbitrary_mipmaps != 0;
+    for (u32 slice = 0; slice < *num_slices; ++slice)
+    {
+      const auto num_levels = reader.Read<u32>();
+      if (!num_levels || *num_levels == 0)
+        return false;
+
+      std::vector<Level>& levels = entry.slices.emplace_back();
+      for (u32 level = 0; level < *num_levels; ++level)
+      {
+        const auto record = reader.Read<LevelRecord>();
+        if (!record || record->format >= static_cast<u32>(AbstractTextureFormat::Undefined) ||
+            record->stored_size > record->size || record->offset < sizeof(TexturePackHeader) ||
+            record->offset > header.index_offset ||
+            record->stored_size > header.index_offset - record->offset)
+        {
+          return false;
+        }
+
+        levels.push_back({static_cast<AbstractTextureFormat>(record->format), record->width,
+                          record->height, record->row_length, record->offset, record->stored_size,
+                          record->size});
+      }
+    }
+
+    m_textures.insert_or_assign(*asset_id, std::move(entry));
+  }
+
+  return true;
+}
+
+CustomAssetLibrary::LoadInfo TexturePackLibrary::LoadTexture(const AssetID& asset_id,
+                                                             TextureData* data)
+{
+  const auto it = m_textures.find(asset_id);
+  if (it == m_textures.end())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - not found in texture pack!", asset_id);
+    return {};
+  }
+
+  data->m_type = TextureData::Type::Type_Texture2D;
+  data->m_texture.m_slices.clear();
+
+  File::IOFile file = AcquireFile();
+  if (!file.IsOpen())
+  {
+    ERROR_LOG_FMT(VIDEO, "Asset '{}' error - failed to open texture pack!", asset_id);
+    return {};
+  }
+  Common::ScopeGuard release_guard([&] { ReleaseFile(std::move(file)); });
+
+  std::size_t total_size = 0;
+  std::vector<u8> stored_data;
+  for (const std::vector<Level>& levels : it->second.slices)
+  {
+    auto& slice = data->m_texture.m_slices.emplace_back();
+    for (const Level& level : levels)
+    {
+      auto& loaded_level = slice.m_levels.emplace_back();
+      loaded_level.format = level.format;
+      loaded_level.width = level.width;
+      loaded_level.height = level.height;
+      loaded_level.row_length = level.row_length;
+      loaded_level.data.resize(level.size);
+
+      // Uncompressed levels are read straight into place
+      const bool compressed = level.stored_size != level.size;
+      if (compressed)
+        stored_data.resize(level.stored_size);
+      u8* const read_buffer = compressed ? stored_data.data() : loaded_level.data.data();
+      if (!file.Seek(level.offset, File::SeekOrigin::Begin) ||
+          !file.ReadBytes(read_buffer, level.stored_size))
+      {
+        ERROR_LOG_FMT(VIDEO, "Asset '{}' error - failed to read texture pack!", asset_id);
+        return {};
+      }
+
+      if (compressed && ZSTD_decompress(loaded_level.data.data(), level.size, read_buffer,
+                                        level.stored_size) != level.size)
+      {
+        ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture pack data is corrupted!", asset_id);
+        return {};
+      }
+
+      total_size += level.size;
+    }
+  }
+
+  return LoadInfo{total_size, m_open_time};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackLibrary::LoadPixelShader(const AssetID& asset_id,
+                                                                 PixelShaderData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain pixel shaders!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::LoadInfo TexturePackLibrary::LoadMaterial(const AssetID& asset_id,
+                                                              MaterialData*)
+{
+  ERROR_LOG_FMT(VIDEO, "Asset '{}' error - texture packs can't contain materials!", asset_id);
+  return {};
+}
+
+CustomAssetLibrary::TimeType TexturePackLibrary::GetLastAssetWriteTime(const AssetID&) const
+{
+  return m_open_time;
+}
+
+std::vector<TexturePackLibrary::TextureInfo> TexturePackLibrary::GetTextures() const
+{
+  std::vector<TextureInfo> textures;
+  textures.reserve(m_textures.size());
+  for (const auto& [asset_id, entry] : m_textures)
+    textures.push_back({asset_id, entry.has_arbitrary_mipmaps});
+  return textures;
+}
+
+bool TexturePackLibrary::Writer::Open(const std::string& path)
+{
+  m_index.clear();
+  m_num_textures = 0;
+
+  // The header is written again with the index location once all textures have been added
+  const TexturePackHeader header{};
+  return m_file.Open(path, "wb") && m_file.WriteArray(&header, 1);
+}
+
+bool TexturePackLibrary::Writer::AddTexture(const TextureInfo& info,
+                                            const CustomTextureData& texture)
+{
+  Append(&m_index, static_cast<u32>(info.asset_id.size()));
+  m_index.insert(m_index.end(), info.asset_id.begin(), info.asset_id.end());
+  Append(&m_index, static_cast<u8>(info.has_arbitrary_mipmaps));
+  Append(&m_index, static_cast<u32>(texture.m_slices.size()));
+
+  std::vector<u8> compressed;
+  for (const auto& slice : texture.m_slices)
+  {
+    Append(&m_index, static_cast<u32>(slice.m_levels.size()));
+    for (const auto& level : slice.m_levels)
+    {
+      compressed.resize(ZSTD_compressBound(level.data.size()));
+      const size_t compressed_size =
+          ZSTD_compress(compressed.data(), compressed.size(), level.data.data(), level.data.size(),
+                        ZSTD_COMPRESSION_LEVEL);
+
+      // Already compressed data (e.g. BC7) is stored as is, so that it can be read in place
+      const bool use_compressed =
+          !ZSTD_isError(compressed_size) && compressed_size < level.data.size();
+      const u8* stored_data = use_compressed ? compressed.data() : level.data.data();
+      const u64 stored_size = use_compressed ? compressed_size : level.data.size();
+
+      const LevelRecord record{static_cast<u32>(level.format),
+                               level.width,
+                               level.height,
+                               level.row_length,
+                               m_file.Tell(),
+                               stored_size,
+                               level.data.size()};
+      Append(&m_index, record);
+
+      if (!m_file.WriteBytes(stored_data, stored_size))
+        return false;
+    }
+  }
+
+  ++m_num_textures;
+  return true;
+}
+
+bool TexturePackLibrary::Writer::Finish()
+{
+  const TexturePackHeader header{TEXTURE_PACK_MAGIC, TEXTURE_PACK_VERSION, m_file.Tell(),
+                                 m_index.size(), m_num_textures, 0};
+  return m_file.WriteBytes(m_index.data(), m_index.size()) &&
+         m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
@@ -0,0 +1,94 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomAssetLibrary.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+
+namespace VideoCommon
+{
+// This class implements 'CustomAssetLibrary' and loads 2D textures from a single pre-baked
+// texture pack file. The file starts with an index of all textures, and stores the levels of
+// each texture in the format they are uploaded in (block compressed for DDS sources), optionally
+// compressed with zstd. Lookups don't need to touch the file system, and loading a texture is a
+// single read followed by decompression instead of opening and decoding an image file per level.
+class TexturePackLibrary final : public CustomAssetLibrary
+{
+public:
+  static constexpr std::string_view FILE_EXTENSION = ".dtp";
+
+  struct TextureInfo
+  {
+    AssetID asset_id;
+    bool has_arbitrary_mipmaps = false;
+  };
+
+  // Returns nullptr if the file can't be opened or is not a texture pack
+  static std::shared_ptr<TexturePackLibrary> Open(const std::string& path);
+
+  LoadInfo LoadTexture(const AssetID& asset_id, TextureData* data) override;
+  LoadInfo LoadPixelShader(const AssetID& asset_id, PixelShaderData* data) override;
+  LoadInfo LoadMaterial(const AssetID& asset_id, MaterialData* data) override;
+
+  // Texture packs are immutable, this returns the time the pack was opened
+  TimeType GetLastAssetWriteTime(const AssetID& asset_id) const override;
+
+  std::vector<TextureInfo> GetTextures() const;
+
+  // Creates a texture pack file, textures are written as they are added
+  class Writer
+  {
+  public:
+    bool Open(const std::string& path);
+    bool AddTexture(const TextureInfo& info, const CustomTextureData& texture);
+    bool Finish();
+
+  private:
+    File::IOFile m_file;
+    std::vector<u8> m_index;
+    u32 m_num_textures = 0;
+  };
+
+private:
+  struct Level
+  {
+    AbstractTextureFormat format;
+    u32 width;
+    u32 height;
+    u32 row_length;
+    u64 offset;
+    u64 stored_size;
+    u64 size;
+  };
+
+  struct Entry
+  {
+    bool has_arbitrary_mipmaps = false;
+    std::vector<std::vector<Level>> slices;
+  };
+
+  bool ReadIndex();
+
+  // Every concurrent load reads through its own handle, so the worker threads don't have to
+  // serialize on one file position. Handles are kept around for reuse once a load is done.
+  File::IOFile AcquireFile();
+  void ReleaseFile(File::IOFile file);
+
+  std::string m_path;
+  File::IOFile m_file;
+  std::mutex m_idle_files_lock;
+  std::vector<File::IOFile> m_idle_files;
+  TimeType m_open_time;
+  std::unordered_map<AssetID, Entry> m_textures;
+};
+}  // namespace VideoCommon
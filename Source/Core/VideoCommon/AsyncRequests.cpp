@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncRequests.h"
 
+#include <chrono>
 #include <mutex>
 
 #include "Core/System.h"
@@ -28,100 +29,135 @@ void AsyncRequests::PullEventsInternal()
   // So just flush the pipeline to get accurate results.
   g_vertex_manager->Flush();
 
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_empty.Set();
+  ADDSTAT(g_stats.this_frame.efb_peek_stall_us, m_efb_peek_stall_us.exchange(0));
 
-  while (!m_queue.empty())
+  while (!m_queue.Empty())
   {
-    Event e = m_queue.front();
+    const Event& e = m_queue.Front();
 
     // try to merge as many efb pokes as possible
     // it's a bit hacky, but some games render a complete frame in this way
-    if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
+    if (e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z)
     {
       m_merged_efb_pokes.clear();
-      Event first_event = m_queue.front();
-      const auto t = first_event.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor :
-                                                                 EFBAccessType::PokeZ;
+      const Event::Type type = e.type;
+      const auto t =
+          type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
 
       do
       {
-        e = m_queue.front();
+        const Event& poke = m_queue.Front();
 
         EfbPokeData d;
-        d.data = e.efb_poke.data;
-        d.x = e.efb_poke.x;
-        d.y = e.efb_poke.y;
+        d.data = poke.efb_poke.data;
+        d.x = poke.efb_poke.x;
+        d.y = poke.efb_poke.y;
         m_merged_efb_pokes.push_back(d);
 
-        m_queue.pop();
-      } while (!m_queue.empty() && m_queue.front().type == first_event.type);
+        m_queue.Pop();
+      } while (!m_queue.Empty() && m_queue.Front().type == type);
 
-      lock.unlock();
       g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
-      lock.lock();
+      MarkEventsHandled(m_merged_efb_pokes.size());
       continue;
     }
 
-    lock.unlock();
     HandleEvent(e);
-    lock.lock();
-
-    m_queue.pop();
+    m_queue.Pop();
+    MarkEventsHandled(1);
   }
+}
 
-  if (m_wake_me_up_again)
+void AsyncRequests::MarkEventsHandled(u64 count)
+{
+  m_handled_events.fetch_add(count);
+
+  // The waiting thread sets the flag before checking m_handled_events, so either it sees the new
+  // count or we see the flag here.
+  if (m_wake_me_up_again.exchange(false))
   {
-    m_wake_me_up_again = false;
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_cond.notify_all();
   }
 }
 
-void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
+void AsyncRequests::WaitForEvent(u64 sequence)
 {
   std::unique_lock<std::mutex> lock(m_mutex);
+  m_cond.wait(lock, [this, sequence] {
+    m_wake_me_up_again.store(true);
+    return m_handled_events.load() >= sequence || !m_enable.load();
+  });
+}
 
-  if (m_passthrough)
+void AsyncRequests::DropEvents()
+{
+  u64 count = 0;
+  while (!m_queue.Empty())
   {
-    HandleEvent(event);
-    return;
+    m_queue.Pop();
+    count++;
   }
 
-  m_empty.Clear();
-  m_wake_me_up_again |= blocking;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_handled_events.fetch_add(count);
+  m_cond.notify_all();
+}
+
+void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
+{
+  const bool is_efb_peek = event.type == Event::EFB_PEEK_COLOR || event.type == Event::EFB_PEEK_Z;
+  std::chrono::steady_clock::time_point start;
+  if (is_efb_peek)
+    start = std::chrono::steady_clock::now();
+  const auto get_stall_us = [&start] {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                 start)
+        .count();
+  };
+
+  if (m_passthrough.load())
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_passthrough.load())
+    {
+      HandleEvent(event);
+      if (is_efb_peek)
+        ADDSTAT(g_stats.this_frame.efb_peek_stall_us, get_stall_us());
+      return;
+    }
+  }
 
-  if (!m_enable)
+  if (!m_enable.load())
     return;
 
-  m_queue.push(event);
+  // Only one thread pushes events at a time, so nobody else modifies m_pushed_events.
+  const u64 sequence = m_pushed_events.load() + 1;
+  m_queue.Push(event);
+  m_pushed_events.store(sequence);
 
   auto& system = Core::System::GetInstance();
   system.GetFifo().RunGpu();
   if (blocking)
   {
-    m_cond.wait(lock, [this] { return m_queue.empty(); });
+    WaitForEvent(sequence);
+    if (is_efb_peek)
+      m_efb_peek_stall_us.fetch_add(get_stall_us());
   }
 }
 
 void AsyncRequests::WaitForEmptyQueue()
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_cond.wait(lock, [this] { return m_queue.empty(); });
+  WaitForEvent(m_pushed_events.load());
 }
 
 void AsyncRequests::SetEnable(bool enable)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_enable = enable;
+  m_enable.store(enable);
 
-  if (!enable)
-  {
-    // flush the queue on disabling
-    while (!m_queue.empty())
-      m_queue.pop();
-    if (m_wake_me_up_again)
-      m_cond.notify_all();
-  }
+  // Drop anything left over from when the queue was last enabled, and flush the queue on
+  // disabling.
+  DropEvents();
 }
 
 void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
@@ -180,6 +216,6 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 
 void AsyncRequests::SetPassthrough(bool enable)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_passthrough = enable;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_passthrough.store(enable);
 }
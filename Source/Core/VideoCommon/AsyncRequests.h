@@ -3,13 +3,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "Common/CommonTypes.h"
-#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 struct EfbPokeData;
 class PointerWrap;
@@ -80,13 +80,15 @@ public:
 
   AsyncRequests();
 
+  // Must only be called from the GPU thread.
   void PullEvents()
   {
-    if (!m_empty.IsSet())
+    if (!m_queue.Empty())
       PullEventsInternal();
   }
   void PushEvent(const Event& event, bool blocking = false);
   void WaitForEmptyQueue();
+  // Must only be called from the GPU thread, as it drops the queued events.
   void SetEnable(bool enable);
   void SetPassthrough(bool enable);
 
@@ -95,17 +97,28 @@ public:
 private:
   void PullEventsInternal();
   void HandleEvent(const Event& e);
+  void MarkEventsHandled(u64 count);
+  void WaitForEvent(u64 sequence);
+  void DropEvents();
 
   static AsyncRequests s_singleton;
 
-  Common::Flag m_empty;
-  std::queue<Event> m_queue;
+  // Events are only pushed by the CPU thread (or while it is paused) and only pulled by the GPU
+  // thread, so the queue itself needs no lock. The mutex is only used to put the CPU thread to
+  // sleep while it waits for a blocking event, and to serialize events in passthrough mode.
+  Common::SPSCQueue<Event, false> m_queue;
+  std::atomic<u64> m_pushed_events = 0;
+  std::atomic<u64> m_handled_events = 0;
   std::mutex m_mutex;
   std::condition_variable m_cond;
 
-  bool m_wake_me_up_again = false;
-  bool m_enable = false;
-  bool m_passthrough = true;
+  std::atomic<bool> m_wake_me_up_again = false;
+  std::atomic<bool> m_enable = false;
+  std::atomic<bool> m_passthrough = true;
+
+  // Time the CPU thread spent waiting for EFB peeks, added to the frame statistics by the GPU
+  // thread.
+  std::atomic<u64> m_efb_peek_stall_us = 0;
 
   std::vector<EfbPokeData> m_merged_efb_pokes;
 };
@@ -186,8 +186,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
       INCSTAT(g_stats.this_frame.num_draw_done);
       g_texture_cache->FlushEFBCopies();
       g_texture_cache->FlushStaleBinds();
-      g_framebuffer_manager->InvalidatePeekCache(false);
-      g_framebuffer_manager->RefreshPeekCache();
+      g_framebuffer_manager->PrefetchPeekCache();
       auto& system = Core::System::GetInstance();
       if (!system.GetFifo().UseDeterministicGPUThread())
         system.GetPixelEngine().SetFinish(cycles_into_future);  // may generate interrupt
@@ -205,8 +204,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     INCSTAT(g_stats.this_frame.num_token);
     g_texture_cache->FlushEFBCopies();
     g_texture_cache->FlushStaleBinds();
-    g_framebuffer_manager->InvalidatePeekCache(false);
-    g_framebuffer_manager->RefreshPeekCache();
+    g_framebuffer_manager->PrefetchPeekCache();
     auto& system = Core::System::GetInstance();
     if (!system.GetFifo().UseDeterministicGPUThread())
     {
@@ -221,8 +219,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     INCSTAT(g_stats.this_frame.num_token_int);
     g_texture_cache->FlushEFBCopies();
     g_texture_cache->FlushStaleBinds();
-    g_framebuffer_manager->InvalidatePeekCache(false);
-    g_framebuffer_manager->RefreshPeekCache();
+    g_framebuffer_manager->PrefetchPeekCache();
     auto& system = Core::System::GetInstance();
     if (!system.GetFifo().UseDeterministicGPUThread())
     {
@@ -376,6 +373,14 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager, XFStateManager&
     {
       ClearScreen(srcRect);
     }
+    else if (PE_copy.copy_to_xfb)
+    {
+      // Games that peek every frame (e.g. depth tests for lens flares) usually do so after
+      // copying the finished frame out, so get a head start on the readbacks they will need.
+      // EFB copies to textures happen many times per frame, and prefetching after each of them
+      // would mostly read back tiles that are about to be drawn over again.
+      g_framebuffer_manager->PrefetchPeekCache();
+    }
 
     return;
   }
@@ -3,6 +3,9 @@
 
 #include "VideoCommon/CPUCull.h"
 
+#include <algorithm>
+#include <bit>
+
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/MathUtil.h"
@@ -10,6 +13,7 @@
 #include "Core/System.h"
 
 #include "VideoCommon/CPMemory.h"
+#include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
 #include "VideoCommon/VideoConfig.h"
@@ -98,15 +102,15 @@ static CPUCull::CullFunction GetCullFunction0()
   // Note: AVX version only actually AVX on compilers that support __attribute__((target))
   // Sorry, MSVC + Sandy Bridge.  (Ivy+ and AMD see very little benefit thanks to mov elimination)
   if (MIN_SSE >= 50 || cpu_info.bAVX)
-    return CPUCull_AVX::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_AVX::CullTriangles<Primitive, Mode>;
   else if (MIN_SSE >= 30 || cpu_info.bSSE3)
-    return CPUCull_SSE3::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE3::CullTriangles<Primitive, Mode>;
   else
-    return CPUCull_SSE::AreAllVerticesCulled<Primitive, Mode>;
+    return CPUCull_SSE::CullTriangles<Primitive, Mode>;
 #elif defined(USE_NEON)
-  return CPUCull_NEON::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_NEON::CullTriangles<Primitive, Mode>;
 #else
-  return CPUCull_Scalar::AreAllVerticesCulled<Primitive, Mode>;
+  return CPUCull_Scalar::CullTriangles<Primitive, Mode>;
 #endif
 }
 
@@ -137,14 +141,31 @@ void CPUCull::Init()
   m_cull_table[Prim::GX_DRAW_TRIANGLE_FAN] = GetCullFunction1<Prim::GX_DRAW_TRIANGLE_FAN>();
 }
 
-bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                                   const u8* src, u32 count)
+u32 CPUCull::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                           const u8* src, u32 count)
+{
+  // transform functions need the projection matrix to tranform to clip space
+  auto& system = Core::System::GetInstance();
+  system.GetVertexShaderManager().SetProjectionMatrix(system.GetXFStateManager());
+
+  static constexpr Common::EnumMap<CullMode, CullMode::All> cullmode_invert = {
+      CullMode::None, CullMode::Front, CullMode::Back, CullMode::All};
+
+  CullMode cullmode = bpmem.genMode.cullmode;
+  if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
+    cullmode = cullmode_invert[cullmode];
+  return CullTriangles(loader->m_native_vtx_decl, primitive, cullmode, src, count);
+}
+
+u32 CPUCull::CullTriangles(const PortableVertexDeclaration& vtx_decl,
+                           OpcodeDecoder::Primitive primitive, CullMode cullmode, const u8* src,
+                           u32 count)
 {
   ASSERT_MSG(VIDEO, primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES,
              "CPUCull should not be called on lines or points");
-  const u32 stride = loader->m_native_vtx_decl.stride;
-  const bool posHas3Elems = loader->m_native_vtx_decl.position.components >= 3;
-  const bool perVertexPosMtx = loader->m_native_vtx_decl.posmtx.enable;
+  const u32 stride = vtx_decl.stride;
+  const bool posHas3Elems = vtx_decl.position.components >= 3;
+  const bool perVertexPosMtx = vtx_decl.posmtx.enable;
   if (m_transform_buffer_size < count) [[unlikely]]
   {
     u32 new_size = MathUtil::NextPowerOf2(count);
@@ -153,20 +174,15 @@ bool CPUCull::AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Prim
         Common::AllocateAlignedMemory(new_size * sizeof(TransformedVertex), 32)));
   }
 
-  // transform functions need the projection matrix to tranform to clip space
-  auto& system = Core::System::GetInstance();
-  system.GetVertexShaderManager().SetProjectionMatrix(system.GetXFStateManager());
+  const size_t num_words = (IndexGenerator::GetTriangleCount(primitive, count) + 63) / 64;
+  if (m_visible_triangles.size() < num_words) [[unlikely]]
+    m_visible_triangles.resize(num_words);
+  std::fill_n(m_visible_triangles.begin(), num_words, 0);
 
-  static constexpr Common::EnumMap<CullMode, CullMode::All> cullmode_invert = {
-      CullMode::None, CullMode::Front, CullMode::Back, CullMode::All};
-
-  CullMode cullmode = bpmem.genMode.cullmode;
-  if (xfmem.viewport.ht > 0)  // See videosoftware Clipper.cpp:IsBackface
-    cullmode = cullmode_invert[cullmode];
   const TransformFunction transform = m_transform_table[posHas3Elems][perVertexPosMtx];
   transform(m_transform_buffer.get(), src, stride, count);
   const CullFunction cull = m_cull_table[primitive][cullmode];
-  return cull(m_transform_buffer.get(), count);
+  return cull(m_transform_buffer.get(), count, m_visible_triangles.data());
 }
 
 template <typename T>
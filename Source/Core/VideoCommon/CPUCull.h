@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/OpcodeDecoding.h"
 
 class CPUCull
@@ -12,8 +15,19 @@ class CPUCull
 public:
   ~CPUCull();
   void Init();
-  bool AreAllVerticesCulled(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
-                            const u8* src, u32 count);
+
+  // Transforms the vertices to clip space and culls their triangles like the GPU would.
+  // Returns the number of triangles which may be visible, GetVisibleTriangles() has a bit set for
+  // each of them in the order IndexGenerator emits them.
+  u32 CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive, const u8* src,
+                    u32 count);
+  // Same as above, but with the cull mode given and the projection matrix of the vertex shader
+  // constants used as is.
+  u32 CullTriangles(const PortableVertexDeclaration& vtx_decl,
+                    OpcodeDecoder::Primitive primitive, CullMode cullmode, const u8* src,
+                    u32 count);
+
+  const u64* GetVisibleTriangles() const { return m_visible_triangles.data(); }
 
   struct alignas(16) TransformedVertex
   {
@@ -21,7 +35,7 @@ public:
   };
 
   using TransformFunction = void (*)(void*, const void*, u32, int);
-  using CullFunction = bool (*)(const CPUCull::TransformedVertex*, int);
+  using CullFunction = u32 (*)(const CPUCull::TransformedVertex*, int, u64*);
 
 private:
   template <typename T>
@@ -31,6 +45,7 @@ private:
   };
   std::unique_ptr<TransformedVertex[], BufferDeleter<TransformedVertex>> m_transform_buffer{};
   u32 m_transform_buffer_size = 0;
+  std::vector<u64> m_visible_triangles;
   std::array<std::array<TransformFunction, 2>, 2> m_transform_table{};
   Common::EnumMap<Common::EnumMap<CullFunction, CullMode::All>,
                   OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
@@ -234,6 +234,137 @@ LoadTransform2Vertices(const u8* v0data, const u8* v1data,                  //
   return v01;
 }
 
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m256 Load2PosYMM(const u8* lo, const u8* hi)
+{
+  // Don't read past the end of a two element position
+  __m128 vlo = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(lo));
+  __m128 vhi = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(hi));
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(vlo), vhi, 1);
+}
+
+// Loads the positions of eight vertices, transposed so that x has the x of all of them and so on
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposedPos8(const u8* data, u32 stride,
+                                                                __m256& x, __m256& y, __m256& z)
+{
+  __m256 w;
+  if constexpr (PositionHas3Elems)
+  {
+    x = _mm256_loadu2_m128(reinterpret_cast<const float*>(data + stride * 4),
+                           reinterpret_cast<const float*>(data));
+    y = _mm256_loadu2_m128(reinterpret_cast<const float*>(data + stride * 5),
+                           reinterpret_cast<const float*>(data + stride));
+    z = _mm256_loadu2_m128(reinterpret_cast<const float*>(data + stride * 6),
+                           reinterpret_cast<const float*>(data + stride * 2));
+    w = _mm256_loadu2_m128(reinterpret_cast<const float*>(data + stride * 7),
+                           reinterpret_cast<const float*>(data + stride * 3));
+  }
+  else
+  {
+    x = Load2PosYMM(data, data + stride * 4);
+    y = Load2PosYMM(data + stride, data + stride * 5);
+    z = Load2PosYMM(data + stride * 2, data + stride * 6);
+    w = Load2PosYMM(data + stride * 3, data + stride * 7);
+  }
+  TransposeYMM(x, y, z, w);
+}
+
+// Loads one row of the position matrices of eight vertices, transposed like the positions
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransposedRow8(const float* const* matrices,
+                                                                u32 row, __m256& o0, __m256& o1,
+                                                                __m256& o2, __m256& o3)
+{
+  o0 = _mm256_loadu2_m128(matrices[4] + row * 4, matrices[0] + row * 4);
+  o1 = _mm256_loadu2_m128(matrices[5] + row * 4, matrices[1] + row * 4);
+  o2 = _mm256_loadu2_m128(matrices[6] + row * 4, matrices[2] + row * 4);
+  o3 = _mm256_loadu2_m128(matrices[7] + row * 4, matrices[3] + row * 4);
+  TransposeYMM(o0, o1, o2, o3);
+}
+
+template <bool PositionHas3Elems>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m256 TransformRow8(__m256 x, __m256 y, __m256 z,
+                                                             __m256 m0, __m256 m1, __m256 m2,
+                                                             __m256 m3)
+{
+  __m256 output = m3;  // vertex.w is always 1.0
+#ifdef USE_FMA
+  output = _mm256_fmadd_ps(x, m0, output);
+  output = _mm256_fmadd_ps(y, m1, output);
+  if constexpr (PositionHas3Elems)
+    output = _mm256_fmadd_ps(z, m2, output);
+#else
+  output = _mm256_add_ps(output, _mm256_mul_ps(x, m0));
+  output = _mm256_add_ps(output, _mm256_mul_ps(y, m1));
+  if constexpr (PositionHas3Elems)
+    output = _mm256_add_ps(output, _mm256_mul_ps(z, m2));
+#endif
+  return output;
+}
+
+// Same order of operations as ApplyMatrixYMM, with w = 1.0
+ATTR_TARGET DOLPHIN_FORCE_INLINE static __m256 ProjectRow8(__m256 x, __m256 y, __m256 z,
+                                                           const __m256* proj)
+{
+  __m256 output = _mm256_mul_ps(x, proj[0]);
+#ifdef USE_FMA
+  output = _mm256_fmadd_ps(y, proj[1], output);
+  output = _mm256_fmadd_ps(z, proj[2], output);
+#else
+  output = _mm256_add_ps(output, _mm256_mul_ps(y, proj[1]));
+  output = _mm256_add_ps(output, _mm256_mul_ps(z, proj[2]));
+#endif
+  return _mm256_add_ps(output, proj[3]);
+}
+
+// Transforms eight vertices at once, with one component of all eight in each register instead of
+// one vertex per 128-bit lane.  pos and proj hold each matrix element broadcast, row by row.
+template <bool PositionHas3Elems, bool PerVertexPosMtx>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void LoadTransform8Vertices(const u8* data, u32 stride,
+                                                                    const __m256* pos,
+                                                                    const __m256* proj,
+                                                                    Vector* output)
+{
+  __m256 x, y, z;
+  __m256 wx, wy, wz;
+  if constexpr (PerVertexPosMtx)
+  {
+    const float* matrices[8];
+    for (u32 i = 0; i < 8; i++)
+      matrices[i] = &xfmem.posMatrices[(data[i * stride] & 0x3f) * 4];
+
+    LoadTransposedPos8<PositionHas3Elems>(data + sizeof(u32), stride, x, y, z);
+
+    __m256 m0, m1, m2, m3;
+    LoadTransposedRow8(matrices, 0, m0, m1, m2, m3);
+    wx = TransformRow8<PositionHas3Elems>(x, y, z, m0, m1, m2, m3);
+    LoadTransposedRow8(matrices, 1, m0, m1, m2, m3);
+    wy = TransformRow8<PositionHas3Elems>(x, y, z, m0, m1, m2, m3);
+    LoadTransposedRow8(matrices, 2, m0, m1, m2, m3);
+    wz = TransformRow8<PositionHas3Elems>(x, y, z, m0, m1, m2, m3);
+  }
+  else
+  {
+    LoadTransposedPos8<PositionHas3Elems>(data, stride, x, y, z);
+
+    wx = TransformRow8<PositionHas3Elems>(x, y, z, pos[0], pos[1], pos[2], pos[3]);
+    wy = TransformRow8<PositionHas3Elems>(x, y, z, pos[4], pos[5], pos[6], pos[7]);
+    wz = TransformRow8<PositionHas3Elems>(x, y, z, pos[8], pos[9], pos[10], pos[11]);
+  }
+
+  __m256 cx = ProjectRow8(wx, wy, wz, proj + 0);
+  __m256 cy = ProjectRow8(wx, wy, wz, proj + 4);
+  __m256 cz = ProjectRow8(wx, wy, wz, proj + 8);
+  __m256 cw = ProjectRow8(wx, wy, wz, proj + 12);
+
+  // Back to one vertex per 128-bit lane: v0/v4, v1/v5, v2/v6, v3/v7
+  TransposeYMM(cx, cy, cz, cw);
+  float* foutput = reinterpret_cast<float*>(output);
+  _mm256_store_ps(foutput + 0, _mm256_permute2f128_ps(cx, cy, 0x20));
+  _mm256_store_ps(foutput + 8, _mm256_permute2f128_ps(cz, cw, 0x20));
+  _mm256_store_ps(foutput + 16, _mm256_permute2f128_ps(cx, cy, 0x31));
+  _mm256_store_ps(foutput + 24, _mm256_permute2f128_ps(cz, cw, 0x31));
+}
+
 #endif
 
 #ifndef USE_AVX
@@ -517,7 +648,25 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
   __m256 pos0, pos1, pos2, pos3;
   LoadTransposedYMM(vsmanager.constants.projection.data(), proj0, proj1, proj2, proj3);
   LoadTransposedPosYMM(&xfmem.posMatrices[idx * 4], pos0, pos1, pos2, pos3);
-  for (int i = 1; i < count; i += 2)
+
+  const float* fproj = reinterpret_cast<const float*>(vsmanager.constants.projection.data());
+  const float* fpos = &xfmem.posMatrices[idx * 4];
+  __m256 proj8[16];
+  __m256 pos8[12];
+  for (int j = 0; j < 16; j++)
+    proj8[j] = _mm256_set1_ps(fproj[j]);
+  for (int j = 0; j < 12; j++)
+    pos8[j] = _mm256_set1_ps(fpos[j]);
+
+  int i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    LoadTransform8Vertices<PositionHas3Elems, PerVertexPosMtx>(cvertices, stride, pos8, proj8,
+                                                               voutput);
+    cvertices += stride * 8;
+    voutput += 8;
+  }
+  for (; i + 2 <= count; i += 2)
   {
     const u8* v0data = cvertices;
     const u8* v1data = cvertices + stride;
@@ -527,7 +676,7 @@ ATTR_TARGET static void TransformVertices(void* output, const void* vertices, u3
     cvertices += stride * 2;
     voutput += 2;
   }
-  if (count & 1)
+  if (i < count)
   {
     *voutput = LoadTransformVertex<PositionHas3Elems, PerVertexPosMtx>(
         cvertices,                                                     //
@@ -653,59 +802,153 @@ ATTR_TARGET DOLPHIN_FORCE_INLINE static bool CullTriangle(const CPUCull::Transfo
   return cull;
 }
 
-template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
-ATTR_TARGET static bool AreAllVerticesCulled(const CPUCull::TransformedVertex* transformed,
-                                             int count)
+// Triangles are numbered in the same order as IndexGenerator emits them
+template <OpcodeDecoder::Primitive Primitive>
+DOLPHIN_FORCE_INLINE static void GetTriangle(const CPUCull::TransformedVertex* transformed,
+                                             u32 triangle, const CPUCull::TransformedVertex*& a,
+                                             const CPUCull::TransformedVertex*& b,
+                                             const CPUCull::TransformedVertex*& c)
 {
   switch (Primitive)
   {
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
   case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
   {
-    int i = 3;
-    for (; i < count; i += 4)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 1], transformed[i - 0]))
-        return false;
-    }
-    // three vertices remaining, so render a triangle
-    if (i == count)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 3], transformed[i - 2], transformed[i - 1]))
-        return false;
-    }
+    // 012, 023
+    const u32 quad = triangle / 2 * 4;
+    const u32 second = triangle & 1;
+    a = &transformed[quad];
+    b = &transformed[quad + 1 + second];
+    c = &transformed[quad + 2 + second];
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
-    for (int i = 2; i < count; i += 3)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - 1], transformed[i - 0]))
-        return false;
-    }
+    a = &transformed[triangle * 3];
+    b = &transformed[triangle * 3 + 1];
+    c = &transformed[triangle * 3 + 2];
     break;
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
   {
-    bool wind = false;
-    for (int i = 2; i < count; ++i)
-    {
-      if (!CullTriangle<Mode>(transformed[i - 2], transformed[i - !wind], transformed[i - wind]))
-        return false;
-      wind = !wind;
-    }
+    const u32 wind = triangle & 1;
+    a = &transformed[triangle];
+    b = &transformed[triangle + 1 + wind];
+    c = &transformed[triangle + 2 - wind];
     break;
   }
   case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
-    for (int i = 2; i < count; ++i)
-    {
-      if (!CullTriangle<Mode>(transformed[0], transformed[i - 1], transformed[i]))
-        return false;
-    }
+    a = &transformed[0];
+    b = &transformed[triangle + 1];
+    c = &transformed[triangle + 2];
     break;
   }
+}
+
+#ifdef USE_AVX
+// x, y and w of eight vertices, one component of all of them per register
+ATTR_TARGET DOLPHIN_FORCE_INLINE static void
+LoadXYW8(const CPUCull::TransformedVertex* const* vertices, __m256& x, __m256& y, __m256& w)
+{
+  __m256 z;
+  x = _mm256_set_m128(_mm_load_ps(&vertices[4]->x), _mm_load_ps(&vertices[0]->x));
+  y = _mm256_set_m128(_mm_load_ps(&vertices[5]->x), _mm_load_ps(&vertices[1]->x));
+  z = _mm256_set_m128(_mm_load_ps(&vertices[6]->x), _mm_load_ps(&vertices[2]->x));
+  w = _mm256_set_m128(_mm_load_ps(&vertices[7]->x), _mm_load_ps(&vertices[3]->x));
+  TransposeYMM(x, y, z, w);
+}
+
+// CullTriangle for eight triangles at once, returns a bit for each one that is visible
+template <CullMode Mode>
+ATTR_TARGET DOLPHIN_FORCE_INLINE static u32
+Cull8Triangles(const CPUCull::TransformedVertex* const* a,
+               const CPUCull::TransformedVertex* const* b,
+               const CPUCull::TransformedVertex* const* c)
+{
+  __m256 ax, ay, aw, bx, by, bw, cx, cy, cw;
+  LoadXYW8(a, ax, ay, aw);
+  LoadXYW8(b, bx, by, bw);
+  LoadXYW8(c, cx, cy, cw);
+
+  // Same operations in the same order as the SSE version of CullTriangle
+  __m256 part0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(ax, cw), _mm256_mul_ps(cx, aw)), by);
+  __m256 part1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(ay, cx), _mm256_mul_ps(cy, ax)), bw);
+  __m256 part3 = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(aw, cy), _mm256_mul_ps(cw, ay)), bx);
+  __m256 normal_z_dir = _mm256_add_ps(_mm256_add_ps(part0, part1), part3);
+
+  __m256 zero = _mm256_setzero_ps();
+  __m256 cull;
+  switch (Mode)
+  {
+  case CullMode::None:
+    cull = _mm256_cmp_ps(normal_z_dir, zero, _CMP_EQ_OQ);
+    break;
+  case CullMode::Front:
+    cull = _mm256_cmp_ps(normal_z_dir, zero, _CMP_LE_OQ);
+    break;
+  case CullMode::Back:
+  default:
+    cull = _mm256_cmp_ps(normal_z_dir, zero, _CMP_GE_OQ);
+    break;
+  }
+
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 anw = _mm256_xor_ps(aw, sign);
+  __m256 bnw = _mm256_xor_ps(bw, sign);
+  __m256 cnw = _mm256_xor_ps(cw, sign);
+  __m256 x_lt_nw = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(ax, anw, _CMP_LT_OQ),
+                                               _mm256_cmp_ps(bx, bnw, _CMP_LT_OQ)),
+                                 _mm256_cmp_ps(cx, cnw, _CMP_LT_OQ));
+  __m256 y_lt_nw = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(ay, anw, _CMP_LT_OQ),
+                                               _mm256_cmp_ps(by, bnw, _CMP_LT_OQ)),
+                                 _mm256_cmp_ps(cy, cnw, _CMP_LT_OQ));
+  __m256 x_gt_pw = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(aw, ax, _CMP_LE_OQ),
+                                               _mm256_cmp_ps(bw, bx, _CMP_LE_OQ)),
+                                 _mm256_cmp_ps(cw, cx, _CMP_LE_OQ));
+  __m256 y_gt_pw = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(aw, ay, _CMP_LE_OQ),
+                                               _mm256_cmp_ps(bw, by, _CMP_LE_OQ)),
+                                 _mm256_cmp_ps(cw, cy, _CMP_LE_OQ));
+  cull = _mm256_or_ps(_mm256_or_ps(cull, _mm256_or_ps(x_lt_nw, y_lt_nw)),
+                      _mm256_or_ps(x_gt_pw, y_gt_pw));
+
+  return ~_mm256_movemask_ps(cull) & 0xff;
+}
+#endif
+
+// Expects visible to be zeroed
+template <OpcodeDecoder::Primitive Primitive, CullMode Mode>
+ATTR_TARGET static u32 CullTriangles(const CPUCull::TransformedVertex* transformed, int count,
+                                     u64* visible)
+{
+  if (Mode == CullMode::All)
+    return 0;
+
+  const u32 num_triangles = IndexGenerator::GetTriangleCount(Primitive, count);
+  u32 num_visible = 0;
+  u32 triangle = 0;
+  const CPUCull::TransformedVertex* a;
+  const CPUCull::TransformedVertex* b;
+  const CPUCull::TransformedVertex* c;
+#ifdef USE_AVX
+  for (; triangle + 8 <= num_triangles; triangle += 8)
+  {
+    const CPUCull::TransformedVertex* a8[8];
+    const CPUCull::TransformedVertex* b8[8];
+    const CPUCull::TransformedVertex* c8[8];
+    for (u32 i = 0; i < 8; i++)
+      GetTriangle<Primitive>(transformed, triangle + i, a8[i], b8[i], c8[i]);
+    const u32 bits = Cull8Triangles<Mode>(a8, b8, c8);
+    visible[triangle / 64] |= u64(bits) << (triangle % 64);
+    num_visible += std::popcount(bits);
+  }
+#endif
+  for (; triangle < num_triangles; triangle++)
+  {
+    GetTriangle<Primitive>(transformed, triangle, a, b, c);
+    const u32 is_visible = !CullTriangle<Mode>(*a, *b, *c);
+    visible[triangle / 64] |= u64(is_visible) << (triangle % 64);
+    num_visible += is_visible;
+  }
 
-  return true;
+  return num_visible;
 }
 
 }  // namespace VECTOR_NAMESPACE
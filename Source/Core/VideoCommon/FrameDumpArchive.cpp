@@ -0,0 +1,237 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/FrameDumpArchive.h"
+
+#include <cstring>
+
+#include <lz4.h>
+#include <xxhash.h>
+
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 FRAME_DUMP_ARCHIVE_MAGIC = 0x41464444;  // "DDFA"
+constexpr u32 FRAME_DUMP_ARCHIVE_VERSION = 1;
+
+constexpr u32 FLAG_LZ4 = 1;
+
+struct ArchiveHeader
+{
+  u32 magic;
+  u32 version;
+  // Zero while the dump is still being written
+  u64 index_offset;
+  u32 num_frames;
+  u32 reserved;
+};
+static_assert(sizeof(ArchiveHeader) == 24);
+
+// Written in front of each frame and again in the index
+struct FrameRecord
+{
+  u32 width;
+  u32 height;
+  u64 hash;
+  u64 ticks;
+  u32 frame_number;
+  u32 flags;
+  u32 stored_size;
+  u32 reserved;
+  u64 offset;
+};
+static_assert(sizeof(FrameRecord) == 48);
+
+template <typename T>
+void Append(std::vector<u8>* buffer, const T& value)
+{
+  const size_t offset = buffer->size();
+  buffer->resize(offset + sizeof(T));
+  std::memcpy(buffer->data() + offset, &value, sizeof(T));
+}
+
+bool IsValidRecord(const FrameRecord& record)
+{
+  const u64 size = u64(record.width) * record.height * 3;
+  return size != 0 && size <= LZ4_MAX_INPUT_SIZE &&
+         (record.flags & FLAG_LZ4 ? record.stored_size <= size : record.stored_size == size);
+}
+}  // namespace
+
+std::unique_ptr<FrameDumpArchive> FrameDumpArchive::Open(const std::string& path)
+{
+  auto archive = std::make_unique<FrameDumpArchive>();
+  if (!archive->m_file.Open(path, "rb"))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to open frame dump '{}'", path);
+    return nullptr;
+  }
+
+  if (!archive->ReadIndex())
+  {
+    ERROR_LOG_FMT(VIDEO, "Frame dump '{}' is invalid", path);
+    return nullptr;
+  }
+
+  return archive;
+}
+
+bool FrameDumpArchive::ReadIndex()
+{
+  ArchiveHeader header;
+  if (!m_file.ReadArray(&header, 1) || header.magic != FRAME_DUMP_ARCHIVE_MAGIC ||
+      header.version != FRAME_DUMP_ARCHIVE_VERSION)
+  {
+    return false;
+  }
+
+  if (header.index_offset == 0)
+  {
+    WARN_LOG_FMT(VIDEO, "Frame dump was not finished, scanning for frames");
+    return ScanFrames();
+  }
+
+  // Don't allocate based on a frame count that the file can't possibly hold.
+  const u64 file_size = m_file.GetSize();
+  if (header.index_offset > file_size ||
+      header.num_frames > (file_size - header.index_offset) / sizeof(FrameRecord))
+  {
+    return false;
+  }
+
+  std::vector<FrameRecord> records(header.num_frames);
+  if (!m_file.Seek(header.index_offset, File::SeekOrigin::Begin) ||
+      !m_file.ReadArray(records.data(), records.size()))
+  {
+    return false;
+  }
+
+  m_frames.reserve(records.size());
+  m_locations.reserve(records.size());
+  for (const FrameRecord& record : records)
+  {
+    if (!IsValidRecord(record))
+      return false;
+
+    m_frames.push_back(
+        {record.width, record.height, record.hash, record.ticks, record.frame_number});
+    m_locations.push_back({record.offset, record.stored_size, (record.flags & FLAG_LZ4) != 0});
+  }
+  return true;
+}
+
+bool FrameDumpArchive::ScanFrames()
+{
+  const u64 file_size = m_file.GetSize();
+  u64 offset = sizeof(ArchiveHeader);
+  FrameRecord record;
+  // A frame cut off by a crash ends the dump.
+  while (offset + sizeof(FrameRecord) <= file_size && m_file.ReadArray(&record, 1) &&
+         IsValidRecord(record) && record.offset == offset + sizeof(FrameRecord) &&
+         record.offset + record.stored_size <= file_size)
+  {
+    m_frames.push_back(
+        {record.width, record.height, record.hash, record.ticks, record.frame_number});
+    m_locations.push_back({record.offset, record.stored_size, (record.flags & FLAG_LZ4) != 0});
+
+    offset = record.offset + record.stored_size;
+    if (!m_file.Seek(offset, File::SeekOrigin::Begin))
+      break;
+  }
+  m_file.ClearError();
+  return true;
+}
+
+bool FrameDumpArchive::ReadFrame(size_t index, std::vector<u8>* rgb)
+{
+  const FrameInfo& frame = m_frames.at(index);
+  const Location& location = m_locations.at(index);
+  const size_t size = size_t(frame.width) * frame.height * 3;
+  rgb->resize(size);
+
+  if (!m_file.Seek(location.offset, File::SeekOrigin::Begin))
+    return false;
+
+  if (!location.compressed)
+    return m_file.ReadBytes(rgb->data(), size);
+
+  std::vector<char> compressed(location.stored_size);
+  if (!m_file.ReadBytes(compressed.data(), compressed.size()))
+    return false;
+
+  return LZ4_decompress_safe(compressed.data(), reinterpret_cast<char*>(rgb->data()),
+                             static_cast<int>(compressed.size()),
+                             static_cast<int>(size)) == static_cast<int>(size);
+}
+
+u64 FrameDumpArchive::HashPixels(const u8* rgb, size_t size)
+{
+  return XXH3_64bits(rgb, size);
+}
+
+bool FrameDumpArchive::Writer::Open(const std::string& path)
+{
+  m_index.clear();
+  m_num_frames = 0;
+
+  // The header is written again with the index location once the dump is finished
+  const ArchiveHeader header{FRAME_DUMP_ARCHIVE_MAGIC, FRAME_DUMP_ARCHIVE_VERSION, 0, 0, 0};
+  return m_file.Open(path, "wb") && m_file.WriteArray(&header, 1);
+}
+
+bool FrameDumpArchive::Writer::AddFrame(const u8* rgba, u32 width, u32 height, u32 stride,
+                                        u64 ticks, u32 frame_number)
+{
+  const size_t size = size_t(width) * height * 3;
+  if (size == 0 || size > LZ4_MAX_INPUT_SIZE)
+    return false;
+
+  m_rgb.resize(size);
+  u8* out = m_rgb.data();
+  for (u32 y = 0; y < height; ++y)
+  {
+    const u8* row = rgba + size_t(y) * stride;
+    for (u32 x = 0; x < width; ++x, out += 3)
+      std::memcpy(out, row + x * 4, 3);
+  }
+
+  // The fastest LZ4 mode still shrinks most frames a lot, as games tend to have large flat areas.
+  m_compressed.resize(LZ4_compressBound(static_cast<int>(size)));
+  const int compressed_size =
+      LZ4_compress_default(reinterpret_cast<const char*>(m_rgb.data()), m_compressed.data(),
+                           static_cast<int>(size), static_cast<int>(m_compressed.size()));
+  const bool use_compressed = compressed_size > 0 && static_cast<size_t>(compressed_size) < size;
+  const void* stored_data = use_compressed ? static_cast<const void*>(m_compressed.data()) :
+                                             static_cast<const void*>(m_rgb.data());
+  const u32 stored_size = use_compressed ? static_cast<u32>(compressed_size) :
+                                           static_cast<u32>(size);
+
+  const FrameRecord record{width,
+                           height,
+                           HashPixels(m_rgb.data(), size),
+                           ticks,
+                           frame_number,
+                           use_compressed ? FLAG_LZ4 : 0,
+                           stored_size,
+                           0,
+                           m_file.Tell() + sizeof(FrameRecord)};
+  if (!m_file.WriteArray(&record, 1) || !m_file.WriteBytes(stored_data, stored_size))
+    return false;
+
+  Append(&m_index, record);
+  ++m_num_frames;
+  return true;
+}
+
+bool FrameDumpArchive::Writer::Finish()
+{
+  const ArchiveHeader header{FRAME_DUMP_ARCHIVE_MAGIC, FRAME_DUMP_ARCHIVE_VERSION, m_file.Tell(),
+                             m_num_frames, 0};
+  return m_file.WriteBytes(m_index.data(), m_index.size()) &&
+         m_file.Seek(0, File::SeekOrigin::Begin) && m_file.WriteArray(&header, 1) &&
+         m_file.Close();
+}
+}  // namespace VideoCommon
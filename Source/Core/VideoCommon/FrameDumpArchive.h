@@ -0,0 +1,80 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/IOFile.h"
+
+namespace VideoCommon
+{
+// A lossless frame dump in a single file, meant for comparing the output of two runs. Each frame
+// is stored as packed RGB, LZ4 compressed unless that doesn't make it smaller, together with a
+// hash of its pixels so that identical frames can be found without decompressing them. An index
+// at the end of the file allows random access; if it is missing because the dump wasn't finished,
+// the frames are found by walking through the file instead.
+class FrameDumpArchive
+{
+public:
+  static constexpr std::string_view FILE_EXTENSION = ".dfa";
+
+  struct FrameInfo
+  {
+    u32 width = 0;
+    u32 height = 0;
+    // XXH3 of the packed RGB pixels
+    u64 hash = 0;
+    u64 ticks = 0;
+    u32 frame_number = 0;
+  };
+
+  // Returns nullptr if the file can't be opened or is not a frame dump archive
+  static std::unique_ptr<FrameDumpArchive> Open(const std::string& path);
+
+  const std::vector<FrameInfo>& GetFrames() const { return m_frames; }
+
+  // Reads the packed RGB pixels of a frame
+  bool ReadFrame(size_t index, std::vector<u8>* rgb);
+
+  static u64 HashPixels(const u8* rgb, size_t size);
+
+  class Writer
+  {
+  public:
+    bool Open(const std::string& path);
+    bool IsOpen() const { return m_file.IsOpen(); }
+    // Drops the alpha channel and the row padding of the RGBA input
+    bool AddFrame(const u8* rgba, u32 width, u32 height, u32 stride, u64 ticks, u32 frame_number);
+    bool Finish();
+
+    u32 GetFrameCount() const { return m_num_frames; }
+
+  private:
+    File::IOFile m_file;
+    std::vector<u8> m_index;
+    std::vector<u8> m_rgb;
+    std::vector<char> m_compressed;
+    u32 m_num_frames = 0;
+  };
+
+private:
+  struct Location
+  {
+    u64 offset;
+    u32 stored_size;
+    bool compressed;
+  };
+
+  bool ReadIndex();
+  bool ScanFrames();
+
+  File::IOFile m_file;
+  std::vector<FrameInfo> m_frames;
+  std::vector<Location> m_locations;
+};
+}  // namespace VideoCommon
@@ -53,6 +53,12 @@ struct FrameDumpContext
 
   s64 last_pts = AV_NOPTS_VALUE;
 
+  int scaler_width = 0;
+  int scaler_height = 0;
+
+  // Frames which were skipped because of their timestamp or failed to encode.
+  u32 dropped_frames = 0;
+
   int width = 0;
   int height = 0;
 
@@ -158,6 +164,71 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+SwsContext* CreateScaler(int src_width, int src_height, AVPixelFormat src_format, int dst_width,
+                         int dst_height, AVPixelFormat dst_format)
+{
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+  // Let libswscale convert slices of the frame on as many threads as there are cores.
+  SwsContext* sws = sws_alloc_context();
+  if (!sws)
+    return nullptr;
+
+  av_opt_set_int(sws, "srcw", src_width, 0);
+  av_opt_set_int(sws, "srch", src_height, 0);
+  av_opt_set_int(sws, "src_format", src_format, 0);
+  av_opt_set_int(sws, "dstw", dst_width, 0);
+  av_opt_set_int(sws, "dsth", dst_height, 0);
+  av_opt_set_int(sws, "dst_format", dst_format, 0);
+  av_opt_set_int(sws, "sws_flags", SWS_BICUBIC, 0);
+  av_opt_set_int(sws, "threads", 0, 0);
+  if (sws_init_context(sws, nullptr, nullptr) < 0)
+  {
+    sws_freeContext(sws);
+    return nullptr;
+  }
+  return sws;
+#else
+  return sws_getContext(src_width, src_height, src_format, dst_width, dst_height, dst_format,
+                        SWS_BICUBIC, nullptr, nullptr, nullptr);
+#endif
+}
+
+// The encoder keeps a reference to the buffers of the previous frame when it encodes on several
+// threads, in which case the scaled frame gets new ones instead of overwriting them.
+bool MakeScaledFrameWritable(FrameDumpContext& context)
+{
+  if (av_frame_is_writable(context.scaled_frame))
+    return true;
+
+  av_frame_unref(context.scaled_frame);
+  context.scaled_frame->format = context.codec->pix_fmt;
+  context.scaled_frame->width = context.width;
+  context.scaled_frame->height = context.height;
+  return av_frame_get_buffer(context.scaled_frame, 1) == 0;
+}
+
+void ScaleFrame(FrameDumpContext& context, const FrameData& frame)
+{
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+  // The threaded API references the source frame, which would copy it unless it is backed by a
+  // buffer. This one just wraps the mapped staging texture.
+  context.src_frame->buf[0] = av_buffer_create(const_cast<u8*>(frame.data),
+                                               size_t(frame.stride) * frame.height,
+                                               [](void*, uint8_t*) {}, nullptr, 0);
+  if (!context.src_frame->buf[0])
+    return;
+
+  if (const int error = sws_scale_frame(context.sws, context.scaled_frame, context.src_frame);
+      error < 0)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Error while converting video: {}", AVErrorString(error));
+  }
+  av_buffer_unref(&context.src_frame->buf[0]);
+#else
+  sws_scale(context.sws, context.src_frame->data, context.src_frame->linesize, 0, frame.height,
+            context.scaled_frame->data, context.scaled_frame->linesize);
+#endif
+}
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -265,6 +336,11 @@ bool FFMpegFrameDump::CreateVideoFile()
   m_context->codec->gop_size = 1;
   m_context->codec->level = 1;
 
+  // Let the encoder use as many threads as it sees fit. Frame threading delays the packets by a few
+  // frames, which ProcessPackets and the flush in Stop take care of.
+  m_context->codec->thread_count = 0;
+  m_context->codec->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
   AVPixelFormat pix_fmt = AV_PIX_FMT_NONE;
 
   const std::string& pixel_format_string = g_Config.sDumpPixelFormat;
@@ -365,6 +441,7 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     if (pts <= m_context->last_pts)
     {
       WARN_LOG_FMT(FRAMEDUMP, "PTS delta < 1. Current frame will not be dumped.");
+      ++m_context->dropped_frames;
       return;
     }
     else if (pts > m_context->last_pts + 1 && !m_context->gave_vfr_warning)
@@ -380,18 +457,26 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
   m_context->src_frame->linesize[0] = frame.stride;
   m_context->src_frame->format = pix_fmt;
-  m_context->src_frame->width = m_context->width;
-  m_context->src_frame->height = m_context->height;
+  m_context->src_frame->width = frame.width;
+  m_context->src_frame->height = frame.height;
 
   // Convert image from RGBA to desired pixel format.
-  m_context->sws = sws_getCachedContext(
-      m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
-  if (m_context->sws)
+  if (frame.width != m_context->scaler_width || frame.height != m_context->scaler_height)
+  {
+    sws_freeContext(m_context->sws);
+    m_context->sws = CreateScaler(frame.width, frame.height, pix_fmt, m_context->width,
+                                  m_context->height, m_context->codec->pix_fmt);
+    m_context->scaler_width = m_context->sws ? frame.width : 0;
+    m_context->scaler_height = m_context->sws ? frame.height : 0;
+  }
+  if (!MakeScaledFrameWritable(*m_context))
   {
-    sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
-              frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate frame");
+    ++m_context->dropped_frames;
+    return;
   }
+  if (m_context->sws)
+    ScaleFrame(*m_context, frame);
 
   m_context->last_pts = pts;
   m_context->scaled_frame->pts = pts;
@@ -399,6 +484,7 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
   if (const int error = avcodec_send_frame(m_context->codec, m_context->scaled_frame))
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Error while encoding video: {}", AVErrorString(error));
+    ++m_context->dropped_frames;
     return;
   }
 
@@ -454,10 +540,14 @@ void FFMpegFrameDump::Stop()
 
   ProcessPackets();
   av_write_trailer(m_context->format);
+  const u32 dropped_frames = m_context->dropped_frames;
   CloseVideoFile();
 
-  NOTICE_LOG_FMT(FRAMEDUMP, "Stopping frame dump");
-  OSD::AddMessage("Stopped dumping frames");
+  NOTICE_LOG_FMT(FRAMEDUMP, "Stopping frame dump, {} frames dropped", dropped_frames);
+  if (dropped_frames != 0)
+    OSD::AddMessage(fmt::format("Stopped dumping frames ({} dropped)", dropped_frames));
+  else
+    OSD::AddMessage("Stopped dumping frames");
 }
 
 bool FFMpegFrameDump::IsStarted() const
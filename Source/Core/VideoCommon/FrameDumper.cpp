@@ -3,12 +3,19 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <algorithm>
+#include <ctime>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
 
 #include "Core/Config/GraphicsSettings.h"
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractGfx.h"
@@ -58,13 +65,21 @@ void FrameDumper::DumpCurrentFrame(const AbstractTexture* src_texture,
     copy_rect = src_texture->GetRect();
   }
 
-  if (!CheckFrameDumpReadbackTexture(target_width, target_height))
+  // Queue a frame which is still waiting if no FlushFrameDump happened since it was copied.
+  if (m_frame_dump_copied_count == FRAME_DUMP_BUFFER_COUNT)
+    QueueOldestCopiedFrame();
+
+  const u32 index = m_frame_dump_copy_index;
+  WaitForFrameDumpBuffer(index);
+  if (!CheckFrameDumpReadbackTexture(index, target_width, target_height))
     return;
 
-  m_frame_dump_readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
-                                                 m_frame_dump_readback_texture->GetRect());
-  m_last_frame_state = m_ffmpeg_dump.FetchState(ticks, frame_number);
-  m_frame_dump_needs_flush = true;
+  FrameDumpBuffer& buffer = m_frame_dump_buffers[index];
+  buffer.readback_texture->CopyFromTexture(src_texture, copy_rect, 0, 0,
+                                           buffer.readback_texture->GetRect());
+  buffer.state = m_ffmpeg_dump.FetchState(ticks, frame_number);
+  m_frame_dump_copy_index = (index + 1) % FRAME_DUMP_BUFFER_COUNT;
+  ++m_frame_dump_copied_count;
 }
 
 bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_height)
@@ -95,9 +110,9 @@ bool FrameDumper::CheckFrameDumpRenderTexture(u32 target_width, u32 target_heigh
   return true;
 }
 
-bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height)
+bool FrameDumper::CheckFrameDumpReadbackTexture(u32 index, u32 target_width, u32 target_height)
 {
-  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_readback_texture;
+  std::unique_ptr<AbstractStagingTexture>& rbtex = m_frame_dump_buffers[index].readback_texture;
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
@@ -114,90 +129,124 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
 
 void FrameDumper::FlushFrameDump()
 {
-  if (!m_frame_dump_needs_flush)
+  if (m_frame_dump_copied_count == 0)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
+  // Screenshots are queued right away, as no further frame might be rendered while paused.
+  const u32 frames_to_keep = m_screenshot_request.IsSet() ? 0 : 1;
+  while (m_frame_dump_copied_count > frames_to_keep)
+    QueueOldestCopiedFrame();
 
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Shutdown frame dumping if it is no longer active.
+  if (!IsFrameDumping())
+    ShutdownFrameDumping();
+}
 
-  // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
-  output->Flush();
-  if (output->Map())
+void FrameDumper::QueueOldestCopiedFrame()
+{
+  const u32 index =
+      (m_frame_dump_copy_index + FRAME_DUMP_BUFFER_COUNT - m_frame_dump_copied_count) %
+      FRAME_DUMP_BUFFER_COUNT;
+  --m_frame_dump_copied_count;
+
+  // The texture stays mapped while the frame dump thread reads from it. Backends without
+  // persistent mappings unmap it again on the next copy to it.
+  FrameDumpBuffer& buffer = m_frame_dump_buffers[index];
+  AbstractStagingTexture* texture = buffer.readback_texture.get();
+  texture->Flush();
+  if (!texture->Map())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    return;
   }
-  else
+
+  if (!m_frame_dump_thread_running.IsSet())
   {
-    ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    if (m_frame_dump_thread.joinable())
+      m_frame_dump_thread.join();
+    m_frame_dump_late_frames = 0;
+    m_frame_dump_thread_running.Set();
+    m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
+  }
+
+  {
+    std::lock_guard lk(m_frame_dump_lock);
+    buffer.in_use = true;
+    m_frame_dump_queue.push(QueuedFrame{
+        FrameData{reinterpret_cast<u8*>(texture->GetMappedPointer()),
+                  static_cast<int>(texture->GetConfig().width),
+                  static_cast<int>(texture->GetConfig().height),
+                  static_cast<int>(texture->GetMappedStride()), buffer.state},
+        index});
   }
 
-  m_frame_dump_needs_flush = false;
+  // Wake worker thread up.
+  m_frame_dump_queued_cv.notify_one();
+}
 
-  // Shutdown frame dumping if it is no longer active.
-  if (!IsFrameDumping())
-    ShutdownFrameDumping();
+void FrameDumper::WaitForFrameDumpBuffer(u32 index)
+{
+  std::unique_lock lk(m_frame_dump_lock);
+  if (!m_frame_dump_buffers[index].in_use)
+    return;
+
+  ++m_frame_dump_late_frames;
+  m_frame_dump_done_cv.wait(lk, [&] { return !m_frame_dump_buffers[index].in_use; });
+}
+
+void FrameDumper::WaitForFrameDumpThread()
+{
+  std::unique_lock lk(m_frame_dump_lock);
+  m_frame_dump_done_cv.wait(lk, [this] {
+    return std::none_of(m_frame_dump_buffers.begin(), m_frame_dump_buffers.end(),
+                        [](const FrameDumpBuffer& buffer) { return buffer.in_use; });
+  });
 }
 
 void FrameDumper::ShutdownFrameDumping()
 {
-  // Ensure the last queued readback has been sent to the encoder.
-  FlushFrameDump();
+  // Ensure the last copied frames have been sent to the encoder.
+  while (m_frame_dump_copied_count != 0)
+    QueueOldestCopiedFrame();
 
   if (!m_frame_dump_thread_running.IsSet())
     return;
 
-  // Ensure previous frame has been encoded.
-  FinishFrameData();
+  // Ensure queued frames have been encoded.
+  WaitForFrameDumpThread();
 
   // Wake thread up, and wait for it to exit.
-  m_frame_dump_thread_running.Clear();
-  m_frame_dump_start.Set();
+  {
+    std::lock_guard lk(m_frame_dump_lock);
+    m_frame_dump_thread_running.Clear();
+  }
+  m_frame_dump_queued_cv.notify_one();
   if (m_frame_dump_thread.joinable())
     m_frame_dump_thread.join();
   m_frame_dump_render_framebuffer.reset();
   m_frame_dump_render_texture.reset();
 
-  m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
-}
-
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
-{
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
-
-  if (!m_frame_dump_thread_running.IsSet())
+  for (FrameDumpBuffer& buffer : m_frame_dump_buffers)
   {
-    if (m_frame_dump_thread.joinable())
-      m_frame_dump_thread.join();
-    m_frame_dump_thread_running.Set();
-    m_frame_dump_thread = std::thread(&FrameDumper::FrameDumpThreadFunc, this);
+    if (buffer.readback_texture && buffer.readback_texture->IsMapped())
+      buffer.readback_texture->Unmap();
+    buffer.readback_texture.reset();
   }
+  m_frame_dump_copy_index = 0;
 
-  // Wake worker thread up.
-  m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
-}
-
-void FrameDumper::FinishFrameData()
-{
-  if (!m_frame_dump_frame_running)
-    return;
-
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
-
-  m_frame_dump_output_texture->Unmap();
+  if (m_frame_dump_late_frames != 0)
+  {
+    WARN_LOG_FMT(VIDEO, "FrameDump: Rendering waited for the encoder on {} frames.",
+                 m_frame_dump_late_frames);
+  }
 }
 
 void FrameDumper::FrameDumpThreadFunc()
 {
   Common::SetCurrentThreadName("FrameDumping");
 
-  bool dump_to_ffmpeg = !g_ActiveConfig.bDumpFramesAsImages;
+  const bool dump_to_archive = g_ActiveConfig.bDumpFramesAsArchive;
+  bool dump_to_ffmpeg = !dump_to_archive && !g_ActiveConfig.bDumpFramesAsImages;
   bool frame_dump_started = false;
 
 // If Dolphin was compiled without ffmpeg, we only support dumping to images.
@@ -212,11 +261,19 @@ void FrameDumper::FrameDumpThreadFunc()
 
   while (true)
   {
-    m_frame_dump_start.Wait();
-    if (!m_frame_dump_thread_running.IsSet())
-      break;
-
-    auto frame = m_frame_dump_data;
+    QueuedFrame queued;
+    {
+      std::unique_lock lk(m_frame_dump_lock);
+      m_frame_dump_queued_cv.wait(lk, [this] {
+        return !m_frame_dump_queue.empty() || !m_frame_dump_thread_running.IsSet();
+      });
+      if (m_frame_dump_queue.empty())
+        break;
+
+      queued = m_frame_dump_queue.front();
+      m_frame_dump_queue.pop();
+    }
+    const FrameData& frame = queued.frame;
 
     // Save screenshot
     if (m_screenshot_request.TestAndClear())
@@ -235,7 +292,9 @@ void FrameDumper::FrameDumpThreadFunc()
     {
       if (!frame_dump_started)
       {
-        if (dump_to_ffmpeg)
+        if (dump_to_archive)
+          frame_dump_started = StartFrameDumpToArchive();
+        else if (dump_to_ffmpeg)
           frame_dump_started = StartFrameDumpToFFMPEG(frame);
         else
           frame_dump_started = StartFrameDumpToImage(frame);
@@ -248,20 +307,28 @@ void FrameDumper::FrameDumpThreadFunc()
       // If we failed to start frame dumping, don't write a frame.
       if (frame_dump_started)
       {
-        if (dump_to_ffmpeg)
+        if (dump_to_archive)
+          DumpFrameToArchive(frame);
+        else if (dump_to_ffmpeg)
           DumpFrameToFFMPEG(frame);
         else
           DumpFrameToImage(frame);
       }
     }
 
-    m_frame_dump_done.Set();
+    {
+      std::lock_guard lk(m_frame_dump_lock);
+      m_frame_dump_buffers[queued.buffer_index].in_use = false;
+    }
+    m_frame_dump_done_cv.notify_all();
   }
 
   if (frame_dump_started)
   {
     // No additional cleanup is needed when dumping to images.
-    if (dump_to_ffmpeg)
+    if (dump_to_archive)
+      StopFrameDumpToArchive();
+    else if (dump_to_ffmpeg)
       StopFrameDumpToFFMPEG();
   }
 }
@@ -335,6 +402,41 @@ void FrameDumper::DumpFrameToImage(const FrameData& frame)
   m_frame_dump_image_counter++;
 }
 
+bool FrameDumper::StartFrameDumpToArchive()
+{
+  const std::string path = fmt::format(
+      "{}{}_{:%Y-%m-%d_%H-%M-%S}{}", File::GetUserPath(D_DUMPFRAMES_IDX),
+      SConfig::GetInstance().GetGameID(), fmt::localtime(std::time(nullptr)),
+      VideoCommon::FrameDumpArchive::FILE_EXTENSION);
+  File::CreateFullPath(path);
+  if (!m_archive_writer.Open(path))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not open {}", path);
+    return false;
+  }
+
+  OSD::AddMessage(fmt::format("Dumping Frames to \"{}\"", path));
+  return true;
+}
+
+void FrameDumper::DumpFrameToArchive(const FrameData& frame)
+{
+  if (!m_archive_writer.AddFrame(frame.data, frame.width, frame.height, frame.stride,
+                                 frame.state.ticks, frame.state.frame_number))
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Failed to write frame {} to the frame dump",
+                  frame.state.frame_number);
+  }
+}
+
+void FrameDumper::StopFrameDumpToArchive()
+{
+  const u32 frame_count = m_archive_writer.GetFrameCount();
+  if (!m_archive_writer.Finish())
+    ERROR_LOG_FMT(FRAMEDUMP, "Failed to finish the frame dump");
+  OSD::AddMessage(fmt::format("Stopped dumping frames ({} written)", frame_count));
+}
+
 void FrameDumper::SaveScreenshot(std::string filename)
 {
   std::lock_guard<std::mutex> lk(m_screenshot_lock);
@@ -3,12 +3,21 @@
 
 #pragma once
 
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
 #include "Common/Thread.h"
 
+#include "VideoCommon/FrameDumpArchive.h"
 #include "VideoCommon/FrameDumpFFMpeg.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -22,10 +31,11 @@ public:
   FrameDumper();
   ~FrameDumper();
 
-  // Ensures all rendered frames are queued for encoding.
+  // Queues the frames copied before the current one for encoding. The latest copy is left for the
+  // next frame, which gives the GPU time to finish it before it is read back.
   void FlushFrameDump();
 
-  // Fills the frame dump staging texture with the current XFB texture.
+  // Copies the current XFB texture to the next free frame dump staging texture.
   void DumpCurrentFrame(const AbstractTexture* src_texture,
                         const MathUtil::Rectangle<int>& src_rect,
                         const MathUtil::Rectangle<int>& target_rect, u64 ticks, int frame_number);
@@ -45,52 +55,74 @@ private:
   std::string GetFrameDumpNextImageFileName() const;
   bool StartFrameDumpToImage(const FrameData&);
   void DumpFrameToImage(const FrameData&);
+  bool StartFrameDumpToArchive();
+  void DumpFrameToArchive(const FrameData&);
+  void StopFrameDumpToArchive();
 
   void ShutdownFrameDumping();
 
   // Checks that the frame dump render texture exists and is the correct size.
   bool CheckFrameDumpRenderTexture(u32 target_width, u32 target_height);
 
-  // Checks that the frame dump readback texture exists and is the correct size.
-  bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
+  // Checks that the frame dump readback texture of the given buffer exists and is the correct
+  // size.
+  bool CheckFrameDumpReadbackTexture(u32 index, u32 target_width, u32 target_height);
 
-  // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  // Maps the oldest copied readback texture and hands it to the frame dump thread.
+  void QueueOldestCopiedFrame();
 
-  // Ensures all encoded frames have been written to the output file.
-  void FinishFrameData();
+  // Waits until the frame dump thread is done reading from the given buffer.
+  void WaitForFrameDumpBuffer(u32 index);
 
-  std::thread m_frame_dump_thread;
-  Common::Flag m_frame_dump_thread_running;
+  // Ensures all queued frames have been written to the output file.
+  void WaitForFrameDumpThread();
 
-  // Used to kick frame dump thread.
-  Common::Event m_frame_dump_start;
+  // Readback textures are used in a ring, so the GPU can copy the next frames while the frame dump
+  // thread still encodes previous ones, and the mapped pointers are handed over without copying.
+  static constexpr u32 FRAME_DUMP_BUFFER_COUNT = 4;
 
-  // Set by frame dump thread on frame completion.
-  Common::Event m_frame_dump_done;
+  struct FrameDumpBuffer
+  {
+    std::unique_ptr<AbstractStagingTexture> readback_texture;
+    FrameState state;
+    // Set while the frame dump thread reads from the mapped texture. Protected by
+    // m_frame_dump_lock.
+    bool in_use = false;
+  };
 
-  // Holds emulation state during the last swap when dumping.
-  FrameState m_last_frame_state;
+  struct QueuedFrame
+  {
+    FrameData frame;
+    u32 buffer_index = 0;
+  };
+
+  std::thread m_frame_dump_thread;
+  Common::Flag m_frame_dump_thread_running;
 
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
+  // Communication of frames between video and dump threads.
+  std::mutex m_frame_dump_lock;
+  std::condition_variable m_frame_dump_queued_cv;
+  std::condition_variable m_frame_dump_done_cv;
+  std::queue<QueuedFrame> m_frame_dump_queue;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
-  // Set when readback texture holds a frame that needs to be dumped.
-  bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+  std::array<FrameDumpBuffer, FRAME_DUMP_BUFFER_COUNT> m_frame_dump_buffers;
+  // Buffer the next frame is copied to.
+  u32 m_frame_dump_copy_index = 0;
+  // Number of buffers holding a copied frame which hasn't been queued for encoding yet, they end
+  // right before m_frame_dump_copy_index.
+  u32 m_frame_dump_copied_count = 0;
+  // Number of frames the video thread had to wait for because the encoder fell behind.
+  u32 m_frame_dump_late_frames = 0;
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
 
   FFMpegFrameDump m_ffmpeg_dump;
+  VideoCommon::FrameDumpArchive::Writer m_archive_writer;
 
   // Screenshots
   Common::Flag m_screenshot_request;
@@ -22,6 +22,7 @@
 #include "VideoCommon/FramebufferShaderGen.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/Present.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
@@ -479,7 +480,9 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
-    PopulateEFBCache(false, tile_index);
+    PopulateEFBCacheForPeek(false, tile_index);
+  else
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_hits);
 
   m_efb_color_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -502,7 +505,9 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
 
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
-    PopulateEFBCache(true, tile_index);
+    PopulateEFBCacheForPeek(true, tile_index);
+  else
+    INCSTAT(g_stats.this_frame.num_efb_peek_cache_hits);
 
   m_efb_depth_cache.tiles[tile_index].frame_access_mask |= 1;
 
@@ -543,11 +548,13 @@ void FramebufferManager::RefreshPeekCache()
     if (m_efb_color_cache.tiles[i].frame_access_mask != 0 && !m_efb_color_cache.tiles[i].present)
     {
       PopulateEFBCache(false, i, true);
+      INCSTAT(g_stats.this_frame.num_efb_peek_tiles_prefetched);
       flush_command_buffer = true;
     }
     if (m_efb_depth_cache.tiles[i].frame_access_mask != 0 && !m_efb_depth_cache.tiles[i].present)
     {
       PopulateEFBCache(true, i, true);
+      INCSTAT(g_stats.this_frame.num_efb_peek_tiles_prefetched);
       flush_command_buffer = true;
     }
   }
@@ -561,6 +568,12 @@ void FramebufferManager::RefreshPeekCache()
   }
 }
 
+void FramebufferManager::PrefetchPeekCache()
+{
+  InvalidatePeekCache(false);
+  RefreshPeekCache();
+}
+
 void FramebufferManager::InvalidatePeekCache(bool forced)
 {
   if (forced || m_efb_color_cache.out_of_date)
@@ -852,6 +865,22 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async
   data.tiles[tile_index].present = true;
 }
 
+void FramebufferManager::PopulateEFBCacheForPeek(bool depth, u32 tile_index)
+{
+  // Games which peek usually read many pixels per frame, and each readback stalls the CPU thread
+  // until the GPU catches up. Read back every other tile that was already peeked this frame along
+  // with the requested one, so that the peeks which follow an invalidation share a single wait.
+  EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+  for (u32 i = 0; i < data.tiles.size(); i++)
+  {
+    if (i != tile_index && !data.tiles[i].present && (data.tiles[i].frame_access_mask & 1) != 0)
+      PopulateEFBCache(depth, i, true);
+  }
+
+  PopulateEFBCache(depth, tile_index);
+  INCSTAT(g_stats.this_frame.num_efb_peek_cache_misses);
+}
+
 void FramebufferManager::ClearEFB(const MathUtil::Rectangle<int>& rc, bool color_enable,
                                   bool alpha_enable, bool z_enable, u32 color, u32 z)
 {
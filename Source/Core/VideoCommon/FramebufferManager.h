@@ -120,6 +120,9 @@ public:
   void SetEFBCacheTileSize(u32 size);
   void InvalidatePeekCache(bool forced = true);
   void RefreshPeekCache();
+  // Starts reading back the tiles which were peeked in recent frames but have since been
+  // invalidated, so that peeks which follow the same pattern as the previous frames hit the cache.
+  void PrefetchPeekCache();
   void FlagPeekCacheAsOutOfDate();
   void EndOfFrame();
 
@@ -182,6 +185,7 @@ protected:
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
   void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
+  void PopulateEFBCacheForPeek(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
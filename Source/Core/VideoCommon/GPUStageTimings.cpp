@@ -0,0 +1,57 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/GPUStageTimings.h"
+
+namespace VideoCommon
+{
+namespace
+{
+struct AtomicGPUStageTiming
+{
+  std::atomic<u64> count = 0;
+  std::atomic<s64> nanoseconds = 0;
+};
+
+// Only written by the GPU thread, but read by whoever wants the results.
+Common::EnumMap<AtomicGPUStageTiming, GPUStage::Draw> s_timings;
+}  // namespace
+
+std::atomic<bool> GPUStageTimings::s_enabled = false;
+
+void GPUStageTimings::SetEnabled(bool enabled)
+{
+  s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void GPUStageTimings::Reset()
+{
+  for (AtomicGPUStageTiming& timing : s_timings)
+  {
+    timing.count.store(0, std::memory_order_relaxed);
+    timing.nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+GPUStageTimingMap GPUStageTimings::Get()
+{
+  GPUStageTimingMap result;
+  for (size_t i = 0; i < s_timings.size(); ++i)
+  {
+    const auto stage = static_cast<GPUStage>(i);
+    result[stage].count = s_timings[stage].count.load(std::memory_order_relaxed);
+    result[stage].time =
+        std::chrono::nanoseconds(s_timings[stage].nanoseconds.load(std::memory_order_relaxed));
+  }
+  return result;
+}
+
+void GPUStageTimings::Add(GPUStage stage, std::chrono::steady_clock::duration time)
+{
+  AtomicGPUStageTiming& timing = s_timings[stage];
+  timing.count.fetch_add(1, std::memory_order_relaxed);
+  timing.nanoseconds.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(time).count(),
+      std::memory_order_relaxed);
+}
+}  // namespace VideoCommon
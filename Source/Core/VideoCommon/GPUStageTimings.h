@@ -0,0 +1,74 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+#include "Common/EnumMap.h"
+
+namespace VideoCommon
+{
+// Parts of GPU command processing whose time can be measured, for benchmarking.
+// CommandProcessing includes all of the other stages.
+enum class GPUStage
+{
+  CommandProcessing,
+  VertexLoading,
+  TextureLoading,
+  ShaderUids,
+  PipelineLookup,
+  Draw,
+};
+
+struct GPUStageTiming
+{
+  u64 count = 0;
+  std::chrono::nanoseconds time{};
+};
+
+using GPUStageTimingMap = Common::EnumMap<GPUStageTiming, GPUStage::Draw>;
+
+// Timing is disabled by default, as reading the clock for every draw isn't free.
+class GPUStageTimings
+{
+public:
+  static void SetEnabled(bool enabled);
+  static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  static void Reset();
+  static GPUStageTimingMap Get();
+
+  static void Add(GPUStage stage, std::chrono::steady_clock::duration time);
+
+private:
+  static std::atomic<bool> s_enabled;
+};
+
+class ScopedGPUStageTimer
+{
+public:
+  explicit ScopedGPUStageTimer(GPUStage stage)
+      : m_stage(stage), m_enabled(GPUStageTimings::IsEnabled())
+  {
+    if (m_enabled) [[unlikely]]
+      m_start = std::chrono::steady_clock::now();
+  }
+
+  ~ScopedGPUStageTimer()
+  {
+    if (m_enabled) [[unlikely]]
+      GPUStageTimings::Add(m_stage, std::chrono::steady_clock::now() - m_start);
+  }
+
+  ScopedGPUStageTimer(const ScopedGPUStageTimer&) = delete;
+  ScopedGPUStageTimer& operator=(const ScopedGPUStageTimer&) = delete;
+
+private:
+  GPUStage m_stage;
+  bool m_enabled;
+  std::chrono::steady_clock::time_point m_start;
+};
+}  // namespace VideoCommon
@@ -27,28 +27,35 @@
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/DirectFilesystemAssetLibrary.h"
+#include "VideoCommon/Assets/TexturePackLibrary.h"
 #include "VideoCommon/OnScreenDisplay.h"
 #include "VideoCommon/VideoConfig.h"
 
 constexpr std::string_view s_format_prefix{"tex1_"};
 
 static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_texture_cache;
-static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
+
+struct HiresTextureSource
+{
+  bool has_arbitrary_mipmaps;
+  std::shared_ptr<VideoCommon::CustomAssetLibrary> library;
+};
+static std::unordered_map<std::string, HiresTextureSource> s_hires_texture_id_to_source;
 
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
 namespace
 {
-std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
+std::pair<std::string, HiresTextureSource> GetNameSourcePair(const TextureInfo& texture_info)
 {
-  if (s_hires_texture_id_to_arbmipmap.empty())
-    return {"", false};
+  if (s_hires_texture_id_to_source.empty())
+    return {"", {}};
 
   const auto texture_name_details = texture_info.CalculateTextureName();
   // look for an exact match first
   const std::string full_name = texture_name_details.GetFullName();
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(full_name);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  if (auto iter = s_hires_texture_id_to_source.find(full_name);
+      iter != s_hires_texture_id_to_source.end())
   {
     return {full_name, iter->second};
   }
@@ -57,8 +64,8 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
   const std::string texture_name_single_wildcard_tlut =
       fmt::format("{}_{}_$_{}", texture_name_details.base_name, texture_name_details.texture_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tlut);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  if (auto iter = s_hires_texture_id_to_source.find(texture_name_single_wildcard_tlut);
+      iter != s_hires_texture_id_to_source.end())
   {
     return {texture_name_single_wildcard_tlut, iter->second};
   }
@@ -67,13 +74,13 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
   const std::string texture_name_single_wildcard_tex =
       fmt::format("{}_${}_{}", texture_name_details.base_name, texture_name_details.tlut_name,
                   texture_name_details.format_name);
-  if (auto iter = s_hires_texture_id_to_arbmipmap.find(texture_name_single_wildcard_tex);
-      iter != s_hires_texture_id_to_arbmipmap.end())
+  if (auto iter = s_hires_texture_id_to_source.find(texture_name_single_wildcard_tex);
+      iter != s_hires_texture_id_to_source.end())
   {
     return {texture_name_single_wildcard_tex, iter->second};
   }
 
-  return {"", false};
+  return {"", {}};
 }
 }  // namespace
 
@@ -101,6 +108,7 @@ void HiresTexture::Update()
   const std::vector<std::string> extensions{".png", ".dds"};
 
   auto& system = Core::System::GetInstance();
+  using LoadPriority = VideoCommon::CustomAssetLoader::LoadPriority;
 
   for (const auto& texture_directory : texture_directories)
   {
@@ -120,8 +128,8 @@ void HiresTexture::Update()
         if (has_arbitrary_mipmaps)
           filename.erase(arb_index, 4);
 
-        const auto [it, inserted] =
-            s_hires_texture_id_to_arbmipmap.try_emplace(filename, has_arbitrary_mipmaps);
+        const auto [it, inserted] = s_hires_texture_id_to_source.try_emplace(
+            filename, HiresTextureSource{has_arbitrary_mipmaps, s_file_library});
         if (!inserted)
         {
           failed_insert = true;
@@ -137,7 +145,8 @@ void HiresTexture::Update()
           {
             auto hires_texture = std::make_shared<HiresTexture>(
                 has_arbitrary_mipmaps,
-                system.GetCustomAssetLoader().LoadGameTexture(filename, s_file_library));
+                system.GetCustomAssetLoader().LoadGameTexture(filename, s_file_library,
+                                                              LoadPriority::Prefetch));
             s_hires_texture_cache.try_emplace(filename, std::move(hires_texture));
           }
         }
@@ -151,6 +160,45 @@ void HiresTexture::Update()
     }
   }
 
+  // Texture packs are only used for textures that don't exist as loose files, so that individual
+  // textures of a pack can be overridden without rebuilding it
+  for (const auto& texture_directory : texture_directories)
+  {
+    const auto pack_paths = Common::DoFileSearch(
+        {texture_directory}, {std::string(VideoCommon::TexturePackLibrary::FILE_EXTENSION)},
+        /*recursive*/ true);
+    for (const auto& pack_path : pack_paths)
+    {
+      auto pack = VideoCommon::TexturePackLibrary::Open(pack_path);
+      if (!pack)
+        continue;
+
+      bool failed_insert = false;
+      for (const auto& texture : pack->GetTextures())
+      {
+        const auto [it, inserted] = s_hires_texture_id_to_source.try_emplace(
+            texture.asset_id, HiresTextureSource{texture.has_arbitrary_mipmaps, pack});
+        if (!inserted)
+        {
+          failed_insert = true;
+        }
+        else if (g_ActiveConfig.bCacheHiresTextures)
+        {
+          auto hires_texture = std::make_shared<HiresTexture>(
+              texture.has_arbitrary_mipmaps,
+              system.GetCustomAssetLoader().LoadGameTexture(texture.asset_id, pack,
+                                                            LoadPriority::Prefetch));
+          s_hires_texture_cache.try_emplace(texture.asset_id, std::move(hires_texture));
+        }
+      }
+
+      if (failed_insert)
+      {
+        WARN_LOG_FMT(VIDEO, "One or more textures in pack '{}' were already inserted", pack_path);
+      }
+    }
+  }
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
@@ -159,33 +207,36 @@ void HiresTexture::Update()
   else
   {
     OSD::AddMessage(
-        fmt::format("Found '{}' custom textures", s_hires_texture_id_to_arbmipmap.size()), 10000);
+        fmt::format("Found '{}' custom textures", s_hires_texture_id_to_source.size()), 10000);
   }
 }
 
 void HiresTexture::Clear()
 {
   s_hires_texture_cache.clear();
-  s_hires_texture_id_to_arbmipmap.clear();
+  s_hires_texture_id_to_source.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 }
 
 std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_info)
 {
-  const auto [base_filename, has_arb_mipmaps] = GetNameArbPair(texture_info);
+  const auto [base_filename, source] = GetNameSourcePair(texture_info);
   if (base_filename == "")
     return nullptr;
 
+  auto& system = Core::System::GetInstance();
   if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
   {
+    // Cached textures may have been evicted to stay within the memory budget, reload them
+    // with high priority now that the game uses them again
+    system.GetCustomAssetLoader().MarkGameTextureUsed(iter->second->GetAsset());
     return iter->second;
   }
   else
   {
-    auto& system = Core::System::GetInstance();
     auto hires_texture = std::make_shared<HiresTexture>(
-        has_arb_mipmaps,
-        system.GetCustomAssetLoader().LoadGameTexture(base_filename, s_file_library));
+        source.has_arbitrary_mipmaps,
+        system.GetCustomAssetLoader().LoadGameTexture(base_filename, source.library));
     if (g_ActiveConfig.bCacheHiresTextures)
     {
       s_hires_texture_cache.try_emplace(base_filename, hires_texture);
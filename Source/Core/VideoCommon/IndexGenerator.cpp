@@ -4,6 +4,7 @@
 #include "VideoCommon/IndexGenerator.h"
 
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstring>
 
@@ -168,6 +169,48 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
   return AddQuads<pr>(index_ptr, num_verts, index);
 }
 
+template <bool pr, OpcodeDecoder::Primitive primitive>
+u16* AddVisibleTriangles(u16* index_ptr, u32 num_verts, u32 index, const u64* visible)
+{
+  const u32 num_words = (IndexGenerator::GetTriangleCount(primitive, num_verts) + 63) / 64;
+  for (u32 word = 0; word < num_words; ++word)
+  {
+    // Whole groups of culled triangles are skipped at once
+    for (u64 bits = visible[word]; bits != 0; bits &= bits - 1)
+    {
+      const u32 triangle = word * 64 + std::countr_zero(bits);
+      switch (primitive)
+      {
+      case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+      case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+      {
+        const u32 quad = index + (triangle / 2) * 4;
+        const u32 second = triangle & 1;
+        index_ptr = WriteTriangle<pr>(index_ptr, quad, quad + 1 + second, quad + 2 + second);
+        break;
+      }
+      case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+        index_ptr = WriteTriangle<pr>(index_ptr, index + triangle * 3, index + triangle * 3 + 1,
+                                      index + triangle * 3 + 2);
+        break;
+      case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+      {
+        const u32 wind = triangle & 1;
+        index_ptr = WriteTriangle<pr>(index_ptr, index + triangle, index + triangle + 1 + wind,
+                                      index + triangle + 2 - wind);
+        break;
+      }
+      case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+        index_ptr = WriteTriangle<pr>(index_ptr, index, index + triangle + 1, index + triangle + 2);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  return index_ptr;
+}
+
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
   for (u32 i = 1; i < num_verts; i += 2)
@@ -273,6 +316,17 @@ void IndexGenerator::Init()
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<true>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_STRIP] = AddStrip<true>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_FAN] = AddFan<true>;
+    m_visible_triangles_table[Primitive::GX_DRAW_QUADS] =
+        AddVisibleTriangles<true, Primitive::GX_DRAW_QUADS>;
+    m_visible_triangles_table[Primitive::GX_DRAW_QUADS_2] =
+        AddVisibleTriangles<true, Primitive::GX_DRAW_QUADS_2>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLES] =
+        AddVisibleTriangles<true, Primitive::GX_DRAW_TRIANGLES>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLE_STRIP] =
+        AddVisibleTriangles<true, Primitive::GX_DRAW_TRIANGLE_STRIP>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLE_FAN] =
+        AddVisibleTriangles<true, Primitive::GX_DRAW_TRIANGLE_FAN>;
+    m_indices_per_triangle = 4;
   }
   else
   {
@@ -281,6 +335,17 @@ void IndexGenerator::Init()
     m_primitive_table[Primitive::GX_DRAW_TRIANGLES] = AddList<false>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_STRIP] = AddStrip<false>;
     m_primitive_table[Primitive::GX_DRAW_TRIANGLE_FAN] = AddFan<false>;
+    m_visible_triangles_table[Primitive::GX_DRAW_QUADS] =
+        AddVisibleTriangles<false, Primitive::GX_DRAW_QUADS>;
+    m_visible_triangles_table[Primitive::GX_DRAW_QUADS_2] =
+        AddVisibleTriangles<false, Primitive::GX_DRAW_QUADS_2>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLES] =
+        AddVisibleTriangles<false, Primitive::GX_DRAW_TRIANGLES>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLE_STRIP] =
+        AddVisibleTriangles<false, Primitive::GX_DRAW_TRIANGLE_STRIP>;
+    m_visible_triangles_table[Primitive::GX_DRAW_TRIANGLE_FAN] =
+        AddVisibleTriangles<false, Primitive::GX_DRAW_TRIANGLE_FAN>;
+    m_indices_per_triangle = 3;
   }
   if (g_Config.UseVSForLinePointExpand())
   {
@@ -319,6 +384,25 @@ void IndexGenerator::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vert
   m_base_index += num_vertices;
 }
 
+void IndexGenerator::AddVisibleIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                       const u64* visible_triangles, u32 num_visible_triangles)
+{
+  // Strips, fans and quads share indices between their triangles with primitive restart, so
+  // listing the visible triangles separately is only worth it if enough of them were culled.
+  u16* const start = m_index_buffer_current;
+  u16* const end = m_primitive_table[primitive](start, num_vertices, m_base_index);
+  if (num_visible_triangles * m_indices_per_triangle < static_cast<u32>(end - start))
+  {
+    m_index_buffer_current = m_visible_triangles_table[primitive](start, num_vertices,
+                                                                  m_base_index, visible_triangles);
+  }
+  else
+  {
+    m_index_buffer_current = end;
+  }
+  m_base_index += num_vertices;
+}
+
 void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices)
 {
   std::memcpy(m_index_buffer_current, indices, sizeof(u16) * num_indices);
@@ -354,3 +438,20 @@ u32 IndexGenerator::GetRemainingIndices(OpcodeDecoder::Primitive primitive) cons
 
   return max_index - m_base_index;
 }
+
+u32 IndexGenerator::GetTriangleCount(OpcodeDecoder::Primitive primitive, u32 num_vertices)
+{
+  switch (primitive)
+  {
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS:
+  case OpcodeDecoder::Primitive::GX_DRAW_QUADS_2:
+    return num_vertices / 4 * 2 + (num_vertices % 4 == 3);
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLES:
+    return num_vertices / 3;
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_STRIP:
+  case OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN:
+    return num_vertices < 3 ? 0 : num_vertices - 2;
+  default:
+    return 0;
+  }
+}
@@ -17,6 +17,9 @@ public:
   void Start(u16* index_ptr);
 
   void AddIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices);
+  // Leaves out the triangles without a bit set in visible_triangles, see CPUCull
+  void AddVisibleIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                         const u64* visible_triangles, u32 num_visible_triangles);
 
   void AddExternalIndices(const u16* indices, u32 num_indices, u32 num_vertices);
 
@@ -25,11 +28,17 @@ public:
   u32 GetIndexLen() const { return static_cast<u32>(m_index_buffer_current - m_base_index_ptr); }
   u32 GetRemainingIndices(OpcodeDecoder::Primitive primitive) const;
 
+  static u32 GetTriangleCount(OpcodeDecoder::Primitive primitive, u32 num_vertices);
+
 private:
   u16* m_index_buffer_current = nullptr;
   u16* m_base_index_ptr = nullptr;
   u32 m_base_index = 0;
+  u32 m_indices_per_triangle = 3;
 
   using PrimitiveFunction = u16* (*)(u16*, u32, u32);
   Common::EnumMap<PrimitiveFunction, OpcodeDecoder::Primitive::GX_DRAW_POINTS> m_primitive_table{};
+  using VisibleTrianglesFunction = u16* (*)(u16*, u32, u32, const u64*);
+  Common::EnumMap<VisibleTrianglesFunction, OpcodeDecoder::Primitive::GX_DRAW_TRIANGLE_FAN>
+      m_visible_triangles_table{};
 };
@@ -24,6 +24,7 @@
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/Fifo.h"
+#include "VideoCommon/GPUStageTimings.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -262,7 +263,16 @@ u8* RunFifo(DataReader src, u32* cycles)
 {
   using CallbackT = RunCallback<is_preprocess>;
   auto callback = CallbackT{};
-  u32 size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
+  u32 size;
+  if constexpr (is_preprocess)
+  {
+    size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
+  }
+  else
+  {
+    VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::CommandProcessing);
+    size = Run(src.GetPointer(), static_cast<u32>(src.size()), callback);
+  }
 
   if (cycles != nullptr)
     *cycles = callback.m_cycles;
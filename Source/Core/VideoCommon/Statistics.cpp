@@ -111,6 +111,10 @@ void Statistics::Display() const
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("EFB peek cache hits:", "%d", this_frame.num_efb_peek_cache_hits);
+  draw_statistic("EFB peek cache misses:", "%d", this_frame.num_efb_peek_cache_misses);
+  draw_statistic("EFB tiles prefetched:", "%d", this_frame.num_efb_peek_tiles_prefetched);
+  draw_statistic("EFB peek stall:", "%d us", this_frame.efb_peek_stall_us);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
@@ -71,6 +71,10 @@ struct Statistics
 
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
+    int num_efb_peek_cache_hits = 0;
+    int num_efb_peek_cache_misses = 0;
+    int num_efb_peek_tiles_prefetched = 0;
+    int efb_peek_stall_us = 0;
 
     int num_draw_done = 0;
     int num_token = 0;
@@ -36,6 +36,7 @@
 #include "VideoCommon/AbstractFramebuffer.h"
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/AbstractStagingTexture.h"
+#include "VideoCommon/Assets/CustomAssetLoader.h"
 #include "VideoCommon/Assets/CustomTextureData.h"
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/FramebufferManager.h"
@@ -66,6 +67,67 @@ static int xfb_count = 0;
 
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
+// Hashes guest texture memory (RAM or TMEM) for cache lookups. These hashes are never persisted,
+// so switching algorithms only requires invalidating the cache.
+static u64 GetTextureMemoryHash(const u8* src, u32 len, u32 samples)
+{
+  if (g_ActiveConfig.bFastTextureHashing)
+    return Common::GetHash64XXH3(src, len, samples);
+  return Common::GetHash64(src, len, samples);
+}
+
+// Textures with fewer texels (counting all mip levels) are decoded on the GPU thread, as waking up
+// the texture decoding threads would take about as long as decoding them.
+static constexpr u32 MIN_THREADED_DECODE_TEXELS = 256 * 256;
+
+// Approximate number of texels decoded by a single job on the texture decoding threads.
+static constexpr u32 THREADED_DECODE_SLICE_TEXELS = 32 * 1024;
+
+struct TextureDecodeJob
+{
+  struct Level
+  {
+    u32 level = 0;
+    u32 width = 0;
+    u32 height = 0;
+    u32 expanded_width = 0;
+    u32 expanded_height = 0;
+    const u8* src = nullptr;
+    u32 src_size = 0;
+    u8* dst = nullptr;
+    u32 decoded_size = 0;
+    Common::ThreadPool::WaitGroup decoded;
+  };
+
+  explicit TextureDecodeJob(size_t num_levels) : levels(num_levels) {}
+  ~TextureDecodeJob() { Common::FreeAlignedMemory(owned_buffer); }
+
+  TextureDecodeJob(const TextureDecodeJob&) = delete;
+  TextureDecodeJob& operator=(const TextureDecodeJob&) = delete;
+
+  bool IsDone() const
+  {
+    return std::all_of(levels.begin(), levels.end(),
+                       [](const Level& level) { return level.decoded.IsDone(); });
+  }
+
+  TextureFormat format = TextureFormat::I4;
+  TLUTFormat tlut_format = TLUTFormat::IA8;
+  const u8* tlut = nullptr;
+  u32 num_texture_levels = 0;
+  std::vector<Level> levels;
+
+  // Scratch space for the arbitrary mipmap detection.
+  u8* downsample_buffer = nullptr;
+
+  // Only allocated for asynchronous decoding, which can't use m_temp, and also has to copy the
+  // source data since emulated memory can change before the decoding threads get to it.
+  u8* owned_buffer = nullptr;
+
+  // Empty if the texture should not be dumped.
+  std::string dump_name;
+};
+
 TCacheEntry::TCacheEntry(std::unique_ptr<AbstractTexture> tex,
                          std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
@@ -114,6 +176,8 @@ void TextureCacheBase::Shutdown()
 
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
   Invalidate();
+
+  m_decoding_pool.Shutdown();
 }
 
 TextureCacheBase::~TextureCacheBase()
@@ -130,6 +194,8 @@ bool TextureCacheBase::Initialize()
     return false;
   }
 
+  m_decoding_pool.Start("Texture Decoding", g_ActiveConfig.GetTextureDecodingThreads());
+
   return true;
 }
 
@@ -140,6 +206,7 @@ void TextureCacheBase::Invalidate()
 
   for (auto& bind : m_bound_textures)
     bind.reset();
+  m_pending_decodes.clear();
   m_textures_by_hash.clear();
   m_textures_by_address.clear();
 
@@ -159,6 +226,7 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
 
   // TODO: Invalidating texcache is really stupid in some of these cases
   if (config.iSafeTextureCache_ColorSamples != m_backup_config.color_samples ||
+      config.bFastTextureHashing != m_backup_config.fast_texture_hashing ||
       config.bTexFmtOverlayEnable != m_backup_config.texfmt_overlay ||
       config.bTexFmtOverlayCenter != m_backup_config.texfmt_overlay_center ||
       config.bHiresTextures != m_backup_config.hires_textures ||
@@ -172,6 +240,13 @@ void TextureCacheBase::OnConfigChanged(const VideoConfig& config)
     TexDecoder_SetTexFmtOverlayOptions(config.bTexFmtOverlayEnable, config.bTexFmtOverlayCenter);
   }
 
+  const u32 decoding_threads = config.GetTextureDecodingThreads();
+  if (decoding_threads != m_decoding_pool.GetThreadCount())
+  {
+    FinishPendingTextureDecodes();
+    m_decoding_pool.Start("Texture Decoding", decoding_threads);
+  }
+
   SetBackupConfig(config);
 }
 
@@ -248,6 +323,7 @@ bool TCacheEntry::OverlapsMemoryRange(u32 range_address, u32 range_size) const
 void TextureCacheBase::SetBackupConfig(const VideoConfig& config)
 {
   m_backup_config.color_samples = config.iSafeTextureCache_ColorSamples;
+  m_backup_config.fast_texture_hashing = config.bFastTextureHashing;
   m_backup_config.texfmt_overlay = config.bTexFmtOverlayEnable;
   m_backup_config.texfmt_overlay_center = config.bTexFmtOverlayCenter;
   m_backup_config.hires_textures = config.bHiresTextures;
@@ -564,6 +640,7 @@ void TextureCacheBase::DoState(PointerWrap& p)
 {
   // Flush all pending XFB copies before either loading or saving.
   FlushEFBCopies();
+  FinishPendingTextureDecodes();
 
   p.Do(m_last_entry_id);
 
@@ -787,6 +864,9 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
 void TextureCacheBase::OnFrameEnd()
 {
+  // Asynchronously decoded textures only get to show a placeholder for a single frame.
+  FinishPendingTextureDecodes();
+
   // Flush any outstanding EFB copies to RAM, in case the game is running at an uncapped frame
   // rate and not waiting for vblank. Otherwise, we'd end up with a huge list of pending
   // copies.
@@ -861,6 +941,9 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
     {
       if (entry->hash == entry->CalculateHash())
       {
+        // The copy is drawn on top of the decoded texture, so that has to be uploaded first.
+        FinishTextureDecode(*entry_to_update);
+
         // If the texture formats are not compatible or convertible, skip it.
         if (!IsCompatibleTextureFormat(entry_to_update->format.texfmt, entry->format.texfmt))
         {
@@ -1089,7 +1172,16 @@ void TextureCacheBase::BindTextures(BitSet32 used_textures)
     const RcTcacheEntry& tentry = m_bound_textures[i];
     if (used_textures[i] && tentry)
     {
-      g_gfx->SetTexture(i, tentry->texture.get());
+      AbstractTexture* texture = tentry->texture.get();
+      if (tentry->pending_decode)
+      {
+        if (tentry->pending_decode->IsDone())
+          FinishTextureDecode(*tentry);
+        else
+          texture = m_decoding_placeholder_texture.get();
+      }
+
+      g_gfx->SetTexture(i, texture);
       pixel_shader_manager.SetTexDims(i, tentry->native_width, tentry->native_height);
 
       const float custom_tex_scale = tentry->GetWidth() / float(tentry->native_width);
@@ -1251,6 +1343,13 @@ TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
   {
     if (!DidLinkedAssetsChange(*entry))
     {
+      // Keep the custom textures the game keeps using from being the first to be unloaded
+      auto& loader = Core::System::GetInstance().GetCustomAssetLoader();
+      for (const auto& cached_asset : entry->linked_game_texture_assets)
+      {
+        if (cached_asset.m_asset)
+          loader.MarkGameTextureUsed(cached_asset.m_asset);
+      }
       return entry;
     }
 
@@ -1356,15 +1455,15 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
-  base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
-                                textureCacheSafetyColorSampleSize);
+  base_hash = GetTextureMemoryHash(texture_info.GetData(), texture_info.GetTextureSize(),
+                                  textureCacheSafetyColorSampleSize);
   u32 palette_size = 0;
   if (texture_info.GetPaletteSize())
   {
     palette_size = *texture_info.GetPaletteSize();
-    full_hash =
-        base_hash ^ Common::GetHash64(texture_info.GetTlutAddress(), *texture_info.GetPaletteSize(),
-                                      textureCacheSafetyColorSampleSize);
+    full_hash = base_hash ^ GetTextureMemoryHash(texture_info.GetTlutAddress(),
+                                                 *texture_info.GetPaletteSize(),
+                                                 textureCacheSafetyColorSampleSize);
   }
   else
   {
@@ -1656,6 +1755,20 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
 // Note: the following function assumes all CustomTextureData has a single slice.  This is verified
 // with the 'GameTexture::Validate' function after the data is loaded. Only a single slice is
 // expected because each texture is loaded into a texture array
+static void DumpTextureLevels(const TCacheEntry& entry, const std::string& basename, u32 levels)
+{
+  if (g_ActiveConfig.bDumpBaseTextures)
+    VideoCommon::TextureUtils::DumpTexture(*entry.texture, basename, 0, entry.has_arbitrary_mips);
+  if (g_ActiveConfig.bDumpMipmapTextures)
+  {
+    for (u32 level = 1; level < levels; ++level)
+    {
+      VideoCommon::TextureUtils::DumpTexture(*entry.texture, basename, level,
+                                             entry.has_arbitrary_mips);
+    }
+  }
+}
+
 RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     const TextureCreationInfo& creation_info, const TextureInfo& texture_info,
     const int safety_color_sample_size,
@@ -1728,107 +1841,100 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
         g_ActiveConfig.UseGPUTextureDecoding() &&
         !(texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8);
 
-    ArbitraryMipmapDetector arbitrary_mip_detector;
-
-    // Initialized to null because only software loading uses this buffer
-    u8* dst_buffer = nullptr;
-
-    if (!decode_on_gpu ||
-        !DecodeTextureOnGPU(
-            entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
-            texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
-            creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
-            texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
+    if (!decode_on_gpu && ShouldDecodeOnThreads(texture_info, texLevels))
     {
-      size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
-
-      // Allocate memory for all levels at once
-      size_t total_texture_size = decoded_texture_size;
+      DecodeTextureOnThreads(entry, texture_info, texLevels, skip_texture_dump);
+    }
+    else
+    {
+      ArbitraryMipmapDetector arbitrary_mip_detector;
 
-      // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
-      size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
+      // Initialized to null because only software loading uses this buffer
+      u8* dst_buffer = nullptr;
 
-      size_t prev_level_size = decoded_texture_size;
-      for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+      if (!decode_on_gpu ||
+          !DecodeTextureOnGPU(
+              entry, 0, texture_info.GetData(), texture_info.GetTextureSize(),
+              texture_info.GetTextureFormat(), width, height, expanded_width, expanded_height,
+              creation_info.bytes_per_block * (expanded_width / texture_info.GetBlockWidth()),
+              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
-        prev_level_size /= 4;
-        total_texture_size += prev_level_size;
-      }
+        size_t decoded_texture_size = expanded_width * sizeof(u32) * expanded_height;
 
-      // Add space for the downsampling at the end
-      total_texture_size += mip_downsample_buffer_size;
+        // Allocate memory for all levels at once
+        size_t total_texture_size = decoded_texture_size;
 
-      CheckTempSize(total_texture_size);
-      dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
+        // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+        size_t mip_downsample_buffer_size = decoded_texture_size * 5 / 16;
 
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
+        size_t prev_level_size = decoded_texture_size;
+        for (u32 i = 1; i < texture_info.GetLevelCount(); ++i)
+        {
+          prev_level_size /= 4;
+          total_texture_size += prev_level_size;
+        }
 
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
+        // Add space for the downsampling at the end
+        total_texture_size += mip_downsample_buffer_size;
 
-      dst_buffer += decoded_texture_size;
-    }
-
-    for (u32 level = 1; level != texLevels; ++level)
-    {
-      auto mip_level = texture_info.GetMipMapLevel(level - 1);
-      if (!mip_level)
-        continue;
+        CheckTempSize(total_texture_size);
+        dst_buffer = m_temp;
+        if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
+        {
+          TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
+                            texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
+                            texture_info.GetTlutFormat());
+        }
+        else
+        {
+          TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
+                                         texture_info.GetTmemOddAddress(), expanded_width,
+                                         expanded_height);
+        }
 
-      if (!decode_on_gpu ||
-          !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
-                              texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
-                              mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
-                              mip_level->GetExpandedHeight(),
-                              creation_info.bytes_per_block *
-                                  (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
-                              texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
-      {
-        // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
-        const u32 decoded_mip_size =
-            mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
-
-        dst_buffer += decoded_mip_size;
-      }
-    }
+        entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
 
-    entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+        arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
 
-    if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
-    {
-      const std::string basename = texture_info.CalculateTextureName().GetFullName();
-      if (g_ActiveConfig.bDumpBaseTextures)
-      {
-        VideoCommon::TextureUtils::DumpTexture(*entry->texture, basename, 0,
-                                               entry->has_arbitrary_mips);
+        dst_buffer += decoded_texture_size;
       }
-      if (g_ActiveConfig.bDumpMipmapTextures)
+
+      for (u32 level = 1; level != texLevels; ++level)
       {
-        for (u32 level = 1; level < texLevels; ++level)
+        auto mip_level = texture_info.GetMipMapLevel(level - 1);
+        if (!mip_level)
+          continue;
+
+        if (!decode_on_gpu ||
+            !DecodeTextureOnGPU(entry, level, mip_level->GetData(), mip_level->GetTextureSize(),
+                                texture_info.GetTextureFormat(), mip_level->GetRawWidth(),
+                                mip_level->GetRawHeight(), mip_level->GetExpandedWidth(),
+                                mip_level->GetExpandedHeight(),
+                                creation_info.bytes_per_block *
+                                    (mip_level->GetExpandedWidth() / texture_info.GetBlockWidth()),
+                                texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
         {
-          VideoCommon::TextureUtils::DumpTexture(*entry->texture, basename, level,
-                                                 entry->has_arbitrary_mips);
+          // No need to call CheckTempSize here, as the whole buffer is preallocated at the
+          // beginning
+          const u32 decoded_mip_size =
+              mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
+          TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
+                            mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
+                            texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
+          entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                               mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
+
+          arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                          mip_level->GetExpandedWidth(), dst_buffer);
+
+          dst_buffer += decoded_mip_size;
         }
       }
+
+      entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
+
+      if (g_ActiveConfig.bDumpTextures && !skip_texture_dump && texLevels > 0)
+        DumpTextureLevels(*entry, texture_info.CalculateTextureName().GetFullName(), texLevels);
     }
   }
 
@@ -1862,6 +1968,188 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+bool TextureCacheBase::ShouldDecodeOnThreads(const TextureInfo& texture_info, u32 levels) const
+{
+  if (m_decoding_pool.GetThreadCount() == 0)
+    return false;
+
+  // RGBA8 textures in TMEM are split across both banks, and there's nothing to convert anyway.
+  if (texture_info.IsFromTmem() && texture_info.GetTextureFormat() == TextureFormat::RGBA8)
+    return false;
+
+  u32 texels = texture_info.GetExpandedWidth() * texture_info.GetExpandedHeight();
+  for (u32 level = 1; level < levels; ++level)
+  {
+    if (const auto* mip_level = texture_info.GetMipMapLevel(level - 1))
+      texels += mip_level->GetExpandedWidth() * mip_level->GetExpandedHeight();
+  }
+
+  return texels >= MIN_THREADED_DECODE_TEXELS;
+}
+
+void TextureCacheBase::DecodeTextureOnThreads(RcTcacheEntry& entry, const TextureInfo& texture_info,
+                                              u32 levels, bool skip_texture_dump)
+{
+  const bool async = g_ActiveConfig.bAsyncTextureDecoding;
+
+  u32 num_decoded_levels = 1;
+  for (u32 level = 1; level < levels; ++level)
+  {
+    if (texture_info.GetMipMapLevel(level - 1))
+      ++num_decoded_levels;
+  }
+
+  auto job = std::make_shared<TextureDecodeJob>(num_decoded_levels);
+  job->format = texture_info.GetTextureFormat();
+  job->tlut_format = texture_info.GetTlutFormat();
+  job->tlut = texture_info.GetTlutAddress();
+  job->num_texture_levels = levels;
+
+  auto level_iter = job->levels.begin();
+  level_iter->width = texture_info.GetRawWidth();
+  level_iter->height = texture_info.GetRawHeight();
+  level_iter->expanded_width = texture_info.GetExpandedWidth();
+  level_iter->expanded_height = texture_info.GetExpandedHeight();
+  level_iter->src = texture_info.GetData();
+  level_iter->src_size = texture_info.GetTextureSize();
+  for (u32 level = 1; level < levels; ++level)
+  {
+    const auto* mip_level = texture_info.GetMipMapLevel(level - 1);
+    if (!mip_level)
+      continue;
+
+    ++level_iter;
+    level_iter->level = level;
+    level_iter->width = mip_level->GetRawWidth();
+    level_iter->height = mip_level->GetRawHeight();
+    level_iter->expanded_width = mip_level->GetExpandedWidth();
+    level_iter->expanded_height = mip_level->GetExpandedHeight();
+    level_iter->src = mip_level->GetData();
+    level_iter->src_size = mip_level->GetTextureSize();
+  }
+
+  size_t decoded_size = 0;
+  size_t src_size = 0;
+  for (TextureDecodeJob::Level& level : job->levels)
+  {
+    level.decoded_size = level.expanded_width * sizeof(u32) * level.expanded_height;
+    decoded_size += level.decoded_size;
+    src_size += Common::AlignUp(level.src_size, 32);
+  }
+
+  // For the downsample, we need 2 buffers; 1 is 1/4 of the original texture, the other 1/16
+  const size_t downsample_size = Common::AlignUp(job->levels[0].decoded_size * 5 / 16, 32);
+  const size_t tlut_size = job->tlut ? texture_info.GetPaletteSize().value_or(0) : 0;
+
+  u8* buffer;
+  if (async)
+  {
+    job->owned_buffer = static_cast<u8*>(
+        Common::AllocateAlignedMemory(decoded_size + downsample_size + src_size + tlut_size, 32));
+    buffer = job->owned_buffer;
+  }
+  else
+  {
+    CheckTempSize(decoded_size + downsample_size);
+    buffer = m_temp;
+  }
+
+  for (TextureDecodeJob::Level& level : job->levels)
+  {
+    level.dst = buffer;
+    buffer += level.decoded_size;
+  }
+  job->downsample_buffer = buffer;
+  buffer += downsample_size;
+
+  if (async)
+  {
+    for (TextureDecodeJob::Level& level : job->levels)
+    {
+      std::memcpy(buffer, level.src, level.src_size);
+      level.src = buffer;
+      buffer += Common::AlignUp(level.src_size, 32);
+    }
+    if (tlut_size != 0)
+    {
+      std::memcpy(buffer, job->tlut, tlut_size);
+      job->tlut = buffer;
+    }
+  }
+
+  // Queue all levels at once, so that the threads keep decoding the smaller levels while the
+  // larger ones are being uploaded.
+  const u32 block_height = texture_info.GetBlockHeight();
+  for (TextureDecodeJob::Level& level : job->levels)
+  {
+    const u32 rows_per_slice = std::max(
+        block_height,
+        Common::AlignDown(THREADED_DECODE_SLICE_TEXELS / level.expanded_width, block_height));
+    for (u32 row = 0; row < level.expanded_height; row += rows_per_slice)
+    {
+      const u32 num_rows = std::min(rows_per_slice, level.expanded_height - row);
+      m_decoding_pool.Submit(
+          [job, &level, row, num_rows] {
+            TexDecoder_DecodeRows(level.dst, level.src, level.expanded_width, row, num_rows,
+                                  job->format, job->tlut, job->tlut_format);
+          },
+          &level.decoded);
+    }
+  }
+
+  if (g_ActiveConfig.bDumpTextures && !skip_texture_dump)
+    job->dump_name = texture_info.CalculateTextureName().GetFullName();
+
+  if (async)
+  {
+    entry->pending_decode = std::move(job);
+    m_pending_decodes.push_back(entry);
+  }
+  else
+  {
+    LoadDecodedTexture(*entry, *job);
+  }
+}
+
+void TextureCacheBase::LoadDecodedTexture(TCacheEntry& entry, TextureDecodeJob& job)
+{
+  ArbitraryMipmapDetector arbitrary_mip_detector;
+
+  for (TextureDecodeJob::Level& level : job.levels)
+  {
+    // Only wait for the slices of this level, the following levels are decoded in the meantime.
+    m_decoding_pool.Wait(level.decoded);
+
+    TexDecoder_DrawFormatOverlay(level.dst, level.expanded_width, level.expanded_height,
+                                 job.format);
+    entry.texture->Load(level.level, level.width, level.height, level.expanded_width, level.dst,
+                        level.decoded_size);
+
+    arbitrary_mip_detector.AddLevel(level.width, level.height, level.expanded_width, level.dst);
+  }
+
+  entry.has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(job.downsample_buffer);
+
+  if (!job.dump_name.empty())
+    DumpTextureLevels(entry, job.dump_name, job.num_texture_levels);
+}
+
+void TextureCacheBase::FinishTextureDecode(TCacheEntry& entry)
+{
+  if (!entry.pending_decode)
+    return;
+
+  const std::shared_ptr<TextureDecodeJob> job = std::move(entry.pending_decode);
+  LoadDecodedTexture(entry, *job);
+}
+
+void TextureCacheBase::FinishPendingTextureDecodes()
+{
+  for (const RcTcacheEntry& entry : m_pending_decodes)
+    FinishTextureDecode(*entry);
+  m_pending_decodes.clear();
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -2869,6 +3157,16 @@ bool TextureCacheBase::CreateUtilityTextures()
       return false;
   }
 
+  constexpr TextureConfig placeholder_texture_config(1, 1, 1, 1, 1, AbstractTextureFormat::RGBA8,
+                                                     0, AbstractTextureType::Texture_2DArray);
+  m_decoding_placeholder_texture =
+      g_gfx->CreateTexture(placeholder_texture_config, "Texture decoding placeholder texture");
+  if (!m_decoding_placeholder_texture)
+    return false;
+  constexpr u32 placeholder_texel = 0;
+  m_decoding_placeholder_texture->Load(0, 1, 1, 1, reinterpret_cast<const u8*>(&placeholder_texel),
+                                       sizeof(placeholder_texel));
+
   return true;
 }
 
@@ -3170,7 +3468,7 @@ u64 TCacheEntry::CalculateHash() const
   u8* ptr = memory.GetPointer(addr);
   if (memory_stride == bytes_per_row)
   {
-    return Common::GetHash64(ptr, size_in_bytes, hash_sample_size);
+    return GetTextureMemoryHash(ptr, size_in_bytes, hash_sample_size);
   }
   else
   {
@@ -3189,7 +3487,7 @@ u64 TCacheEntry::CalculateHash() const
     {
       // Multiply by a prime number to mix the hash up a bit. This prevents identical blocks from
       // canceling each other out
-      temp_hash = (temp_hash * 397) ^ Common::GetHash64(ptr, bytes_per_row, samples_per_row);
+      temp_hash = (temp_hash * 397) ^ GetTextureMemoryHash(ptr, bytes_per_row, samples_per_row);
       ptr += memory_stride;
     }
     return temp_hash;
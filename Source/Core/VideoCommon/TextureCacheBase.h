@@ -20,6 +20,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
@@ -115,6 +116,8 @@ struct fmt::formatter<EFBCopyParams>
   }
 };
 
+struct TextureDecodeJob;
+
 struct TCacheEntry
 {
   // common members
@@ -164,6 +167,9 @@ struct TCacheEntry
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
 
+  // Asynchronous decoding, the texture contents are only valid once this has been finished.
+  std::shared_ptr<TextureDecodeJob> pending_decode;
+
   std::string texture_info_name = "";
 
   std::vector<VideoCommon::CachedAsset<VideoCommon::GameTextureAsset>> linked_game_texture_assets;
@@ -364,6 +370,17 @@ private:
 
   void CheckTempSize(size_t required_size);
 
+  // Decodes a texture and its mipmaps on the CPU, split into row slices which are distributed
+  // across the texture decoding threads.
+  bool ShouldDecodeOnThreads(const TextureInfo& texture_info, u32 levels) const;
+  void DecodeTextureOnThreads(RcTcacheEntry& entry, const TextureInfo& texture_info, u32 levels,
+                              bool skip_texture_dump);
+  void LoadDecodedTexture(TCacheEntry& entry, TextureDecodeJob& job);
+
+  // Waits for an asynchronous decode of the entry to finish and uploads the result.
+  void FinishTextureDecode(TCacheEntry& entry);
+  void FinishPendingTextureDecodes();
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
@@ -421,6 +438,7 @@ private:
   struct BackupConfig
   {
     int color_samples;
+    bool fast_texture_hashing;
     bool texfmt_overlay;
     bool texfmt_overlay_center;
     bool hires_textures;
@@ -443,6 +461,12 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
+  // Worker threads for CPU texture decoding, and the entries which are still being decoded
+  // asynchronously. Until they are finished, the placeholder texture is bound in their place.
+  Common::ThreadPool m_decoding_pool;
+  std::vector<RcTcacheEntry> m_pending_decodes;
+  std::unique_ptr<AbstractTexture> m_decoding_placeholder_texture;
+
   // Pool of readback textures used for deferred EFB copies.
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
 
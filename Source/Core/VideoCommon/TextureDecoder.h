@@ -182,6 +182,12 @@ TextureFormat TexDecoder_GetEFBCopyBaseFormat(EFBCopyFormat format);
 
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt);
+// Decodes rows [first_row, first_row + num_rows) of a texture into the same rows of dst, so that
+// disjoint row ranges can be decoded concurrently. Both values must be multiples of the format's
+// block height. Unlike TexDecoder_Decode, this does not draw the texture format overlay.
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt);
+void TexDecoder_DrawFormatOverlay(u8* dst, int width, int height, TextureFormat texformat);
 void TexDecoder_DecodeRGBA8FromTmem(u8* dst, const u8* src_ar, const u8* src_gb, int width,
                                     int height);
 void TexDecoder_DecodeTexel(u8* dst, const u8* src, int s, int t, int imageWidth,
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <cstddef>
 
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/Swap.h"
@@ -300,6 +301,22 @@ void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFor
 {
   _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
 
+  TexDecoder_DrawFormatOverlay(dst, width, height, texformat);
+}
+
+void TexDecoder_DecodeRows(u8* dst, const u8* src, int width, int first_row, int num_rows,
+                           TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  DEBUG_ASSERT(first_row % TexDecoder_GetBlockHeightInTexels(texformat) == 0);
+  DEBUG_ASSERT(num_rows % TexDecoder_GetBlockHeightInTexels(texformat) == 0);
+
+  _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst) + first_row * width,
+                         src + TexDecoder_GetTextureSizeInBytes(width, first_row, texformat), width,
+                         num_rows, texformat, tlut, tlutfmt);
+}
+
+void TexDecoder_DrawFormatOverlay(u8* dst, int width, int height, TextureFormat texformat)
+{
   if (TexFmt_Overlay_Enable)
     TexDecoder_DrawOverlay(dst, width, height, texformat);
 }
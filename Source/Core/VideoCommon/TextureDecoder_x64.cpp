@@ -1413,6 +1413,317 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
   }
 }
 
+// AVX2 decoders. These process two rows of a 4x4 block (or one row of an 8-wide block) per
+// instruction, and replace the per-pixel branches of the scalar paths with blends.
+
+// Loads 8 big-endian 16-bit texels and zero-extends them into 32-bit lanes.
+FUNCTION_TARGET_AVX2
+static inline __m256i LoadTexels16x8_AVX2(const u8* src)
+{
+  const __m128i swap_mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  const __m128i raw = _mm_loadu_si128((const __m128i*)src);
+  return _mm256_cvtepu16_epi32(_mm_shuffle_epi8(raw, swap_mask));
+}
+
+FUNCTION_TARGET_AVX2
+static inline void StoreRows_AVX2(u32* row0, u32* row1, __m256i pixels)
+{
+  _mm_storeu_si128((__m128i*)row0, _mm256_castsi256_si128(pixels));
+  _mm_storeu_si128((__m128i*)row1, _mm256_extracti128_si256(pixels, 1));
+}
+
+// The DecodeLanes functions take 16-bit values in the low half of each 32-bit lane, in host byte
+// order, and produce RGBA8 texels matching the DecodePixel functions above.
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeLanes_IA8_AVX2(__m256i val)
+{
+  // IA8 is stored as AAAAAAAA IIIIIIII, so after byteswapping A is the high byte.
+  const __m256i i = _mm256_and_si256(val, _mm256_set1_epi32(0xFF));
+  const __m256i a = _mm256_slli_epi32(_mm256_srli_epi32(val, 8), 24);
+  return _mm256_or_si256(_mm256_mullo_epi32(i, _mm256_set1_epi32(0x010101)), a);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeLanes_RGB565_AVX2(__m256i val)
+{
+  const __m256i mask5 = _mm256_set1_epi32(0x1F);
+  const __m256i r = _mm256_and_si256(_mm256_srli_epi32(val, 11), mask5);
+  const __m256i g = _mm256_and_si256(_mm256_srli_epi32(val, 5), _mm256_set1_epi32(0x3F));
+  const __m256i b = _mm256_and_si256(val, mask5);
+
+  const __m256i r8 = _mm256_or_si256(_mm256_slli_epi32(r, 3), _mm256_srli_epi32(r, 2));
+  const __m256i g8 = _mm256_or_si256(_mm256_slli_epi32(g, 2), _mm256_srli_epi32(g, 4));
+  const __m256i b8 = _mm256_or_si256(_mm256_slli_epi32(b, 3), _mm256_srli_epi32(b, 2));
+
+  return _mm256_or_si256(_mm256_or_si256(r8, _mm256_slli_epi32(g8, 8)),
+                         _mm256_or_si256(_mm256_slli_epi32(b8, 16), _mm256_set1_epi32(0xFF000000)));
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeLanes_RGB5A3_AVX2(__m256i val)
+{
+  // RGB555 with opaque alpha, used when the top bit is set.
+  const __m256i mask5 = _mm256_set1_epi32(0x1F);
+  const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(val, 10), mask5);
+  const __m256i g5 = _mm256_and_si256(_mm256_srli_epi32(val, 5), mask5);
+  const __m256i b5 = _mm256_and_si256(val, mask5);
+  const __m256i rgb555 = _mm256_or_si256(
+      _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2)),
+                      _mm256_slli_epi32(
+                          _mm256_or_si256(_mm256_slli_epi32(g5, 3), _mm256_srli_epi32(g5, 2)), 8)),
+      _mm256_or_si256(
+          _mm256_slli_epi32(_mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2)),
+                            16),
+          _mm256_set1_epi32(0xFF000000)));
+
+  // RGB4A3 otherwise. Expanding a nibble to 8 bits is a multiply by 0x11.
+  const __m256i mask4 = _mm256_set1_epi32(0xF);
+  const __m256i mul4 = _mm256_set1_epi32(0x11);
+  const __m256i r4 = _mm256_and_si256(_mm256_srli_epi32(val, 8), mask4);
+  const __m256i g4 = _mm256_and_si256(_mm256_srli_epi32(val, 4), mask4);
+  const __m256i b4 = _mm256_and_si256(val, mask4);
+  const __m256i a3 = _mm256_and_si256(_mm256_srli_epi32(val, 12), _mm256_set1_epi32(0x7));
+  const __m256i a8 = _mm256_or_si256(
+      _mm256_or_si256(_mm256_slli_epi32(a3, 5), _mm256_slli_epi32(a3, 2)), _mm256_srli_epi32(a3, 1));
+  const __m256i rgb4a3 = _mm256_or_si256(
+      _mm256_or_si256(_mm256_mullo_epi32(r4, mul4),
+                      _mm256_slli_epi32(_mm256_mullo_epi32(g4, mul4), 8)),
+      _mm256_or_si256(_mm256_slli_epi32(_mm256_mullo_epi32(b4, mul4), 16),
+                      _mm256_slli_epi32(a8, 24)));
+
+  const __m256i is_rgb555 = _mm256_srai_epi32(_mm256_slli_epi32(val, 16), 31);
+  return _mm256_blendv_epi8(rgb4a3, rgb555, is_rgb555);
+}
+
+FUNCTION_TARGET_AVX2
+static inline __m256i DecodeLanes_AVX2(__m256i val, TLUTFormat tlutfmt)
+{
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+    return DecodeLanes_IA8_AVX2(val);
+  case TLUTFormat::RGB565:
+    return DecodeLanes_RGB565_AVX2(val);
+  case TLUTFormat::RGB5A3:
+  default:
+    return DecodeLanes_RGB5A3_AVX2(val);
+  }
+}
+
+// Expands the first num_entries palette entries to RGBA8. num_entries must be a multiple of 8.
+FUNCTION_TARGET_AVX2
+static void DecodePalette_AVX2(u32* palette, const u8* tlut, TLUTFormat tlutfmt, int num_entries)
+{
+  for (int i = 0; i < num_entries; i += 8)
+  {
+    const __m256i val = LoadTexels16x8_AVX2(tlut + i * 2);
+    _mm256_storeu_si256((__m256i*)(palette + i), DecodeLanes_AVX2(val, tlutfmt));
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C4_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[16];
+  DecodePalette_AVX2(palette, tlut, tlutfmt, 16);
+  const __m256i palette_lo = _mm256_load_si256((const __m256i*)&palette[0]);
+  const __m256i palette_hi = _mm256_load_si256((const __m256i*)&palette[8]);
+
+  // Each byte holds two texels, the first one in the high nibble.
+  const __m256i nibble_shift = _mm256_setr_epi32(4, 0, 4, 0, 4, 0, 4, 0);
+  const __m256i nibble_mask = _mm256_set1_epi32(0xF);
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 8 * yStep; iy < 8; iy++, xStep++)
+      {
+        u32 row;
+        std::memcpy(&row, src + 4 * xStep, sizeof(row));
+        const __m128i bytes = _mm_cvtsi32_si128(static_cast<int>(row));
+        const __m256i index = _mm256_and_si256(
+            _mm256_srlv_epi32(_mm256_cvtepu8_epi32(_mm_unpacklo_epi8(bytes, bytes)), nibble_shift),
+            nibble_mask);
+
+        // vpermd only looks at the low 3 bits of the index, so pick between the two halves of the
+        // palette using bit 3.
+        const __m256i lo = _mm256_permutevar8x32_epi32(palette_lo, index);
+        const __m256i hi = _mm256_permutevar8x32_epi32(palette_hi, index);
+        const __m256i use_hi = _mm256_slli_epi32(index, 28);
+        const __m256i texels = _mm256_castps_si256(_mm256_blendv_ps(
+            _mm256_castsi256_ps(lo), _mm256_castsi256_ps(hi), _mm256_castsi256_ps(use_hi)));
+
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), texels);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C8_AVX2(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  alignas(32) u32 palette[256];
+  DecodePalette_AVX2(palette, tlut, tlutfmt, 256);
+
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+      {
+        const __m256i index =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(src + 8 * xStep)));
+        const __m256i texels = _mm256_i32gather_epi32((const int*)palette, index, 4);
+        _mm256_storeu_si256((__m256i*)(dst + (y + iy) * width + x), texels);
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_C14X2_AVX2(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // The palette has 16384 entries, which is too large to expand up front, so the entries are
+  // fetched individually and only the conversion is vectorized.
+  const u16* tlut16 = reinterpret_cast<const u16*>(tlut);
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      const u16* block = reinterpret_cast<const u16*>(src + 32 * yStep);
+      for (int iy = 0; iy < 4; iy += 2)
+      {
+        const u16* rows = block + 4 * iy;
+        alignas(32) u32 entries[8];
+        for (int i = 0; i < 8; i++)
+          entries[i] = Common::swap16(tlut16[Common::swap16(rows[i]) & 0x3FFF]);
+
+        const __m256i val = _mm256_load_si256((const __m256i*)entries);
+        StoreRows_AVX2(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x,
+                       DecodeLanes_AVX2(val, tlutfmt));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB565_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      const u8* block = src + 32 * yStep;
+      for (int iy = 0; iy < 4; iy += 2)
+      {
+        const __m256i val = LoadTexels16x8_AVX2(block + 8 * iy);
+        StoreRows_AVX2(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x,
+                       DecodeLanes_RGB565_AVX2(val));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_RGB5A3_AVX2(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+  {
+    for (int x = 0, yStep = (y / 4) * Wsteps4; x < width; x += 4, yStep++)
+    {
+      const u8* block = src + 32 * yStep;
+      for (int iy = 0; iy < 4; iy += 2)
+      {
+        const __m256i val = LoadTexels16x8_AVX2(block + 8 * iy);
+        StoreRows_AVX2(dst + (y + iy) * width + x, dst + (y + iy + 1) * width + x,
+                       DecodeLanes_RGB5A3_AVX2(val));
+      }
+    }
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static inline void DecodeDXTPalette_AVX2(u32* colors, const DXTBlock* block)
+{
+  const u16 c1 = Common::swap16(block->color1);
+  const u16 c2 = Common::swap16(block->color2);
+  const int blue1 = Convert5To8(c1 & 0x1F);
+  const int blue2 = Convert5To8(c2 & 0x1F);
+  const int green1 = Convert6To8((c1 >> 5) & 0x3F);
+  const int green2 = Convert6To8((c2 >> 5) & 0x3F);
+  const int red1 = Convert5To8((c1 >> 11) & 0x1F);
+  const int red2 = Convert5To8((c2 >> 11) & 0x1F);
+  colors[0] = MakeRGBA(red1, green1, blue1, 255);
+  colors[1] = MakeRGBA(red2, green2, blue2, 255);
+  if (c1 > c2)
+  {
+    colors[2] =
+        MakeRGBA(DXTBlend(red2, red1), DXTBlend(green2, green1), DXTBlend(blue2, blue1), 255);
+    colors[3] =
+        MakeRGBA(DXTBlend(red1, red2), DXTBlend(green1, green2), DXTBlend(blue1, blue2), 255);
+  }
+  else
+  {
+    // color[3] is the same as color[2] (average of both colors), but transparent.
+    colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
+    colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
+  }
+}
+
+FUNCTION_TARGET_AVX2
+static void TexDecoder_DecodeImpl_CMPR_AVX2(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two horizontally adjacent DXT blocks make up one 8-texel row. Their palettes are packed into
+  // a single register so each row is one vpermd.
+  const __m256i block_offset = _mm256_setr_epi32(0, 0, 0, 0, 4, 4, 4, 4);
+  const __m256i selector_shift = _mm256_setr_epi32(6, 4, 2, 0, 6, 4, 2, 0);
+  const __m256i selector_mask = _mm256_set1_epi32(3);
+
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0, yStep = (y / 8) * Wsteps8; x < width; x += 8, yStep++)
+    {
+      for (int z = 0, xStep = 2 * yStep; z < 2; ++z, xStep++)
+      {
+        const DXTBlock* blocks =
+            reinterpret_cast<const DXTBlock*>(src + sizeof(DXTBlock) * 2 * xStep);
+
+        alignas(32) u32 colors[8];
+        DecodeDXTPalette_AVX2(&colors[0], &blocks[0]);
+        DecodeDXTPalette_AVX2(&colors[4], &blocks[1]);
+        const __m256i palette = _mm256_load_si256((const __m256i*)colors);
+
+        u32* dst32 = dst + (y + z * 4) * width + x;
+        for (int row = 0; row < 4; row++)
+        {
+          const __m256i selectors = _mm256_setr_epi32(
+              blocks[0].lines[row], blocks[0].lines[row], blocks[0].lines[row],
+              blocks[0].lines[row], blocks[1].lines[row], blocks[1].lines[row],
+              blocks[1].lines[row], blocks[1].lines[row]);
+          const __m256i index = _mm256_add_epi32(
+              _mm256_and_si256(_mm256_srlv_epi32(selectors, selector_shift), selector_mask),
+              block_offset);
+          _mm256_storeu_si256((__m256i*)(dst32 + width * row),
+                              _mm256_permutevar8x32_epi32(palette, index));
+        }
+      }
+    }
+  }
+}
+
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
@@ -1422,7 +1733,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   switch (texformat)
   {
   case TextureFormat::C4:
-    TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C4_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I4:
@@ -1442,7 +1757,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C8:
-    TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C8_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                    Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::IA4:
@@ -1459,17 +1778,28 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::C14X2:
-    TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_C14X2_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                       Wsteps8);
+    else
+      TexDecoder_DecodeImpl_C14X2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                  Wsteps8);
     break;
 
   case TextureFormat::RGB565:
-    TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                 Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB565_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else
+      TexDecoder_DecodeImpl_RGB565(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                   Wsteps8);
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_RGB5A3_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                        Wsteps8);
+    else if (cpu_info.bSSSE3)
       TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
                                          Wsteps8);
     else
@@ -1487,7 +1817,12 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::CMPR:
-    TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    if (cpu_info.bAVX2)
+      TexDecoder_DecodeImpl_CMPR_AVX2(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                      Wsteps8);
+    else
+      TexDecoder_DecodeImpl_CMPR(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
+                                 Wsteps8);
     break;
 
   case TextureFormat::XFB:
@@ -14,7 +14,12 @@
 
 class VertexLoaderUID
 {
-  std::array<u32, 5> vid{};
+public:
+  // The raw register values, as stored in the per-game loader UID cache
+  using SerializedData = std::array<u32, 5>;
+
+private:
+  SerializedData vid{};
   size_t hash = 0;
 
 public:
@@ -28,9 +33,28 @@ public:
     vid[4] = vat.g2.Hex;
     hash = CalculateHash();
   }
+  explicit VertexLoaderUID(const SerializedData& data) : vid(data) { hash = CalculateHash(); }
 
   bool operator==(const VertexLoaderUID& rh) const { return vid == rh.vid; }
   size_t GetHash() const { return hash; }
+  const SerializedData& GetSerializedData() const { return vid; }
+
+  TVtxDesc GetVertexDesc() const
+  {
+    TVtxDesc vtx_desc;
+    vtx_desc.low.Hex = vid[0];
+    vtx_desc.high.Hex = vid[1];
+    return vtx_desc;
+  }
+
+  VAT GetVertexAttributes() const
+  {
+    VAT vat;
+    vat.g0.Hex = vid[2];
+    vat.g1.Hex = vid[3];
+    vat.g2.Hex = vid[4];
+    return vat;
+  }
 
 private:
   size_t CalculateHash() const
@@ -15,8 +15,11 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 
+#include "Core/ConfigManager.h"
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
@@ -25,6 +28,7 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/GPUStageTimings.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
@@ -50,7 +54,19 @@ u32 g_current_components;
 typedef std::unordered_map<VertexLoaderUID, std::unique_ptr<VertexLoaderBase>> VertexLoaderMap;
 static std::mutex s_vertex_loader_map_lock;
 static VertexLoaderMap s_vertex_loader_map;
-// TODO - change into array of pointers. Keep a map of all seen so far.
+
+// Loaders are never removed from s_vertex_loader_map while the emulation is running, so each
+// thread keeps its own lookup table of loaders it has already seen, and only has to take the
+// lock for vertex formats it encounters for the first time. The main table is only used by the
+// GPU thread, and the preprocess table only by the CPU thread when preprocessing the FIFO.
+typedef std::unordered_map<VertexLoaderUID, VertexLoaderBase*> VertexLoaderLookup;
+static VertexLoaderLookup s_main_vertex_loader_lookup;
+static VertexLoaderLookup s_preprocess_vertex_loader_lookup;
+
+// New loaders are appended to this file, which is only opened while writing to it.
+static std::string s_loader_uid_cache_filename;
+constexpr u32 LOADER_UID_CACHE_MAGIC = 0x44495556;  // VUID
+constexpr u32 LOADER_UID_CACHE_VERSION = 1;
 
 Common::EnumMap<u8*, CPArray::TexCoord7> cached_arraybases;
 
@@ -74,10 +90,85 @@ void Init()
 void Clear()
 {
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  s_loader_uid_cache_filename.clear();
+  s_main_vertex_loader_lookup.clear();
+  s_preprocess_vertex_loader_lookup.clear();
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
 }
 
+// Must be called with s_vertex_loader_map_lock held.
+static VertexLoaderBase* CreateLoader(const VertexLoaderUID& uid)
+{
+  auto [it, added] = s_vertex_loader_map.try_emplace(
+      uid, VertexLoaderBase::CreateVertexLoader(uid.GetVertexDesc(), uid.GetVertexAttributes()));
+  INCSTAT(g_stats.num_vertex_loaders);
+
+  if (!s_loader_uid_cache_filename.empty())
+  {
+    const VertexLoaderUID::SerializedData& data = uid.GetSerializedData();
+    File::IOFile file(s_loader_uid_cache_filename, "ab");
+    if (!file.WriteBytes(data.data(), sizeof(data)) || !file.Close())
+    {
+      WARN_LOG_FMT(VIDEO, "Writing vertex loader UID to cache failed, not writing any more.");
+      s_loader_uid_cache_filename.clear();
+    }
+  }
+
+  return it->second.get();
+}
+
+void LoadLoaderUIDCache()
+{
+  if (!g_ActiveConfig.bShaderCache)
+    return;
+
+  constexpr size_t HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  constexpr size_t ENTRY_SIZE = sizeof(VertexLoaderUID::SerializedData);
+  const std::string filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".vtxuidcache";
+
+  std::vector<VertexLoaderUID::SerializedData> uids;
+  File::IOFile file(filename, "rb");
+  u32 magic, version;
+  if (file.ReadBytes(&magic, sizeof(magic)) && file.ReadBytes(&version, sizeof(version)) &&
+      magic == LOADER_UID_CACHE_MAGIC && version == LOADER_UID_CACHE_VERSION)
+  {
+    // A partially written entry at the end (e.g. from a crash) is dropped.
+    uids.resize((file.GetSize() - HEADER_SIZE) / ENTRY_SIZE);
+    if (!file.ReadArray(uids.data(), uids.size()))
+      uids.clear();
+  }
+  file.Close();
+
+  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+  // The loaders from the file don't have to be appended to it again.
+  s_loader_uid_cache_filename.clear();
+  for (const VertexLoaderUID::SerializedData& data : uids)
+  {
+    const VertexLoaderUID uid(data);
+    if (s_vertex_loader_map.contains(uid))
+      continue;
+
+    VertexLoaderBase* loader = CreateLoader(uid);
+    loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
+  }
+
+  // Rewrite the file to drop duplicate and truncated entries, new loaders are appended to it.
+  File::IOFile out_file(filename, "wb");
+  out_file.WriteBytes(&LOADER_UID_CACHE_MAGIC, sizeof(LOADER_UID_CACHE_MAGIC));
+  out_file.WriteBytes(&LOADER_UID_CACHE_VERSION, sizeof(LOADER_UID_CACHE_VERSION));
+  for (const auto& it : s_vertex_loader_map)
+  {
+    const VertexLoaderUID::SerializedData& data = it.first.GetSerializedData();
+    out_file.WriteBytes(data.data(), sizeof(data));
+  }
+  if (out_file.Close())
+    s_loader_uid_cache_filename = filename;
+
+  INFO_LOG_FMT(VIDEO, "Created {} vertex loaders from {}", s_vertex_loader_map.size(), filename);
+}
+
 void UpdateVertexArrayPointers()
 {
   // Anything to update?
@@ -216,30 +307,30 @@ VertexLoaderBase* GetOrCreateLoader(int vtx_attr_group)
   constexpr BitSet8& attr_dirty = IsPreprocess ? g_preprocess_vat_dirty : g_main_vat_dirty;
   constexpr auto& vertex_loaders =
       IsPreprocess ? g_preprocess_vertex_loaders : g_main_vertex_loaders;
+  constexpr VertexLoaderLookup* lookup =
+      IsPreprocess ? &s_preprocess_vertex_loader_lookup : &s_main_vertex_loader_lookup;
 
   VertexLoaderBase* loader;
 
-  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
-  // thread
-  bool check_for_native_format = !IsPreprocess;
-
   VertexLoaderUID uid(state->vtx_desc, state->vtx_attr[vtx_attr_group]);
-  std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
-  VertexLoaderMap::iterator iter = s_vertex_loader_map.find(uid);
-  if (iter != s_vertex_loader_map.end())
+  if (auto iter = lookup->find(uid); iter != lookup->end()) [[likely]]
   {
-    loader = iter->second.get();
-    check_for_native_format &= !loader->m_native_vertex_format;
+    loader = iter->second;
   }
   else
   {
-    auto [it, added] = s_vertex_loader_map.try_emplace(
-        uid,
-        VertexLoaderBase::CreateVertexLoader(state->vtx_desc, state->vtx_attr[vtx_attr_group]));
-    loader = it->second.get();
-    INCSTAT(g_stats.num_vertex_loaders);
+    std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
+    VertexLoaderMap::iterator map_iter = s_vertex_loader_map.find(uid);
+    if (map_iter != s_vertex_loader_map.end())
+      loader = map_iter->second.get();
+    else
+      loader = CreateLoader(uid);
+    lookup->emplace(uid, loader);
   }
-  if (check_for_native_format)
+
+  // We are not allowed to create a native vertex format on preprocessing as this is on the wrong
+  // thread. Only the GPU thread writes m_native_vertex_format, so it can be checked without a lock.
+  if (!IsPreprocess && !loader->m_native_vertex_format)
   {
     // search for a cached native vertex format
     loader->m_native_vertex_format = GetOrCreateMatchingFormat(loader->m_native_vtx_decl);
@@ -369,11 +460,13 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
                                             loader->m_native_vertex_format->GetVertexDeclaration());
     }
 
-    // CPUCull's performance increase comes from encoding fewer GPU commands, not sending less data
-    // Therefore it's only useful to check if culling could remove a flush
-    const bool can_cpu_cull = g_ActiveConfig.bCPUCull &&
-                              primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES &&
-                              !g_vertex_manager->HasSendableVertices();
+    // CPUCull's performance increase mostly comes from encoding fewer GPU commands, which is only
+    // possible if nothing was added since the last flush, so that the whole batch can be skipped
+    // while all of its triangles are culled. For the other draws, the culled triangles are still
+    // left out of the index buffer.
+    const bool can_cpu_cull =
+        g_ActiveConfig.bCPUCull && primitive < OpcodeDecoder::Primitive::GX_DRAW_LINES;
+    const bool can_cpu_cull_all = can_cpu_cull && !g_vertex_manager->HasSendableVertices();
 
     // if cull mode is CULL_ALL, tell VertexManager to skip triangles and quads.
     // They still need to go through vertex loading, because we need to calculate a zfreeze
@@ -383,20 +476,30 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
 
     const int stride = loader->m_native_vtx_decl.stride;
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
-                                                                cullall || can_cpu_cull);
+                                                                cullall || can_cpu_cull_all);
 
-    count = loader->RunVertices(src, dst.GetPointer(), count);
+    {
+      VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::VertexLoading);
+      count = loader->RunVertices(src, dst.GetPointer(), count);
+    }
 
     if (can_cpu_cull && !cullall)
     {
-      if (!g_vertex_manager->AreAllVerticesCulled(loader, primitive, dst.GetPointer(), count))
+      const u32 num_visible_triangles =
+          g_vertex_manager->CullTriangles(loader, primitive, dst.GetPointer(), count);
+      if (num_visible_triangles != 0 && can_cpu_cull_all)
       {
         DataReader new_dst = g_vertex_manager->DisableCullAll(stride);
         memmove(new_dst.GetPointer(), dst.GetPointer(), count * stride);
       }
-    }
 
-    g_vertex_manager->AddIndices(primitive, count);
+      // The triangles that were culled on the CPU don't need to be drawn either
+      g_vertex_manager->AddVisibleIndices(primitive, count, num_visible_triangles);
+    }
+    else
+    {
+      g_vertex_manager->AddIndices(primitive, count);
+    }
     g_vertex_manager->FlushData(count, loader->m_native_vtx_decl.stride);
 
     ADDSTAT(g_stats.this_frame.num_prims, count);
@@ -28,6 +28,11 @@ using NativeVertexFormatMap =
 void Init();
 void Clear();
 
+// Creates the vertex loaders recorded for the current game, so that the first draw using each
+// vertex format doesn't have to wait for its loader to be generated. Loaders created afterwards
+// are appended to the same file.
+void LoadLoaderUIDCache();
+
 void MarkAllDirty();
 
 // Creates or obtains a pointer to a VertexFormat representing decl.
@@ -278,6 +278,86 @@ void VertexLoaderX64::ReadVertex(OpArg data, VertexComponentFormat attribute,
   write_zfreeze();
 }
 
+void VertexLoaderX64::ReadNormalTangentBinormalAVX2(OpArg data, VertexComponentFormat attribute,
+                                                    ComponentFormat format, u8 scaling_exponent)
+{
+  static const __m128i bswap16_shuffle =
+      _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+  static const auto scale_factors = [] {
+    std::array<std::array<float, 8>, 16> factors;
+    for (size_t i = 0; i < factors.size(); i++)
+      factors[i].fill(1.0f / (1u << i));
+    return factors;
+  }();
+
+  const int elem_size = GetElementSize(format);
+  const bool is_signed = format == ComponentFormat::Byte || format == ComponentFormat::Short;
+  const OpArg scale = MPIC(scale_factors[scaling_exponent].data());
+
+  for (AttributeFormat& native_format : m_native_vtx_decl.normals)
+  {
+    native_format.components = 3;
+    native_format.enable = true;
+    native_format.offset = m_dst_ofs;
+    native_format.type = ComponentFormat::Float;
+    native_format.integer = false;
+    m_dst_ofs += sizeof(float) * 3;
+  }
+  const u32 dst_ofs = m_dst_ofs - sizeof(float) * 9;
+
+  if (attribute == VertexComponentFormat::Direct)
+    m_src_ofs += elem_size * 9;
+
+  // The normal, tangent and binormal are stored back to back, both in the source data and in the
+  // native vertex. Convert the first 8 of their 9 components with a single YMM register.
+  X64Reg coords = XMM0;
+  if (elem_size == 2)
+  {
+    MOVDQU(coords, data);
+    PSHUFB(coords, MPIC(&bswap16_shuffle));
+    if (is_signed)
+      VPMOVSXWD_ymm(coords, R(coords));
+    else
+      VPMOVZXWD_ymm(coords, R(coords));
+  }
+  else
+  {
+    MOVQ_xmm(coords, data);
+    if (is_signed)
+      VPMOVSXBD_ymm(coords, R(coords));
+    else
+      VPMOVZXBD_ymm(coords, R(coords));
+  }
+  VCVTDQ2PS_ymm(coords, R(coords));
+  VMULPS_ymm(coords, coords, scale);
+  VMOVUPS_ymm(MDisp(dst_reg, dst_ofs), coords);
+  VZEROUPPER();
+
+  // The last component of the binormal. CVTSI2SS leaves the upper lanes alone, so clear them for
+  // the binormal cache below.
+  X64Reg last = XMM1;
+  data.AddMemOffset(elem_size * 8);
+  LoadAndSwap(elem_size * 8, scratch3, data, is_signed);
+  XORPS(last, R(last));
+  CVTSI2SS(last, R(scratch3));
+  MULSS(last, scale);
+  MOVSS(MDisp(dst_reg, dst_ofs + sizeof(float) * 8), last);
+
+  // zfreeze. Like in ReadVertex, the 4th float of each cached vector is 0.
+  TEST(32, R(remaining_reg), R(remaining_reg));
+  FixupBranch dont_store = J_CC(CC_NZ);
+  X64Reg temp = XMM2;
+  XORPS(temp, R(temp));
+  MOVQ_xmm(temp, MDisp(dst_reg, dst_ofs + sizeof(float) * 3));
+  PINSRD(temp, MDisp(dst_reg, dst_ofs + sizeof(float) * 5), 2);
+  MOVUPS(MPIC(VertexLoaderManager::tangent_cache.data()), temp);
+  XORPS(temp, R(temp));
+  MOVQ_xmm(temp, MDisp(dst_reg, dst_ofs + sizeof(float) * 6));
+  MOVLHPS(temp, last);
+  MOVUPS(MPIC(VertexLoaderManager::binormal_cache.data()), temp);
+  SetJumpTarget(dont_store);
+}
+
 void VertexLoaderX64::ReadColor(OpArg data, VertexComponentFormat attribute, ColorFormat format)
 {
   int load_bytes = 0;
@@ -462,14 +542,30 @@ void VertexLoaderX64::GenerateVertexLoader()
                                                                                        0, 0, 0,  0};
     const u8 scaling_exponent = SCALE_MAP[m_VtxAttr.g0.NormalFormat];
 
+    const bool has_ntb = m_VtxAttr.g0.NormalElements == NormalComponentCount::NTB;
+    const bool index3 = IsIndexed(m_VtxDesc.low.Normal) && m_VtxAttr.g0.NormalIndex3;
+    const ComponentFormat normal_format = m_VtxAttr.g0.NormalFormat;
+    const bool is_integer_format =
+        normal_format == ComponentFormat::UByte || normal_format == ComponentFormat::Byte ||
+        normal_format == ComponentFormat::UShort || normal_format == ComponentFormat::Short;
+
+    // Without Index3, all 9 components are read from the same address.
+    const bool read_ntb_at_once = has_ntb && !index3 && is_integer_format && cpu_info.bAVX2;
+
     // Normal
     data = GetVertexAddr(CPArray::Normal, m_VtxDesc.low.Normal);
-    ReadVertex(data, m_VtxDesc.low.Normal, m_VtxAttr.g0.NormalFormat, 3, 3, true, scaling_exponent,
-               &m_native_vtx_decl.normals[0]);
+    if (read_ntb_at_once)
+    {
+      ReadNormalTangentBinormalAVX2(data, m_VtxDesc.low.Normal, normal_format, scaling_exponent);
+    }
+    else
+    {
+      ReadVertex(data, m_VtxDesc.low.Normal, normal_format, 3, 3, true, scaling_exponent,
+                 &m_native_vtx_decl.normals[0]);
+    }
 
-    if (m_VtxAttr.g0.NormalElements == NormalComponentCount::NTB)
+    if (has_ntb && !read_ntb_at_once)
     {
-      const bool index3 = IsIndexed(m_VtxDesc.low.Normal) && m_VtxAttr.g0.NormalIndex3;
       const int elem_size = GetElementSize(m_VtxAttr.g0.NormalFormat);
       const int load_bytes = elem_size * 3;
 
@@ -28,6 +28,8 @@ private:
   void ReadVertex(Gen::OpArg data, VertexComponentFormat attribute, ComponentFormat format,
                   int count_in, int count_out, bool dequantize, u8 scaling_exponent,
                   AttributeFormat* native_format);
+  void ReadNormalTangentBinormalAVX2(Gen::OpArg data, VertexComponentFormat attribute,
+                                     ComponentFormat format, u8 scaling_exponent);
   void ReadColor(Gen::OpArg data, VertexComponentFormat attribute, ColorFormat format);
   void GenerateVertexLoader();
 };
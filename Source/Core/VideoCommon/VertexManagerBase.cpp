@@ -23,6 +23,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/GPUStageTimings.h"
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/CustomShaderCache.h"
 #include "VideoCommon/GraphicsModSystem/Runtime/GraphicsModActionData.h"
@@ -136,11 +137,17 @@ void VertexManagerBase::AddIndices(OpcodeDecoder::Primitive primitive, u32 num_v
   m_index_generator.AddIndices(primitive, num_vertices);
 }
 
-bool VertexManagerBase::AreAllVerticesCulled(VertexLoaderBase* loader,
-                                             OpcodeDecoder::Primitive primitive, const u8* src,
-                                             u32 count)
+void VertexManagerBase::AddVisibleIndices(OpcodeDecoder::Primitive primitive, u32 num_vertices,
+                                          u32 num_visible_triangles)
 {
-  return m_cpu_cull.AreAllVerticesCulled(loader, primitive, src, count);
+  m_index_generator.AddVisibleIndices(primitive, num_vertices, m_cpu_cull.GetVisibleTriangles(),
+                                      num_visible_triangles);
+}
+
+u32 VertexManagerBase::CullTriangles(VertexLoaderBase* loader, OpcodeDecoder::Primitive primitive,
+                                     const u8* src, u32 count)
+{
+  return m_cpu_cull.CullTriangles(loader, primitive, src, count);
 }
 
 DataReader VertexManagerBase::PrepareForAdditionalData(OpcodeDecoder::Primitive primitive,
@@ -557,6 +564,7 @@ void VertexManagerBase::Flush()
   std::vector<u32> texture_units;
   if (!m_cull_all)
   {
+    VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::TextureLoading);
     if (!g_ActiveConfig.bGraphicMods)
     {
       for (const u32 i : used_textures)
@@ -658,8 +666,14 @@ void VertexManagerBase::Flush()
     UploadUniforms();
 
     // Update the pipeline, or compile one if needed.
-    UpdatePipelineConfig();
-    UpdatePipelineObject();
+    {
+      VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::ShaderUids);
+      UpdatePipelineConfig();
+    }
+    {
+      VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::PipelineLookup);
+      UpdatePipelineObject();
+    }
     if (m_current_pipeline_object)
     {
       const AbstractPipeline* current_pipeline = m_current_pipeline_object;
@@ -724,7 +738,10 @@ void VertexManagerBase::Flush()
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
-      DrawCurrentBatch(base_index, num_indices, base_vertex);
+      {
+        VideoCommon::ScopedGPUStageTimer timer(VideoCommon::GPUStage::Draw);
+        DrawCurrentBatch(base_index, num_indices, base_vertex);
+      }
       INCSTAT(g_stats.this_frame.num_draw_calls);
 
       if (PerfQueryBase::ShouldEmulate())
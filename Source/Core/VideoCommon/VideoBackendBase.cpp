@@ -392,6 +392,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   g_Config.VerifyValidity();
   UpdateActiveConfig();
 
+  VertexLoaderManager::LoadLoaderUIDCache();
   g_shader_cache->InitializeShaderCache();
 
   return true;
@@ -120,6 +120,7 @@ void VideoConfig::Refresh()
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bDumpFramesAsImages = Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES);
+  bDumpFramesAsArchive = Config::Get(Config::GFX_DUMP_FRAMES_AS_ARCHIVE);
   bUseFFV1 = Config::Get(Config::GFX_USE_FFV1);
   sDumpFormat = Config::Get(Config::GFX_DUMP_FORMAT);
   sDumpCodec = Config::Get(Config::GFX_DUMP_CODEC);
@@ -149,6 +150,7 @@ void VideoConfig::Refresh()
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  iTextureDecodingThreads = Config::Get(Config::GFX_TEXTURE_DECODING_THREADS);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -194,6 +196,8 @@ void VideoConfig::Refresh()
   iEFBAccessTileSize = Config::Get(Config::GFX_HACK_EFB_ACCESS_TILE_SIZE);
   iMissingColorValue = Config::Get(Config::GFX_HACK_MISSING_COLOR_VALUE);
   bFastTextureSampling = Config::Get(Config::GFX_HACK_FAST_TEXTURE_SAMPLING);
+  bFastTextureHashing = Config::Get(Config::GFX_HACK_FAST_TEXTURE_HASHING);
+  bAsyncTextureDecoding = Config::Get(Config::GFX_HACK_ASYNC_TEXTURE_DECODING);
 #ifdef __APPLE__
   bNoMipmapping = Config::Get(Config::GFX_HACK_NO_MIPMAPPING);
 #endif
@@ -275,6 +279,16 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetTextureDecodingThreads() const
+{
+  if (iTextureDecodingThreads >= 0)
+    return static_cast<u32>(iTextureDecodingThreads);
+
+  // Automatic number. The GPU thread helps with decoding while it waits, and the CPU thread
+  // should keep a core of its own.
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 0, 4));
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
@@ -181,6 +181,7 @@ struct VideoConfig final
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
+  bool bDumpFramesAsArchive = false;
   bool bUseFFV1 = false;
   std::string sDumpCodec;
   std::string sDumpPixelFormat;
@@ -222,6 +223,8 @@ struct VideoConfig final
   int iSaveTargetId = 0;  // TODO: Should be dropped
   u32 iMissingColorValue = 0;
   bool bFastTextureSampling = false;
+  bool bFastTextureHashing = false;
+  bool bAsyncTextureDecoding = false;
 #ifdef __APPLE__
   bool bNoMipmapping = false;  // Used by macOS fifoci to work around an M1 bug
 #endif
@@ -262,6 +265,10 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // Number of worker threads used to decode large textures on the CPU.
+  // 0 decodes on the GPU thread, -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -368,6 +375,7 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetTextureDecodingThreads() const;
 
   float GetCustomAspectRatio() const { return (float)custom_aspect_width / custom_aspect_height; }
 };
@@ -0,0 +1,270 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "AudioCommon/FlacWriter.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+
+namespace
+{
+class BitReader
+{
+public:
+  BitReader(const std::vector<u8>& data, size_t offset) : m_data(data), m_bit(offset * 8) {}
+
+  u32 Read(u32 bits)
+  {
+    u32 value = 0;
+    for (u32 i = 0; i < bits; ++i, ++m_bit)
+      value = (value << 1) | ((m_data.at(m_bit / 8) >> (7 - m_bit % 8)) & 1);
+    return value;
+  }
+
+  s32 ReadSigned(u32 bits)
+  {
+    const u32 value = Read(bits);
+    return s32(value << (32 - bits)) >> (32 - bits);
+  }
+
+  u32 ReadUnary()
+  {
+    u32 count = 0;
+    while (Read(1) == 0)
+      ++count;
+    return count;
+  }
+
+  void AlignToByte() { m_bit = (m_bit + 7) / 8 * 8; }
+  size_t GetByteOffset() const { return m_bit / 8; }
+
+private:
+  const std::vector<u8>& m_data;
+  size_t m_bit;
+};
+
+u32 Crc(const u8* data, size_t size, u32 polynomial, u32 width)
+{
+  u32 crc = 0;
+  const u32 top = 1u << (width - 1);
+  for (size_t i = 0; i < size; ++i)
+  {
+    crc ^= u32(data[i]) << (width - 8);
+    for (int bit = 0; bit < 8; ++bit)
+      crc = (crc & top ? (crc << 1) ^ polynomial : crc << 1) & ((1u << width) - 1);
+  }
+  return crc;
+}
+
+// Decodes the subset of FLAC which FlacWriter produces: fixed predictors, verbatim and constant
+// subframes with every channel assignment.
+std::optional<std::vector<s16>> DecodeFlac(const std::vector<u8>& data, u64* total_samples)
+{
+  if (data.size() < 42 || std::string(data.begin(), data.begin() + 4) != "fLaC")
+    return std::nullopt;
+
+  BitReader info(data, 4);
+  if (info.Read(1) != 1 || info.Read(7) != 0 || info.Read(24) != 34)
+    return std::nullopt;
+  info.Read(16 + 16 + 24 + 24 + 20);
+  if (info.Read(3) != 1 || info.Read(5) != 15)
+    return std::nullopt;
+  *total_samples = u64(info.Read(4)) << 32 | info.Read(32);
+
+  std::vector<s16> samples;
+  size_t offset = 4 + 4 + 34;
+  while (offset < data.size())
+  {
+    BitReader reader(data, offset);
+    if (reader.Read(14) != 0b11111111111110 || reader.Read(2) != 0)
+      return std::nullopt;
+    const u32 block_size_code = reader.Read(4);
+    reader.Read(4);
+    const u32 assignment = reader.Read(4);
+    if (reader.Read(3) != 0b100 || reader.Read(1) != 0)
+      return std::nullopt;
+    // UTF-8 coded frame number
+    const u32 first = reader.Read(8);
+    for (u32 mask = 0x40; first & 0x80 && first & mask; mask >>= 1)
+      reader.Read(8);
+    const u32 block_size = block_size_code == 0b1100 ? 4096 : reader.Read(16) + 1;
+    const size_t header_size = reader.GetByteOffset() - offset;
+    if (reader.Read(8) != Crc(&data[offset], header_size, 0x07, 8))
+      return std::nullopt;
+
+    std::array<std::vector<s32>, 2> channels;
+    for (u32 channel = 0; channel < 2; ++channel)
+    {
+      const bool is_side = (assignment == 8 && channel == 1) || (assignment == 9 && channel == 0) ||
+                           (assignment == 10 && channel == 1);
+      const u32 bps = is_side ? 17 : 16;
+      std::vector<s32>& x = channels[channel];
+      x.resize(block_size);
+
+      reader.Read(1);
+      const u32 type = reader.Read(6);
+      reader.Read(1);
+      if (type == 0)
+      {
+        std::fill(x.begin(), x.end(), reader.ReadSigned(bps));
+      }
+      else if (type == 1)
+      {
+        for (s32& sample : x)
+          sample = reader.ReadSigned(bps);
+      }
+      else if ((type & 0b111000) == 0b001000 && (type & 7) <= 4)
+      {
+        const u32 order = type & 7;
+        for (u32 i = 0; i < order; ++i)
+          x[i] = reader.ReadSigned(bps);
+        if (reader.Read(2) != 0)
+          return std::nullopt;
+        const u32 partition_order = reader.Read(4);
+        const u32 partition_size = block_size >> partition_order;
+        for (u32 partition = 0; partition < (1u << partition_order); ++partition)
+        {
+          const u32 k = reader.Read(4);
+          const u32 start = partition == 0 ? order : partition * partition_size;
+          for (u32 i = start; i < (partition + 1) * partition_size; ++i)
+          {
+            const u32 folded = (reader.ReadUnary() << k) | reader.Read(k);
+            const s32 residual = s32(folded >> 1) ^ -s32(folded & 1);
+            static constexpr std::array<std::array<s32, 4>, 5> coefficients = {{
+                {0, 0, 0, 0},
+                {1, 0, 0, 0},
+                {2, -1, 0, 0},
+                {3, -3, 1, 0},
+                {4, -6, 4, -1},
+            }};
+            s32 prediction = 0;
+            for (u32 j = 0; j < order; ++j)
+              prediction += coefficients[order][j] * x[i - 1 - j];
+            x[i] = prediction + residual;
+          }
+        }
+      }
+      else
+      {
+        return std::nullopt;
+      }
+    }
+
+    reader.AlignToByte();
+    const size_t frame_size = reader.GetByteOffset() - offset;
+    if (reader.Read(16) != Crc(&data[offset], frame_size, 0x8005, 16))
+      return std::nullopt;
+    offset = reader.GetByteOffset();
+
+    for (u32 i = 0; i < block_size; ++i)
+    {
+      s32 left = channels[0][i];
+      s32 right = channels[1][i];
+      if (assignment == 8)
+      {
+        right = left - right;
+      }
+      else if (assignment == 9)
+      {
+        left = right + left;
+      }
+      else if (assignment == 10)
+      {
+        const s32 mid = (left << 1) | (right & 1);
+        left = (mid + right) >> 1;
+        right = (mid - right) >> 1;
+      }
+      samples.push_back(s16(left));
+      samples.push_back(s16(right));
+    }
+  }
+  return samples;
+}
+
+std::vector<s16> MakeSamples(u32 frames, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> noise(-300, 300);
+  std::uniform_int_distribution<int> full(-32768, 32767);
+  std::vector<s16> samples(frames * 2);
+  for (u32 i = 0; i < frames; ++i)
+  {
+    // Sections of tones, silence, identical channels, white noise and extreme values
+    const u32 section = (i / 5000) % 5;
+    const double tone = std::sin(2.0 * std::numbers::pi * 440.0 * i / 48000.0);
+    s16 left = 0;
+    s16 right = 0;
+    if (section == 0)
+    {
+      left = s16(12000.0 * tone + noise(rng));
+      right = s16(-9000.0 * tone + noise(rng));
+    }
+    else if (section == 2)
+    {
+      left = right = s16(20000.0 * tone);
+    }
+    else if (section == 3)
+    {
+      left = s16(full(rng));
+      right = s16(full(rng));
+    }
+    else if (section == 4)
+    {
+      left = i % 2 ? 32767 : -32768;
+      right = i % 3 ? -32768 : 32767;
+    }
+    samples[i * 2] = left;
+    samples[i * 2 + 1] = right;
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(FlacWriter, RoundTrip)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+
+  for (u32 frames : {0u, 1u, 4095u, 4096u, 23456u, 130u * 4096u + 17u})
+  {
+    const std::string path = fmt::format("{}/{}.flac", directory, frames);
+    const std::vector<s16> samples = MakeSamples(frames, frames);
+
+    FlacWriter writer;
+    ASSERT_TRUE(writer.Start(path, 48000));
+    // Feed the samples in uneven pieces, as the mixer does.
+    for (u32 offset = 0; offset < frames;)
+    {
+      const u32 count = std::min(frames - offset, 1000 + offset % 777);
+      writer.AddStereoSamples(&samples[offset * 2], count);
+      offset += count;
+    }
+    writer.Stop();
+
+    std::string contents;
+    ASSERT_TRUE(File::ReadFileToString(path, contents));
+    const std::vector<u8> data(contents.begin(), contents.end());
+    u64 total_samples = 0;
+    const std::optional<std::vector<s16>> decoded = DecodeFlac(data, &total_samples);
+    ASSERT_TRUE(decoded.has_value()) << fmt::format("{} frames", frames);
+    EXPECT_EQ(frames, total_samples);
+    EXPECT_EQ(samples, *decoded) << fmt::format("{} frames", frames);
+    if (frames > 100000)
+    {
+      EXPECT_LT(data.size(), samples.size() * sizeof(s16));
+    }
+  }
+
+  File::DeleteDirRecursively(directory);
+}
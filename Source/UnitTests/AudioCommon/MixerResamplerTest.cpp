@@ -0,0 +1,156 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "AudioCommon/Mixer.h"
+#include "AudioCommon/MixerResampler.h"
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+
+using namespace AudioCommon;
+
+namespace
+{
+constexpr u32 OUTPUT_RATE = 48000;
+
+// The input rates of the mixer FIFOs: DMA, streaming and GBA, Wii Remote speaker, Skylander portal.
+constexpr u32 INPUT_RATES[] = {32000, 48000, 3000, 8000};
+
+u32 GetRatio(u32 input_rate)
+{
+  const u64 divisor = Mixer::FIXED_SAMPLE_RATE_DIVIDEND / input_rate;
+  return u32((Mixer::FIXED_SAMPLE_RATE_DIVIDEND << 16) / divisor / OUTPUT_RATE);
+}
+
+std::vector<s16> MakeSine(u32 frames, double frequency, u32 rate)
+{
+  std::vector<s16> samples(frames * 2);
+  for (u32 i = 0; i < frames; ++i)
+  {
+    const double phase = 2.0 * std::numbers::pi * frequency * i / rate;
+    samples[i * 2] = s16(std::lround(20000.0 * std::sin(phase)));
+    samples[i * 2 + 1] = s16(std::lround(-10000.0 * std::sin(phase)));
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(MixerResampler, DeinterleaveStereo)
+{
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> dist(-32768, 32767);
+  std::vector<s16> input(2 * 37);
+  for (s16& sample : input)
+    sample = s16(dist(rng));
+
+  for (bool byte_swap : {false, true})
+  {
+    std::vector<s16> left(37);
+    std::vector<s16> right(37);
+    DeinterleaveStereo(input.data(), left.data(), right.data(), 37, byte_swap);
+    for (u32 i = 0; i < 37; ++i)
+    {
+      EXPECT_EQ(byte_swap ? s16(Common::swap16(input[i * 2])) : input[i * 2], left[i]);
+      EXPECT_EQ(byte_swap ? s16(Common::swap16(input[i * 2 + 1])) : input[i * 2 + 1], right[i]);
+    }
+  }
+}
+
+TEST(MixerResampler, OutputCountMatchesConsumedInput)
+{
+  std::mt19937 rng(2);
+  std::uniform_int_distribution<u32> ratio_dist(0x100, 0x80000);
+  std::uniform_int_distribution<u32> frac_dist(0, 0xffff);
+  std::vector<s32> out(2 * 8192);
+
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    const u32 ratio = ratio_dist(rng);
+    const u32 start_frac = frac_dist(rng);
+    const u32 input_frames = RESAMPLER_TAPS + i % 256;
+    const u32 count = std::min(GetResamplerOutputCount(input_frames, start_frac, ratio), 8192u);
+    ASSERT_GT(count, 0u);
+
+    // The last output frame reads up to the last input frame, one more would need another one.
+    const std::vector<s16> silence(input_frames);
+    u32 frac = start_frac;
+    const u32 consumed = ResampleAndMix(silence.data(), silence.data(), out.data(), count, &frac,
+                                        ratio, 256, 256);
+    EXPECT_EQ((start_frac + u64(count) * ratio) >> 16, consumed);
+    EXPECT_EQ((start_frac + u64(count) * ratio) & 0xffff, frac);
+    EXPECT_LE(((start_frac + u64(count - 1) * ratio) >> 16) + RESAMPLER_TAPS, input_frames);
+    if (count < 8192)
+    {
+      EXPECT_GT(consumed + RESAMPLER_TAPS, input_frames);
+    }
+  }
+
+  EXPECT_EQ(0u, GetResamplerOutputCount(RESAMPLER_TAPS - 1, 0, 0x10000));
+}
+
+TEST(MixerResampler, ConstantInputIsUnchanged)
+{
+  for (u32 input_rate : INPUT_RATES)
+  {
+    const std::vector<s16> left(512, s16(-12345));
+    const std::vector<s16> right(512, s16(32767));
+    std::vector<s32> out(2 * 2048);
+    const u32 ratio = GetRatio(input_rate) + 7;
+    u32 frac = 0x1234;
+    const u32 count = std::min(GetResamplerOutputCount(512, frac, ratio), 2048u);
+    ResampleAndMix(left.data(), right.data(), out.data(), count, &frac, ratio, 256, 128);
+
+    for (u32 i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(32767 / 2, out[i * 2]) << fmt::format("rate {} frame {}", input_rate, i);
+      ASSERT_EQ(-12345, out[i * 2 + 1]) << fmt::format("rate {} frame {}", input_rate, i);
+    }
+  }
+}
+
+TEST(MixerResampler, SineIsResampledAtTheRightPosition)
+{
+  for (u32 input_rate : {32000u, 48000u})
+  {
+    constexpr u32 frames = 2048;
+    constexpr double frequency = 1000.0;
+    const std::vector<s16> input = MakeSine(frames, frequency, input_rate);
+    std::vector<s16> left(frames);
+    std::vector<s16> right(frames);
+    DeinterleaveStereo(input.data(), left.data(), right.data(), frames, false);
+
+    const u32 ratio = GetRatio(input_rate);
+    u32 frac = 0;
+    const u32 count = GetResamplerOutputCount(frames, frac, ratio);
+    std::vector<s32> out(count * 2);
+    ResampleAndMix(left.data(), right.data(), out.data(), count, &frac, ratio, 256, 256);
+
+    // Output frame n lies between the input frames RESAMPLER_HISTORY and RESAMPLER_HISTORY + 1
+    // after the start of its taps.
+    for (u32 i = 0; i < count; ++i)
+    {
+      const double position = RESAMPLER_HISTORY + double(u64(i) * ratio) / 65536.0;
+      const double expected = std::sin(2.0 * std::numbers::pi * frequency * position / input_rate);
+      ASSERT_NEAR(20000.0 * expected, out[i * 2 + 1], 200.0) << fmt::format("frame {}", i);
+      ASSERT_NEAR(-10000.0 * expected, out[i * 2], 100.0) << fmt::format("frame {}", i);
+    }
+  }
+}
+
+TEST(MixerResampler, ClampMixedSamples)
+{
+  const std::vector<s32> input = {-100000, -32768, -32767, -1, 0, 1,  32767,
+                                  32768,   99999,  5,      6, 7, -8, 40000};
+  std::vector<s16> output(input.size());
+  ClampMixedSamples(input.data(), output.data(), u32(input.size()));
+  for (size_t i = 0; i < input.size(); ++i)
+    EXPECT_EQ(std::clamp(input[i], -32767, 32767), output[i]);
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/AES.h"
+
+namespace
+{
+constexpr std::array<u8, 16> KEY = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+
+std::vector<u8> MakeData(size_t size, u8 seed)
+{
+  std::vector<u8> data(size);
+  u32 state = seed;
+  for (u8& byte : data)
+  {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<u8>(state >> 16);
+  }
+  return data;
+}
+
+void TestCryptMultiple(Common::AES::Mode mode, bool use_ivs)
+{
+  const auto context = mode == Common::AES::Mode::Encrypt ?
+                           Common::AES::CreateContextEncrypt(KEY.data()) :
+                           Common::AES::CreateContextDecrypt(KEY.data());
+
+  // Enough buffers to test both the interleaved path and the leftovers
+  constexpr size_t COUNT = 19;
+  constexpr size_t LEN = 0x400;
+
+  std::vector<std::vector<u8>> inputs, ivs, outputs;
+  std::vector<const u8*> input_ptrs, iv_ptrs;
+  std::vector<u8*> output_ptrs;
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    inputs.push_back(MakeData(LEN, static_cast<u8>(i)));
+    ivs.push_back(MakeData(Common::AES::Context::BLOCK_SIZE, static_cast<u8>(i + 100)));
+    outputs.emplace_back(LEN);
+  }
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    input_ptrs.push_back(inputs[i].data());
+    iv_ptrs.push_back(ivs[i].data());
+    output_ptrs.push_back(outputs[i].data());
+  }
+
+  ASSERT_TRUE(context->CryptMultiple(use_ivs ? iv_ptrs.data() : nullptr, input_ptrs.data(),
+                                     output_ptrs.data(), COUNT, LEN));
+
+  for (size_t i = 0; i < COUNT; ++i)
+  {
+    std::vector<u8> expected(LEN);
+    ASSERT_TRUE(context->Crypt(use_ivs ? ivs[i].data() : nullptr, inputs[i].data(),
+                               expected.data(), LEN));
+    EXPECT_EQ(outputs[i], expected) << "buffer " << i;
+  }
+}
+}  // namespace
+
+TEST(AES, Vector)
+{
+  // F.2.1 CBC-AES128.Encrypt from NIST SP 800-38A
+  constexpr std::array<u8, 16> iv = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                     0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f};
+  constexpr std::array<u8, 16> plaintext = {0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96,
+                                            0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a};
+  constexpr std::array<u8, 16> ciphertext = {0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46,
+                                             0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d};
+
+  std::array<u8, 16> actual;
+  ASSERT_TRUE(Common::AES::CreateContextEncrypt(KEY.data())
+                  ->Crypt(iv.data(), plaintext.data(), actual.data(), actual.size()));
+  EXPECT_EQ(actual, ciphertext);
+
+  ASSERT_TRUE(Common::AES::CreateContextDecrypt(KEY.data())
+                  ->Crypt(iv.data(), ciphertext.data(), actual.data(), actual.size()));
+  EXPECT_EQ(actual, plaintext);
+}
+
+TEST(AES, EncryptMultiple)
+{
+  TestCryptMultiple(Common::AES::Mode::Encrypt, true);
+  TestCryptMultiple(Common::AES::Mode::Encrypt, false);
+}
+
+TEST(AES, DecryptMultiple)
+{
+  TestCryptMultiple(Common::AES::Mode::Decrypt, true);
+  TestCryptMultiple(Common::AES::Mode::Decrypt, false);
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+
+namespace
+{
+std::vector<u8> MakeRandomData(size_t size)
+{
+  std::mt19937 rng(static_cast<u32>(size));
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(dist(rng));
+  return data;
+}
+}  // namespace
+
+TEST(Hash, GetHash64IsDeterministic)
+{
+  const std::vector<u8> data = MakeRandomData(4096 + 5);
+  for (u32 samples : {0u, 1u, 128u})
+  {
+    EXPECT_EQ(Common::GetHash64(data.data(), u32(data.size()), samples),
+              Common::GetHash64(data.data(), u32(data.size()), samples));
+    EXPECT_EQ(Common::GetHash64XXH3(data.data(), u32(data.size()), samples),
+              Common::GetHash64XXH3(data.data(), u32(data.size()), samples));
+  }
+}
+
+TEST(Hash, XXH3DetectsSingleByteChanges)
+{
+  std::vector<u8> data = MakeRandomData(64 * 1024);
+  const u64 original = Common::GetHash64XXH3(data.data(), u32(data.size()), 0);
+
+  for (size_t offset : {size_t(0), size_t(1), data.size() / 2, data.size() - 1})
+  {
+    data[offset] ^= 0x40;
+    EXPECT_NE(original, Common::GetHash64XXH3(data.data(), u32(data.size()), 0));
+    data[offset] ^= 0x40;
+  }
+
+  EXPECT_EQ(original, Common::GetHash64XXH3(data.data(), u32(data.size()), 0));
+}
+
+TEST(Hash, XXH3SampledMatchesLegacy)
+{
+  // Sampled hashes intentionally keep using the legacy strided hash.
+  const std::vector<u8> data = MakeRandomData(256 * 1024);
+  EXPECT_EQ(Common::GetHash64(data.data(), u32(data.size()), 128),
+            Common::GetHash64XXH3(data.data(), u32(data.size()), 128));
+}
+
+TEST(Hash, XXH3HandlesSmallInputs)
+{
+  // The start of xxHash's own sanity test buffer, so that these match its test vectors.
+  std::array<u8, 17> data;
+  u64 generator = 2654435761;
+  for (u8& byte : data)
+  {
+    byte = static_cast<u8>(generator >> 56);
+    generator *= 0x9E3779B185EBCA8D;
+  }
+
+  struct TestVector
+  {
+    u32 length;
+    u64 xxh3_64;
+    u64 xxh3_128_low;
+    u64 xxh3_128_high;
+  };
+  // Each length takes a different code path in XXH3.
+  static constexpr std::array<TestVector, 7> test_vectors{{
+      {0, 0x2D06800538D394C2, 0x6001C324468D497F, 0x99AA06D3014798D8},
+      {1, 0xC44BDFF4074EECDB, 0xC44BDFF4074EECDB, 0xA6CD5E9392000F6A},
+      {3, 0x54247382A8D6B94D, 0x54247382A8D6B94D, 0x20EFC49FF02422EA},
+      {4, 0xE5DC74BC51848A51, 0x2E7D8D6876A39FE9, 0x970D585AC632BF8E},
+      {8, 0x24CCC9ACAA9F65E4, 0x64C69CAB4BB21DC5, 0x47A7F080D82BB456},
+      {16, 0x981B17D36C7498C9, 0x562980258A998629, 0xC68C368ECF8A9C05},
+      {17, 0x796F5ACD3A60F862, 0xABBC12D11973D7DB, 0x955FA78643ED3669},
+  }};
+
+  for (const TestVector& test_vector : test_vectors)
+  {
+    SCOPED_TRACE(test_vector.length);
+    EXPECT_EQ(test_vector.xxh3_64, Common::GetHash64XXH3(data.data(), test_vector.length, 0));
+    const XXH128_hash_t hash = XXH3_128bits(data.data(), test_vector.length);
+    EXPECT_EQ(test_vector.xxh3_128_low, hash.low64);
+    EXPECT_EQ(test_vector.xxh3_128_high, hash.high64);
+  }
+}
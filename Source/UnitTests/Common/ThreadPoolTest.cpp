@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ThreadPool.h"
+
+TEST(ThreadPool, ParallelForVisitsEveryIndexOnce)
+{
+  for (u32 num_threads : {0u, 1u, 4u})
+  {
+    Common::ThreadPool pool("ThreadPoolTest", num_threads);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.ParallelFor(static_cast<u32>(visits.size()), [&](u32 i) { visits[i]++; });
+    for (const auto& count : visits)
+      EXPECT_EQ(1, count.load());
+  }
+}
+
+TEST(ThreadPool, WaitGroupsAreIndependent)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 2);
+  Common::ThreadPool::WaitGroup first;
+  Common::ThreadPool::WaitGroup second;
+  std::atomic<int> first_count = 0;
+  std::atomic<int> second_count = 0;
+
+  for (int i = 0; i < 100; ++i)
+  {
+    pool.Submit([&] { first_count++; }, &first);
+    pool.Submit([&] { second_count++; }, &second);
+  }
+
+  pool.Wait(first);
+  EXPECT_EQ(100, first_count.load());
+  pool.Wait(second);
+  EXPECT_EQ(100, second_count.load());
+  EXPECT_TRUE(first.IsDone());
+  EXPECT_TRUE(second.IsDone());
+}
+
+TEST(ThreadPool, ShutdownRunsQueuedJobs)
+{
+  std::atomic<int> count = 0;
+  {
+    Common::ThreadPool pool("ThreadPoolTest", 3);
+    for (int i = 0; i < 100; ++i)
+      pool.Submit([&] { count++; });
+  }
+  EXPECT_EQ(100, count.load());
+}
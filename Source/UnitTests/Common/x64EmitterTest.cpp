@@ -105,6 +105,7 @@ protected:
     cpu_info.bSSE4_2 = true;
     cpu_info.bLZCNT = true;
     cpu_info.bAVX = true;
+    cpu_info.bAVX2 = true;
     cpu_info.bBMI1 = true;
     cpu_info.bBMI2 = true;
     cpu_info.bBMI2FastParallelBitOps = true;
@@ -1362,6 +1363,27 @@ FMA4_TEST(VFNMSUB, S, false)
 FMA4_TEST(VFMADDSUB, P, true)
 FMA4_TEST(VFMSUBADD, P, true)
 
+TEST_F(x64EmitterTest, AVX_256)
+{
+  emitter->VZEROUPPER();
+  ExpectBytes({0xC5, 0xF8, 0x77});
+
+  emitter->VCVTDQ2PS_ymm(XMM0, R(XMM1));
+  ExpectBytes({0xC5, 0xFC, 0x5B, 0xC1});
+
+  emitter->VMULPS_ymm(XMM1, XMM2, R(XMM3));
+  ExpectBytes({0xC5, 0xEC, 0x59, 0xCB});
+
+  emitter->VMOVUPS_ymm(MatR(R12), XMM0);
+  ExpectBytes({0xC4, 0xC1, 0x7C, 0x11, 0x04, 0x24});
+
+  emitter->VPMOVSXWD_ymm(XMM8, R(XMM1));
+  ExpectBytes({0xC4, 0x62, 0x7D, 0x23, 0xC1});
+
+  emitter->VPMOVZXBD_ymm(XMM0, R(XMM1));
+  ExpectBytes({0xC4, 0xE2, 0x7D, 0x31, 0xC1});
+}
+
 }  // namespace Gen
 
 #ifdef _MSC_VER
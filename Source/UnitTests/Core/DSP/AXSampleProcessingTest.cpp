@@ -0,0 +1,275 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXSampleProcessing.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// The sample-by-sample resampler the vectorized code replaced.
+u32 ReferenceResample(const std::vector<s16>& input, s16* output, u32 count, s16* last_samples,
+                      u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+{
+  u32 read = 0;
+  const auto next_sample = [&] { return input[read++]; };
+
+  if (srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
+  {
+    s16 temp[4];
+    u32 idx = 0;
+
+    temp[idx++ & 3] = last_samples[0];
+    temp[idx++ & 3] = last_samples[1];
+    temp[idx++ & 3] = last_samples[2];
+    temp[idx++ & 3] = last_samples[3];
+
+    for (u32 i = 0; i < count; ++i)
+    {
+      curr_pos += ratio;
+      while (curr_pos >= 0x10000)
+      {
+        temp[idx++ & 3] = next_sample();
+        curr_pos -= 0x10000;
+      }
+
+      if (coeffs && srctype == SRCTYPE_POLYPHASE)
+      {
+        const s16* c = &coeffs[((curr_pos & 0xFFFF) >> 9) << 2];
+        const s64 t0 = temp[idx++ & 3];
+        const s64 t1 = temp[idx++ & 3];
+        const s64 t2 = temp[idx++ & 3];
+        const s64 t3 = temp[idx++ & 3];
+        const s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
+        output[i] = MathUtil::SaturatingCast<s16>(samp);
+      }
+      else
+      {
+        const u16 curr_frac = curr_pos & 0xFFFF;
+        const u16 inv_curr_frac = -curr_frac;
+        if (curr_frac)
+        {
+          const s32 s0 = temp[idx++ & 3];
+          const s32 s1 = temp[idx++ & 3];
+          output[i] = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+          idx += 2;
+        }
+        else
+        {
+          output[i] = temp[idx++ & 3];
+          idx += 3;
+        }
+      }
+    }
+
+    last_samples[3] = temp[--idx & 3];
+    last_samples[2] = temp[--idx & 3];
+    last_samples[1] = temp[--idx & 3];
+    last_samples[0] = temp[--idx & 3];
+  }
+  else
+  {
+    for (u32 i = 0; i < count; ++i)
+      output[i] = next_sample();
+    std::copy_n(output + count - 4, 4, last_samples);
+  }
+
+  return curr_pos;
+}
+
+u16 ReferenceVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 current_volume = signed_volume ? s32(s16(volume)) : s32(volume);
+    const s32 sample = (s32(samples[i]) * current_volume) >> 15;
+    samples[i] = std::clamp(sample, -32767, 32767);
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+u16 ReferenceMixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                    s16* last_sample)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 sample = std::clamp((s32(input[i]) * volume) >> 15, -32767, 32767);
+    out[i] += s16(sample);
+    volume += volume_delta;
+    *last_sample = s16(sample);
+  }
+  return volume;
+}
+
+// Stand-in for the polyphase coefficients from the DSP DROM, which can't be shipped here. It
+// contains both typical low pass filter taps and the extreme values which make pmaddwd overflow.
+std::vector<s16> MakeCoefficients(u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(-12000, 24000);
+  std::vector<s16> coeffs(0x200 * 3);
+  for (s16& c : coeffs)
+    c = s16(dist(rng));
+  std::fill_n(coeffs.begin() + 0x200 + 0x40, 0x40, s16(-32768));
+  std::fill_n(coeffs.begin() + 0x400, 0x200, s16(-32768));
+  return coeffs;
+}
+
+std::vector<s16> MakeSamples(size_t size, std::mt19937& rng, bool extreme)
+{
+  std::uniform_int_distribution<int> dist(-32768, 32767);
+  std::vector<s16> samples(size);
+  for (s16& sample : samples)
+    sample = extreme ? (dist(rng) & 1 ? 32767 : -32768) : s16(dist(rng));
+  return samples;
+}
+
+// Replays a sequence of frames the way a voice would be processed, carrying the resampler state
+// from one frame to the next.
+void CheckResampling(int srctype, const s16* coeffs, u32 count, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<u32> ratio_dist(0x800, 0x40000);
+  std::uniform_int_distribution<u32> frac_dist(0, 0xFFFF);
+
+  std::array<s16, 4> expected_last{};
+  std::array<s16, 4> actual_last{};
+  u32 expected_pos = frac_dist(rng);
+  u32 actual_pos = expected_pos;
+
+  for (int frame = 0; frame < 64; ++frame)
+  {
+    // Include exact ratios so that the fractional position stays at zero.
+    u32 ratio = ratio_dist(rng);
+    if (frame % 8 == 0)
+      ratio &= ~0xFFFFu;
+    if (ratio == 0)
+      ratio = 0x10000;
+
+    const u32 input_count = GetResamplerInputCount(count, actual_pos, ratio, srctype);
+    const std::vector<s16> samples = MakeSamples(input_count, rng, frame % 4 == 3);
+
+    std::vector<s16> expected(count);
+    expected_pos = ReferenceResample(samples, expected.data(), count, expected_last.data(),
+                                     expected_pos, ratio, srctype, coeffs) &
+                   0xFFFF;
+
+    std::vector<s16> input(4 + input_count);
+    std::copy(actual_last.begin(), actual_last.end(), input.begin());
+    std::copy(samples.begin(), samples.end(), input.begin() + 4);
+    std::vector<s16> actual(count);
+    actual_pos = ResampleSamples(input.data(), actual.data(), count, actual_last.data(), actual_pos,
+                                 ratio, srctype, coeffs) &
+                 0xFFFF;
+
+    ASSERT_EQ(expected, actual) << fmt::format("srctype {} count {} frame {}", srctype, count,
+                                               frame);
+    ASSERT_EQ(expected_last, actual_last);
+    ASSERT_EQ(expected_pos, actual_pos);
+  }
+}
+
+constexpr u32 FRAME_SIZES[] = {32, 96, 6, 18, 5, 13};
+}  // namespace
+
+TEST(AXSampleProcessing, ResampleNearest)
+{
+  for (u32 count : FRAME_SIZES)
+    CheckResampling(SRCTYPE_NEAREST, nullptr, count, count);
+}
+
+TEST(AXSampleProcessing, ResampleLinear)
+{
+  for (u32 count : FRAME_SIZES)
+    CheckResampling(SRCTYPE_LINEAR, nullptr, count, count);
+}
+
+TEST(AXSampleProcessing, ResamplePolyphaseWithoutCoefficients)
+{
+  for (u32 count : FRAME_SIZES)
+    CheckResampling(SRCTYPE_POLYPHASE, nullptr, count, count);
+}
+
+TEST(AXSampleProcessing, ResamplePolyphase)
+{
+  const std::vector<s16> coeffs = MakeCoefficients(1);
+  for (u32 coef_select = 0; coef_select < 3; ++coef_select)
+  {
+    for (u32 count : FRAME_SIZES)
+      CheckResampling(SRCTYPE_POLYPHASE, &coeffs[coef_select * 0x200], count, count + coef_select);
+  }
+}
+
+TEST(AXSampleProcessing, VolumeRamp)
+{
+  std::mt19937 rng(2);
+  std::uniform_int_distribution<int> volume_dist(0, 0xFFFF);
+
+  for (bool signed_volume : {true, false})
+  {
+    for (u32 count : FRAME_SIZES)
+    {
+      u16 expected_volume = u16(volume_dist(rng));
+      u16 actual_volume = expected_volume;
+      for (int frame = 0; frame < 32; ++frame)
+      {
+        const u16 volume_delta = frame % 4 == 0 ? 0 : u16(volume_dist(rng) >> (frame % 8));
+        std::vector<s16> expected = MakeSamples(count, rng, frame % 4 == 1);
+        std::vector<s16> actual = expected;
+
+        expected_volume = ReferenceVolumeRamp(expected.data(), count, expected_volume,
+                                              volume_delta, signed_volume);
+        actual_volume =
+            ApplyVolumeRamp(actual.data(), count, actual_volume, volume_delta, signed_volume);
+
+        ASSERT_EQ(expected, actual) << fmt::format("signed {} count {}", signed_volume, count);
+        ASSERT_EQ(expected_volume, actual_volume);
+      }
+    }
+  }
+}
+
+TEST(AXSampleProcessing, MixAddWithRamp)
+{
+  std::mt19937 rng(3);
+  std::uniform_int_distribution<int> volume_dist(0, 0xFFFF);
+  std::uniform_int_distribution<int> out_dist(-0x800000, 0x7FFFFF);
+
+  for (u32 count : FRAME_SIZES)
+  {
+    u16 expected_volume = u16(volume_dist(rng));
+    u16 actual_volume = expected_volume;
+    for (int frame = 0; frame < 32; ++frame)
+    {
+      const u16 volume_delta = frame % 4 == 0 ? 0 : u16(volume_dist(rng) >> (frame % 8));
+      const std::vector<s16> input = MakeSamples(count, rng, frame % 4 == 1);
+      std::vector<int> expected(count);
+      for (int& sample : expected)
+        sample = out_dist(rng);
+      std::vector<int> actual = expected;
+      s16 expected_dpop = 0x1234;
+      s16 actual_dpop = 0x1234;
+
+      expected_volume = ReferenceMixAdd(expected.data(), input.data(), count, expected_volume,
+                                        volume_delta, &expected_dpop);
+      actual_volume = MixAddWithRamp(actual.data(), input.data(), count, actual_volume,
+                                     volume_delta, &actual_dpop);
+
+      ASSERT_EQ(expected, actual) << fmt::format("count {}", count);
+      ASSERT_EQ(expected_volume, actual_volume);
+      ASSERT_EQ(expected_dpop, actual_dpop);
+    }
+  }
+}
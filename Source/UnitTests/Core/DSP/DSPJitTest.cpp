@@ -0,0 +1,247 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonPaths.h"
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/MemoryUtil.h"
+#include "Common/Swap.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCodeUtil.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+using namespace DSP;
+
+namespace
+{
+// Every program ends in this idle loop, which is where the cores are compared.
+constexpr char PROGRAM_END[] = R"(
+end:
+	jmp	end
+)";
+
+// The mixing loop of the Hermes test ucode, with the samples coming from DRAM instead of the
+// accelerator and the clamping done with branches, so that the loop body is split into several
+// blocks depending on the samples.
+constexpr char MIXER_PROGRAM[] = R"(
+	lri	$AR0, #0x0100
+	lri	$AR1, #0x0400
+	lri	$AX0.L, #0x00c0
+	lri	$AX1.H, #0x0123
+	lri	$AX1.L, #0x4567
+	clr	$ACC1
+	bloop	$AX0.L, mix_end
+	lrri	$AC0.L, @$AR0
+	movax	$ACC1, $AX1.L
+	asl	$ACC0, #24
+	asr	$ACC0, #-8
+	add	$ACC0, $ACC1
+	cmpi	$AC0.M, #0x1000
+	jle	no_clamp
+	lri	$AC0.M, #0x1000
+no_clamp:
+	addis	$AC1.M, #0x35
+	mrr	$AX1.L, $AC1.M
+	mulac	$AX0.L, $AX1.H, $ACC1
+mix_end:
+	srri	@$AR1, $AC0.M
+	sr	@0x0000, $AC1.M
+	sr	@0x0001, $AC1.L
+)";
+
+// Nested loops of all four kinds, including loops that are skipped because their count is zero
+// and loops that end on the same instruction.
+constexpr char NESTED_LOOP_PROGRAM[] = R"(
+	lri	$AR0, #0x0600
+	clr	$ACC0
+	clr	$ACC1
+	lri	$AX0.L, #0x0003
+	lri	$AX0.H, #0x0101
+	lri	$AX1.L, #0x0007
+	lri	$AX1.H, #0x0000
+	bloopi	#0x11, outer_end
+	loopi	#0x05
+	addax	$ACC0, $AX0
+	loop	$AX1.H
+	inc	$ACC1
+	bloop	$AX1.L, inner_end
+	addax	$ACC1, $AX0
+	mulac	$AX0.L, $AX0.H, $ACC1
+inner_end:
+	asr16	$ACC1
+	bloop	$AX1.H, skipped_end
+	inc	$ACC0
+skipped_end:
+	inc	$ACC0
+	loop	$AX0.L
+	inc	$ACC0
+	bloopi	#0x02, shared_end
+	addis	$AC1.M, #0x03
+shared_end:
+	addis	$AC0.M, #0x01
+outer_end:
+	srri	@$AR0, $AC0.M
+	sr	@0x0002, $AC1.M
+	sr	@0x0003, $AC1.L
+)";
+
+// A subroutine called from within a loop, for linking between blocks.
+constexpr char CALL_PROGRAM[] = R"(
+	lri	$AR0, #0x0700
+	lri	$AX0.L, #0x0021
+	lri	$AX0.H, #0x0b00
+	clr	$ACC0
+	bloopi	#0x40, call_end
+	call	sub
+	addis	$AC0.M, #0x02
+call_end:
+	srri	@$AR0, $AC0.M
+	jmp	call_done
+
+sub:
+	addax	$ACC0, $AX0
+	mrr	$AX1.L, $AC0.M
+	addaxl	$ACC0, $AX1.L
+	asr	$ACC0, #-1
+	ret
+call_done:
+)";
+
+// Builds a loop with a body that is longer than a single block, so that iterations cross block
+// boundaries and the loop end is in a different block than the loop start.
+std::string MakeLongLoopProgram()
+{
+  std::string program = R"(
+	lri	$AR0, #0x0800
+	lri	$AX0.L, #0x0005
+	lri	$AX0.H, #0x0003
+	clr	$ACC0
+	clr	$ACC1
+	bloopi	#0x09, long_end
+)";
+  for (int i = 0; i < 150; ++i)
+  {
+    program += "\taddax\t$ACC0, $AX0\n";
+    program += i % 2 ? "\tinc\t$ACC1\n" : "\taddis\t$AC1.M, #0x07\n";
+  }
+  program += R"(
+	srri	@$AR0, $AC1.M
+long_end:
+	srri	@$AR0, $AC0.M
+)";
+  return program;
+}
+
+std::vector<std::string> GetPrograms()
+{
+  return {MIXER_PROGRAM, NESTED_LOOP_PROGRAM, CALL_PROGRAM, MakeLongLoopProgram()};
+}
+
+bool LoadRom(const std::string& path, u16* rom, size_t size_in_bytes)
+{
+  std::string bytes;
+  if (!File::ReadFileToString(path, bytes) || bytes.size() != size_in_bytes)
+    return false;
+
+  const u16* words = reinterpret_cast<const u16*>(bytes.data());
+  for (size_t i = 0; i < size_in_bytes / 2; ++i)
+    rom[i] = Common::swap16(words[i]);
+  return true;
+}
+
+// Sets up a DSP which runs <code> from the start of IRAM. This requires the free DSP ROM from the
+// Sys directory, as the core refuses to start with an unknown ROM.
+std::unique_ptr<DSPCore> CreateCore(DSPInitOptions::CoreType core_type,
+                                    const std::vector<u16>& code)
+{
+  DSPInitOptions opts;
+#ifdef DSP_TEST_SYS_DIR
+  const std::string rom_dir = DSP_TEST_SYS_DIR GC_SYS_DIR DIR_SEP;
+#else
+  const std::string rom_dir = File::GetSysDirectory() + GC_SYS_DIR DIR_SEP;
+#endif
+  if (!LoadRom(rom_dir + DSP_IROM, opts.irom_contents.data(), DSP_IROM_BYTE_SIZE) ||
+      !LoadRom(rom_dir + DSP_COEF, opts.coef_contents.data(), DSP_COEF_BYTE_SIZE))
+  {
+    return nullptr;
+  }
+  opts.core_type = core_type;
+
+  InitInstructionTable();
+  auto core = std::make_unique<DSPCore>();
+  if (!core->Initialize(opts))
+    return nullptr;
+
+  SDSP& state = core->DSPState();
+  Common::UnWriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+  std::copy(code.begin(), code.end(), state.iram);
+  Common::WriteProtectMemory(state.iram, DSP_IRAM_BYTE_SIZE, false);
+  core->ClearIRAM();
+  state.GetAnalyzer().Analyze(state);
+
+  for (u16 i = 0; i < 0x1000; ++i)
+    state.dram[i] = static_cast<u16>(i * 0x9e37 + 0x1234);
+
+  state.pc = 0;
+  state.control_reg &= ~CR_HALT;
+  return core;
+}
+
+std::vector<u16> Assemble(const std::string& program, u16* end_address)
+{
+  std::vector<u16> code;
+  EXPECT_TRUE(DSP::Assemble(program + PROGRAM_END, code));
+  // The idle loop is the last instruction.
+  *end_address = static_cast<u16>(code.size() - 2);
+  return code;
+}
+
+void RunUntil(DSPCore& core, u16 end_address)
+{
+  for (int slice = 0; slice < 10000 && core.DSPState().pc != end_address; ++slice)
+    core.RunCycles(500);
+  ASSERT_EQ(end_address, core.DSPState().pc) << "program did not finish";
+}
+}  // namespace
+
+TEST(DSPJit, MatchesInterpreter)
+{
+  for (const std::string& program : GetPrograms())
+  {
+    u16 end_address;
+    const std::vector<u16> code = Assemble(program, &end_address);
+
+    auto interpreter = CreateCore(DSPInitOptions::CoreType::Interpreter, code);
+    auto jit = CreateCore(DSPInitOptions::CoreType::JIT64, code);
+    ASSERT_TRUE(interpreter && jit) << "The free DSP ROM was not found in the Sys directory.";
+
+    RunUntil(*interpreter, end_address);
+    RunUntil(*jit, end_address);
+
+    for (size_t reg = 0; reg < 32; ++reg)
+    {
+      EXPECT_EQ(interpreter->ReadRegister(reg), jit->ReadRegister(reg))
+          << fmt::format("register {:#04x}, program ending at {:#06x}", reg, end_address);
+    }
+    for (size_t i = 0; i < 4; ++i)
+      EXPECT_EQ(interpreter->DSPState().reg_stack_ptrs[i], jit->DSPState().reg_stack_ptrs[i]);
+
+    const u16* expected_dram = interpreter->DSPState().dram;
+    const u16* actual_dram = jit->DSPState().dram;
+    EXPECT_TRUE(std::equal(expected_dram, expected_dram + DSP_DRAM_SIZE, actual_dram))
+        << fmt::format("DRAM mismatch, program ending at {:#06x}", end_address);
+
+    interpreter->Shutdown();
+    jit->Shutdown();
+  }
+}
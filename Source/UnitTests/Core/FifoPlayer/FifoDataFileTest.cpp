@@ -0,0 +1,134 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/ScopeGuard.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+namespace
+{
+constexpr u32 FRAME_COUNT = 8;
+constexpr size_t TEXTURE_SIZE = 64 * 1024;
+
+// Random data doesn't compress, so it takes up exactly its size in the file.
+std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(dist(rng));
+  return data;
+}
+
+// Every frame uploads a texture, which is the same one in every frame if share_texture is set.
+std::unique_ptr<FifoDataFile> MakeFile(bool share_texture)
+{
+  auto file = std::make_unique<FifoDataFile>();
+  file->SetIsWii(true);
+  file->GetBPMem()[0x12] = 0x12345678;
+  file->GetXFRegs()[3] = 0x9abcdef0;
+  file->GetTexMem()[0x4321] = 0x42;
+
+  const std::vector<u8> texture = MakeRandomData(TEXTURE_SIZE, 0);
+  for (u32 i = 0; i < FRAME_COUNT; ++i)
+  {
+    FifoFrameInfo frame;
+    frame.fifoData = MakeRandomData(1000 + i, i + 1);
+    frame.fifoStart = 0x1000 * i;
+    frame.fifoEnd = frame.fifoStart + static_cast<u32>(frame.fifoData.size());
+
+    MemoryUpdate& texture_update = frame.memoryUpdates.emplace_back();
+    texture_update.fifoPosition = 0x10;
+    texture_update.address = 0x00100000;
+    texture_update.data = share_texture ? texture : MakeRandomData(TEXTURE_SIZE, 100 + i);
+    texture_update.type = MemoryUpdate::Type::TextureMap;
+
+    MemoryUpdate& vertex_update = frame.memoryUpdates.emplace_back();
+    vertex_update.fifoPosition = 0x20;
+    vertex_update.address = 0x00200000 + i;
+    vertex_update.data = MakeRandomData(64 + i, 200 + i);
+    vertex_update.type = MemoryUpdate::Type::VertexStream;
+
+    MemoryUpdate& empty_update = frame.memoryUpdates.emplace_back();
+    empty_update.fifoPosition = 0x30;
+    empty_update.type = MemoryUpdate::Type::TMEM;
+
+    file->AddFrame(frame);
+  }
+
+  return file;
+}
+
+void ExpectSameFrame(const FifoFrameInfo& expected, const FifoFrameInfo& actual)
+{
+  EXPECT_EQ(expected.fifoData, actual.fifoData);
+  EXPECT_EQ(expected.fifoStart, actual.fifoStart);
+  EXPECT_EQ(expected.fifoEnd, actual.fifoEnd);
+  ASSERT_EQ(expected.memoryUpdates.size(), actual.memoryUpdates.size());
+  for (size_t i = 0; i < expected.memoryUpdates.size(); ++i)
+  {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(expected.memoryUpdates[i].fifoPosition, actual.memoryUpdates[i].fifoPosition);
+    EXPECT_EQ(expected.memoryUpdates[i].address, actual.memoryUpdates[i].address);
+    EXPECT_EQ(expected.memoryUpdates[i].data, actual.memoryUpdates[i].data);
+    EXPECT_EQ(expected.memoryUpdates[i].type, actual.memoryUpdates[i].type);
+  }
+}
+}  // namespace
+
+TEST(FifoDataFile, SaveAndLoad)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  Common::ScopeGuard delete_directory{[&] { File::DeleteDirRecursively(directory); }};
+
+  const std::string path = directory + "/test.dff";
+  const std::unique_ptr<FifoDataFile> saved = MakeFile(true);
+  ASSERT_TRUE(saved->Save(path));
+
+  const std::unique_ptr<FifoDataFile> loaded = FifoDataFile::Load(path, false);
+  ASSERT_TRUE(loaded);
+  EXPECT_TRUE(loaded->GetIsWii());
+  EXPECT_EQ(0x12345678u, loaded->GetBPMem()[0x12]);
+  EXPECT_EQ(0x9abcdef0u, loaded->GetXFRegs()[3]);
+  EXPECT_EQ(0x42, loaded->GetTexMem()[0x4321]);
+  ASSERT_EQ(FRAME_COUNT, loaded->GetFrameCount());
+
+  // Frames are read on demand, so read them out of order and more than once.
+  for (u32 pass = 0; pass < 2; ++pass)
+  {
+    for (u32 i = FRAME_COUNT; i-- > 0;)
+    {
+      SCOPED_TRACE(i);
+      ExpectSameFrame(*saved->GetFrame(i), *loaded->GetFrame(i));
+    }
+  }
+}
+
+TEST(FifoDataFile, SharedMemoryUpdatesAreStoredOnce)
+{
+  const std::string directory = File::CreateTempDir();
+  ASSERT_FALSE(directory.empty());
+  Common::ScopeGuard delete_directory{[&] { File::DeleteDirRecursively(directory); }};
+
+  const std::string shared_path = directory + "/shared.dff";
+  const std::string unshared_path = directory + "/unshared.dff";
+  ASSERT_TRUE(MakeFile(true)->Save(shared_path));
+  ASSERT_TRUE(MakeFile(false)->Save(unshared_path));
+
+  // Apart from the textures, both files contain the same data.
+  const u64 shared_size = File::GetSize(shared_path);
+  const u64 unshared_size = File::GetSize(unshared_path);
+  ASSERT_LT(shared_size, unshared_size);
+  EXPECT_GE(unshared_size - shared_size, (FRAME_COUNT - 1) * TEXTURE_SIZE);
+  EXPECT_LT(unshared_size - shared_size, FRAME_COUNT * TEXTURE_SIZE);
+}
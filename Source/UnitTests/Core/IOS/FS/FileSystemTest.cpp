@@ -3,15 +3,25 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 #include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/ScopeGuard.h"
+#include "Common/StringUtil.h"
 #include "Core/IOS/FS/FileSystem.h"
+#include "Core/IOS/FS/HostBackend/FS.h"
+#include "Core/IOS/FS/MemoryBackend/FS.h"
+#include "Core/IOS/FS/SnapshotStore.h"
 #include "Core/IOS/IOS.h"
 #include "UICommon/UICommon.h"
 
@@ -19,7 +29,13 @@ using namespace IOS::HLE::FS;
 
 constexpr Modes modes{Mode::ReadWrite, Mode::None, Mode::None};
 
-class FileSystemTest : public testing::Test
+enum class Backend
+{
+  Host,
+  Memory,
+};
+
+class FileSystemTest : public testing::TestWithParam<Backend>
 {
 protected:
   FileSystemTest() : m_profile_path{File::CreateTempDir()}
@@ -30,6 +46,12 @@ protected:
     }
     UICommon::SetUserDirectory(m_profile_path);
     m_fs = IOS::HLE::Kernel{}.GetFS();
+    // Use the NAND that was just set up by the kernel as the base of the in-memory NAND.
+    if (GetParam() == Backend::Memory)
+    {
+      m_fs = std::make_shared<MemoryFileSystem>(
+          std::make_shared<MemoryNand>(File::GetUserPath(D_SESSION_WIIROOT_IDX)));
+    }
   }
 
   virtual ~FileSystemTest()
@@ -91,7 +113,124 @@ TEST(FileSystem, PathSplitting)
   EXPECT_EQ(SplitPathAndBasename("/shared2"), result);
 }
 
-TEST_F(FileSystemTest, EssentialDirectories)
+TEST(FileSystem, SnapshotStoreKeepsNewBlobs)
+{
+  const std::string profile_path = File::CreateTempDir();
+  ASSERT_FALSE(profile_path.empty());
+  Common::ScopeGuard delete_profile{[&] { File::DeleteDirRecursively(profile_path); }};
+  UICommon::SetUserDirectory(profile_path);
+
+  const auto now = std::filesystem::file_time_type::clock::now();
+  const auto set_age = [&](const std::string& path, std::chrono::hours age) {
+    std::filesystem::last_write_time(StringToPath(path), now - age);
+  };
+
+  const std::string states_path = File::GetUserPath(D_STATESAVES_IDX);
+  ASSERT_TRUE(File::CreateFullPath(states_path + "NAND/"));
+  const std::string state_path = states_path + "RMCE01.s01";
+  ASSERT_TRUE(File::IOFile(state_path, "wb").WriteString("state"));
+  set_age(state_path, std::chrono::hours(24 * 7));
+
+  // A file that was last modified long before the oldest savestate was made
+  const std::vector<u8> TEST_DATA{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+  const std::string file_path = profile_path + "/old_file";
+  ASSERT_TRUE(File::IOFile(file_path, "wb").WriteBytes(TEST_DATA.data(), TEST_DATA.size()));
+  set_age(file_path, std::chrono::hours(24 * 30));
+
+  const Common::SHA1::Digest digest = Common::SHA1::CalculateDigest(TEST_DATA);
+  const std::string blob_path = GetSnapshotBlobPath(digest);
+  ASSERT_TRUE(StoreSnapshotBlob(file_path, digest));
+  PruneSnapshotBlobs();
+  EXPECT_TRUE(File::Exists(blob_path));
+
+  // Once no savestate has used the blob for a while, it is removed
+  set_age(blob_path, std::chrono::hours(24 * 30));
+  PruneSnapshotBlobs();
+  EXPECT_FALSE(File::Exists(blob_path));
+}
+
+TEST(FileSystem, MemoryNandBaseDirectory)
+{
+  const std::string base_path = File::CreateTempDir();
+  ASSERT_FALSE(base_path.empty());
+  Common::ScopeGuard delete_base{[&] { File::DeleteDirRecursively(base_path); }};
+
+  const std::string data_path = "/title/00010000/52534245/data";
+  const std::string file_path = data_path + "/save.bin";
+  const std::vector<u8> TEST_DATA{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+  {
+    HostFileSystem base{base_path};
+    ASSERT_EQ(base.CreateFullPath(0, 0, data_path + '/', 0, modes), ResultCode::Success);
+    const Result<FileHandle> file = base.CreateAndOpenFile(0, 0, file_path, modes);
+    ASSERT_TRUE(file.Succeeded());
+    ASSERT_TRUE(file->Write(TEST_DATA.data(), TEST_DATA.size()).Succeeded());
+  }
+
+  constexpr Uid uid = 0x1000;
+  constexpr Gid gid = 0x1234;
+  const auto nand = std::make_shared<MemoryNand>();
+  ASSERT_TRUE(nand->AddBaseDirectory(base_path, data_path, uid, gid));
+  MemoryFileSystem fs{nand};
+
+  const Result<Metadata> metadata = fs.GetMetadata(uid, gid, file_path);
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->uid, uid);
+  EXPECT_EQ(metadata->gid, gid);
+  EXPECT_EQ(metadata->size, TEST_DATA.size());
+
+  {
+    const Result<FileHandle> file = fs.OpenFile(uid, gid, file_path, Mode::ReadWrite);
+    ASSERT_TRUE(file.Succeeded());
+    std::vector<u8> read_buffer(TEST_DATA.size());
+    ASSERT_TRUE(file->Read(read_buffer.data(), read_buffer.size()).Succeeded());
+    EXPECT_EQ(TEST_DATA, read_buffer);
+
+    const std::vector<u8> new_data(TEST_DATA.size());
+    ASSERT_TRUE(file->Seek(0, SeekMode::Set).Succeeded());
+    ASSERT_TRUE(file->Write(new_data.data(), new_data.size()).Succeeded());
+  }
+
+  // The base is never written to.
+  HostFileSystem base{base_path};
+  const Result<FileHandle> file = base.OpenFile(0, 0, file_path, Mode::Read);
+  ASSERT_TRUE(file.Succeeded());
+  std::vector<u8> read_buffer(TEST_DATA.size());
+  ASSERT_TRUE(file->Read(read_buffer.data(), read_buffer.size()).Succeeded());
+  EXPECT_EQ(TEST_DATA, read_buffer);
+}
+
+TEST(FileSystem, MemoryNandFlush)
+{
+  const std::string temp_path = File::CreateTempDir();
+  ASSERT_FALSE(temp_path.empty());
+  Common::ScopeGuard delete_temp{[&] { File::DeleteDirRecursively(temp_path); }};
+
+  const auto nand = std::make_shared<MemoryNand>();
+  MemoryFileSystem fs{nand};
+  ASSERT_EQ(fs.CreateFile(0, 0, "/file", 0, modes), ResultCode::Success);
+
+  // Directories that contain something else than a NAND are left alone.
+  const std::string other_path = temp_path + "/other";
+  const std::string other_file_path = other_path + "/keep.txt";
+  ASSERT_TRUE(File::CreateDir(other_path));
+  ASSERT_TRUE(File::WriteStringToFile(other_file_path, "keep"));
+  EXPECT_FALSE(nand->Flush(other_path));
+  EXPECT_TRUE(File::Exists(other_file_path));
+  EXPECT_FALSE(File::Exists(other_path + "/file"));
+
+  const std::string nand_path = temp_path + "/nand";
+  ASSERT_TRUE(nand->Flush(nand_path));
+  EXPECT_TRUE(File::Exists(nand_path + "/file"));
+
+  // A previously flushed NAND is replaced.
+  ASSERT_EQ(fs.Delete(0, 0, "/file"), ResultCode::Success);
+  ASSERT_EQ(fs.CreateFile(0, 0, "/other", 0, modes), ResultCode::Success);
+  ASSERT_TRUE(nand->Flush(nand_path));
+  EXPECT_FALSE(File::Exists(nand_path + "/file"));
+  EXPECT_TRUE(File::Exists(nand_path + "/other"));
+}
+
+TEST_P(FileSystemTest, EssentialDirectories)
 {
   for (const std::string path :
        {"/sys", "/ticket", "/title", "/shared1", "/shared2", "/tmp", "/import", "/meta"})
@@ -100,7 +239,7 @@ TEST_F(FileSystemTest, EssentialDirectories)
   }
 }
 
-TEST_F(FileSystemTest, CreateFile)
+TEST_P(FileSystemTest, CreateFile)
 {
   const std::string PATH = "/tmp/f";
 
@@ -131,7 +270,7 @@ TEST_F(FileSystemTest, CreateFile)
   EXPECT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/1/2/3/4/5/6/7/8/9", 0, modes), ResultCode::NotFound);
 }
 
-TEST_F(FileSystemTest, CreateDirectory)
+TEST_P(FileSystemTest, CreateDirectory)
 {
   const std::string PATH = "/tmp/d";
 
@@ -159,7 +298,7 @@ TEST_F(FileSystemTest, CreateDirectory)
             ResultCode::TooManyPathComponents);
 }
 
-TEST_F(FileSystemTest, Delete)
+TEST_P(FileSystemTest, Delete)
 {
   EXPECT_TRUE(m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp").Succeeded());
   EXPECT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/tmp"), ResultCode::Success);
@@ -185,7 +324,7 @@ TEST_F(FileSystemTest, Delete)
   EXPECT_EQ(m_fs->Delete(Uid{0}, Gid{0}, "/sys/1"), ResultCode::Success);
 }
 
-TEST_F(FileSystemTest, Rename)
+TEST_P(FileSystemTest, Rename)
 {
   EXPECT_TRUE(m_fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp").Succeeded());
 
@@ -203,7 +342,7 @@ TEST_F(FileSystemTest, Rename)
   EXPECT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/f1", "/tmp/f2"), ResultCode::Invalid);
 }
 
-TEST_F(FileSystemTest, RenameWithExistingTargetDirectory)
+TEST_P(FileSystemTest, RenameWithExistingTargetDirectory)
 {
   // Test directory -> existing, non-empty directory.
   // IOS's FS sysmodule is not POSIX compliant and will remove the existing directory
@@ -219,7 +358,7 @@ TEST_F(FileSystemTest, RenameWithExistingTargetDirectory)
   EXPECT_TRUE(children->empty());
 }
 
-TEST_F(FileSystemTest, RenameWithExistingTargetFile)
+TEST_P(FileSystemTest, RenameWithExistingTargetFile)
 {
   const std::string source_path = "/sys/f2";
   const std::string dest_path = "/tmp/f2";
@@ -249,7 +388,7 @@ TEST_F(FileSystemTest, RenameWithExistingTargetFile)
   EXPECT_EQ(metadata->size, TEST_DATA.size());
 }
 
-TEST_F(FileSystemTest, GetDirectoryStats)
+TEST_P(FileSystemTest, GetDirectoryStats)
 {
   auto check_stats = [this](u32 clusters, u32 inodes) {
     const Result<DirectoryStats> stats = m_fs->GetDirectoryStats("/tmp");
@@ -274,7 +413,7 @@ TEST_F(FileSystemTest, GetDirectoryStats)
 
 // Files need to be explicitly created using CreateFile or CreateDirectory.
 // Automatically creating them on first use would be a bug.
-TEST_F(FileSystemTest, NonExistingFiles)
+TEST_P(FileSystemTest, NonExistingFiles)
 {
   const Result<Metadata> metadata = m_fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/foo");
   ASSERT_FALSE(metadata.Succeeded());
@@ -289,7 +428,7 @@ TEST_F(FileSystemTest, NonExistingFiles)
   EXPECT_EQ(children.Error(), ResultCode::NotFound);
 }
 
-TEST_F(FileSystemTest, Seek)
+TEST_P(FileSystemTest, Seek)
 {
   const std::vector<u8> TEST_DATA(10);
 
@@ -327,7 +466,7 @@ TEST_F(FileSystemTest, Seek)
   EXPECT_EQ(new_position.Error(), ResultCode::Invalid);
 }
 
-TEST_F(FileSystemTest, WriteAndSimpleReadback)
+TEST_P(FileSystemTest, WriteAndSimpleReadback)
 {
   const std::vector<u8> TEST_DATA{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
   std::vector<u8> read_buffer(TEST_DATA.size());
@@ -346,7 +485,7 @@ TEST_F(FileSystemTest, WriteAndSimpleReadback)
   EXPECT_EQ(TEST_DATA, read_buffer);
 }
 
-TEST_F(FileSystemTest, WriteAndRead)
+TEST_P(FileSystemTest, WriteAndRead)
 {
   const std::vector<u8> TEST_DATA{{0xf, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
   const u32 TEST_DATA_SIZE = static_cast<u32>(TEST_DATA.size());
@@ -384,7 +523,7 @@ TEST_F(FileSystemTest, WriteAndRead)
   EXPECT_EQ(m_fs->GetFileStatus(fd)->offset, TEST_DATA.size());
 }
 
-TEST_F(FileSystemTest, MultipleHandles)
+TEST_P(FileSystemTest, MultipleHandles)
 {
   ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/f", 0, modes), ResultCode::Success);
 
@@ -418,7 +557,7 @@ TEST_F(FileSystemTest, MultipleHandles)
 
 // ReadDirectory is used by official titles to determine whether a path is a file.
 // If it is not a file, ResultCode::Invalid must be returned.
-TEST_F(FileSystemTest, ReadDirectoryOnFile)
+TEST_P(FileSystemTest, ReadDirectoryOnFile)
 {
   ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/f", 0, modes), ResultCode::Success);
 
@@ -427,7 +566,7 @@ TEST_F(FileSystemTest, ReadDirectoryOnFile)
   EXPECT_EQ(result.Error(), ResultCode::Invalid);
 }
 
-TEST_F(FileSystemTest, ReadDirectoryOrdering)
+TEST_P(FileSystemTest, ReadDirectoryOrdering)
 {
   ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/o", 0, modes), ResultCode::Success);
 
@@ -451,7 +590,7 @@ TEST_F(FileSystemTest, ReadDirectoryOrdering)
   EXPECT_TRUE(std::equal(result->begin(), result->end(), file_names.rbegin()));
 }
 
-TEST_F(FileSystemTest, CreateFullPath)
+TEST_P(FileSystemTest, CreateFullPath)
 {
   ASSERT_EQ(m_fs->CreateFullPath(Uid{0}, Gid{0}, "/tmp/a/b/c/d", 0, modes), ResultCode::Success);
 
@@ -468,3 +607,9 @@ TEST_F(FileSystemTest, CreateFullPath)
   EXPECT_EQ(m_fs->CreateFullPath(Uid{0x1000}, Gid{1}, "/shared2/wc24/mbox/Readme.txt", 0, modes),
             ResultCode::Success);
 }
+
+INSTANTIATE_TEST_SUITE_P(Backends, FileSystemTest,
+                         testing::Values(Backend::Host, Backend::Memory),
+                         [](const testing::TestParamInfo<Backend>& info) {
+                           return info.param == Backend::Host ? "Host" : "Memory";
+                         });
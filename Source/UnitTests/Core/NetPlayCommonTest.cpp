@@ -0,0 +1,158 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <optional>
+#include <set>
+#include <vector>
+
+#include <SFML/Network/Packet.hpp>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/NetPlayCommon.h"
+
+namespace
+{
+std::vector<u8> MakeContents(size_t size, u8 seed)
+{
+  std::vector<u8> contents(size);
+  u32 state = seed;
+  for (size_t i = 0; i < size; ++i)
+  {
+    // Partly compressible, like most save data
+    state = state * 1103515245 + 12345;
+    contents[i] = i % 3 == 0 ? static_cast<u8>(state >> 24) : static_cast<u8>(i / 256);
+  }
+  return contents;
+}
+}  // namespace
+
+TEST(NetPlayCommon, RoundTrip)
+{
+  // Sizes around the chunk size, including one that is a multiple of it
+  const std::vector<std::vector<u8>> buffers = {
+      {}, MakeContents(1, 1), MakeContents(128 * 1024, 2), MakeContents(1000 * 1000, 3)};
+
+  NetPlay::SyncDataWriter writer;
+  sf::Packet packet;
+  for (const std::vector<u8>& buffer : buffers)
+    ASSERT_TRUE(writer.CompressBufferIntoPacket(buffer, packet));
+  EXPECT_EQ(writer.GetSkippedBytes(), 0u);
+
+  NetPlay::SyncDataReader reader;
+  reader.BeginSync();
+  for (const std::vector<u8>& buffer : buffers)
+    EXPECT_EQ(reader.DecompressPacketIntoBuffer(packet), buffer);
+  EXPECT_TRUE(packet.endOfPacket());
+}
+
+TEST(NetPlayCommon, SkipsKnownContents)
+{
+  const std::vector<u8> unchanged = MakeContents(500 * 1000, 1);
+  const std::vector<u8> changed = MakeContents(500 * 1000, 2);
+  const std::vector<u8> new_contents = MakeContents(500 * 1000, 3);
+
+  NetPlay::SyncDataReader reader;
+
+  NetPlay::SyncDataWriter first_writer;
+  sf::Packet first_packet;
+  ASSERT_TRUE(first_writer.CompressBufferIntoPacket(unchanged, first_packet));
+  ASSERT_TRUE(first_writer.CompressBufferIntoPacket(changed, first_packet));
+  reader.BeginSync();
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(first_packet), unchanged);
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(first_packet), changed);
+  reader.EndSync();
+
+  // Contents are only sent if they weren't in the previous sync or earlier in this one
+  NetPlay::SyncDataWriter second_writer(first_writer.GetWrittenHashes());
+  sf::Packet second_packet;
+  ASSERT_TRUE(second_writer.CompressBufferIntoPacket(unchanged, second_packet));
+  ASSERT_TRUE(second_writer.CompressBufferIntoPacket(new_contents, second_packet));
+  ASSERT_TRUE(second_writer.CompressBufferIntoPacket(new_contents, second_packet));
+  EXPECT_EQ(second_writer.GetSkippedBytes(), unchanged.size() + new_contents.size());
+  EXPECT_LT(second_packet.getDataSize(), first_packet.getDataSize());
+
+  reader.BeginSync();
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(second_packet), unchanged);
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(second_packet), new_contents);
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(second_packet), new_contents);
+  reader.EndSync();
+
+  // Only the contents of the last completed sync are kept
+  NetPlay::SyncDataWriter third_writer(first_writer.GetWrittenHashes());
+  sf::Packet third_packet;
+  ASSERT_TRUE(third_writer.CompressBufferIntoPacket(changed, third_packet));
+  reader.BeginSync();
+  EXPECT_EQ(reader.DecompressPacketIntoBuffer(third_packet), std::nullopt);
+}
+
+TEST(NetPlayCommon, TracksClientSyncedData)
+{
+  const std::set<NetPlay::SyncDataHash> first_hashes = {{1, 1}, {2, 2}};
+  const std::set<NetPlay::SyncDataHash> second_hashes = {{2, 2}, {3, 3}};
+
+  NetPlay::ClientSyncedData client_a;
+  NetPlay::ClientSyncedData client_b;
+  client_a.SetPendingHashes(first_hashes);
+  client_b.SetPendingHashes(first_hashes);
+
+  // Nothing counts before the client has acknowledged the sync
+  EXPECT_TRUE(client_a.GetHashes().empty());
+  client_a.OnSyncSucceeded();
+  EXPECT_EQ(client_a.GetHashes(), first_hashes);
+  EXPECT_TRUE(NetPlay::GetCommonSyncedData({&client_a, &client_b}).empty());
+  client_b.OnSyncSucceeded();
+  EXPECT_EQ(NetPlay::GetCommonSyncedData({&client_a, &client_b}), first_hashes);
+
+  // An aborted sync leaves what the clients kept before it, even if they acknowledge it late
+  client_a.SetPendingHashes(second_hashes);
+  client_b.SetPendingHashes(second_hashes);
+  client_a.DiscardPendingHashes();
+  client_b.DiscardPendingHashes();
+  EXPECT_EQ(client_a.GetHashes(), first_hashes);
+  client_b.OnSyncSucceeded();
+  EXPECT_TRUE(client_b.GetHashes().empty());
+  EXPECT_TRUE(NetPlay::GetCommonSyncedData({&client_a, &client_b}).empty());
+
+  // A client that failed to process the data is sent everything again
+  client_a.SetPendingHashes(second_hashes);
+  client_a.OnSyncFailed();
+  EXPECT_TRUE(client_a.GetHashes().empty());
+  client_a.OnSyncSucceeded();
+  EXPECT_TRUE(client_a.GetHashes().empty());
+}
+
+TEST(NetPlayCommon, AbortedSyncKeepsCompletedContents)
+{
+  const std::vector<u8> contents = MakeContents(200 * 1000, 1);
+  const std::vector<u8> other_contents = MakeContents(200 * 1000, 2);
+
+  NetPlay::ClientSyncedData client;
+  NetPlay::SyncDataReader reader;
+
+  const auto sync = [&](const std::vector<u8>& buffer, bool complete) {
+    NetPlay::SyncDataWriter writer(NetPlay::GetCommonSyncedData({&client}));
+    sf::Packet packet;
+    EXPECT_TRUE(writer.CompressBufferIntoPacket(buffer, packet));
+    client.SetPendingHashes(writer.GetWrittenHashes());
+
+    reader.BeginSync();
+    EXPECT_EQ(reader.DecompressPacketIntoBuffer(packet), buffer);
+    if (complete)
+    {
+      reader.EndSync();
+      client.OnSyncSucceeded();
+    }
+    else
+    {
+      // e.g. another player failed to synchronize
+      client.DiscardPendingHashes();
+    }
+    return writer.GetSkippedBytes();
+  };
+
+  EXPECT_EQ(sync(contents, true), 0u);
+  EXPECT_EQ(sync(other_contents, false), 0u);
+  // The client still has the contents of the first sync
+  EXPECT_EQ(sync(contents, true), contents.size());
+}
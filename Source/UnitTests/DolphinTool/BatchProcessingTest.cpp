@@ -0,0 +1,139 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <picojson.h>
+
+#include "Common/FileUtil.h"
+#include "DolphinTool/BatchProcessing.h"
+
+using namespace DolphinTool;
+
+class BatchProcessingTest : public testing::Test
+{
+protected:
+  BatchProcessingTest()
+      : m_directory(File::CreateTempDir()), m_manifest_path(m_directory + "/manifest.jsonl")
+  {
+  }
+
+  ~BatchProcessingTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  // Inputs are only found based on their extension, so these don't need any real contents
+  std::string WriteFile(const std::string& name, const std::string& contents = {})
+  {
+    const std::string path = m_directory + '/' + name;
+    File::CreateFullPath(path);
+    File::WriteStringToFile(path, contents);
+    return path;
+  }
+
+  const std::string m_directory;
+  const std::string m_manifest_path;
+};
+
+TEST_F(BatchProcessingTest, FindInputsInDirectory)
+{
+  const std::string game = WriteFile("games/b.iso");
+  const std::string nested_game = WriteFile("games/a/game.rvz");
+  WriteFile("games/readme.txt");
+
+  const std::optional<std::vector<BatchInput>> inputs = FindBatchInputs(m_directory + "/games");
+  ASSERT_TRUE(inputs);
+  ASSERT_EQ(2u, inputs->size());
+  EXPECT_EQ(nested_game, (*inputs)[0].path);
+  EXPECT_EQ("a/game.rvz", (*inputs)[0].relative_path);
+  EXPECT_EQ(game, (*inputs)[1].path);
+  EXPECT_EQ("b.iso", (*inputs)[1].relative_path);
+}
+
+TEST_F(BatchProcessingTest, FindInputsInList)
+{
+  const std::string list = WriteFile("list.txt", "  /games/b.iso\r\n\n/other/a.wbfs\n");
+
+  const std::optional<std::vector<BatchInput>> inputs = FindBatchInputs(list);
+  ASSERT_TRUE(inputs);
+  ASSERT_EQ(2u, inputs->size());
+  EXPECT_EQ("/games/b.iso", (*inputs)[0].path);
+  EXPECT_EQ("b.iso", (*inputs)[0].relative_path);
+  EXPECT_EQ("/other/a.wbfs", (*inputs)[1].path);
+  EXPECT_EQ("a.wbfs", (*inputs)[1].relative_path);
+
+  EXPECT_FALSE(FindBatchInputs(m_directory + "/missing.txt"));
+}
+
+TEST_F(BatchProcessingTest, ManifestSkipsTruncatedLine)
+{
+  File::WriteStringToFile(m_manifest_path, "{\"input\":\"a.iso\",\"success\":true}\n"
+                                           "{\"input\":\"b.iso\",\"success\":false}\n"
+                                           "not json\n"
+                                           "{\"input\":\"c.iso\",\"success\":tr");
+
+  {
+    BatchManifest manifest;
+    ASSERT_TRUE(manifest.Open(m_manifest_path));
+    EXPECT_TRUE(manifest.HasSucceeded("a.iso"));
+    EXPECT_FALSE(manifest.HasSucceeded("b.iso"));
+    EXPECT_FALSE(manifest.HasSucceeded("c.iso"));
+
+    picojson::object entry;
+    entry["input"] = picojson::value("c.iso");
+    entry["success"] = picojson::value(true);
+    ASSERT_TRUE(manifest.Add(entry));
+  }
+
+  // The new entry doesn't get appended to the truncated line
+  BatchManifest manifest;
+  ASSERT_TRUE(manifest.Open(m_manifest_path));
+  EXPECT_TRUE(manifest.HasSucceeded("a.iso"));
+  EXPECT_TRUE(manifest.HasSucceeded("c.iso"));
+}
+
+TEST_F(BatchProcessingTest, RunSkipsSucceededInputs)
+{
+  File::WriteStringToFile(m_manifest_path, "{\"input\":\"a.iso\",\"success\":true}\n"
+                                           "{\"input\":\"b.iso\",\"success\":false}\n");
+  const std::vector<BatchInput> inputs = {
+      {"a.iso", "a.iso"}, {"b.iso", "b.iso"}, {"c.iso", "c.iso"}, {"d.iso", "d.iso"}};
+
+  {
+    BatchManifest manifest;
+    ASSERT_TRUE(manifest.Open(m_manifest_path));
+
+    std::mutex mutex;
+    std::set<std::string> processed;
+    const bool success =
+        RunBatch(inputs, 2, &manifest, [&](const BatchInput& input, picojson::object* entry) {
+          (*entry)["size"] = picojson::value(1.0);
+          std::lock_guard guard(mutex);
+          processed.insert(input.path);
+          return input.path != "d.iso";
+        });
+
+    EXPECT_FALSE(success);
+    EXPECT_EQ((std::set<std::string>{"b.iso", "c.iso", "d.iso"}), processed);
+  }
+
+  BatchManifest manifest;
+  ASSERT_TRUE(manifest.Open(m_manifest_path));
+  EXPECT_TRUE(manifest.HasSucceeded("a.iso"));
+  EXPECT_TRUE(manifest.HasSucceeded("b.iso"));
+  EXPECT_TRUE(manifest.HasSucceeded("c.iso"));
+  EXPECT_FALSE(manifest.HasSucceeded("d.iso"));
+}
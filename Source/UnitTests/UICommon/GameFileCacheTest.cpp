@@ -0,0 +1,154 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "UICommon/GameFile.h"
+#include "UICommon/GameFileCache.h"
+
+namespace
+{
+std::set<std::string> GetCachedPaths(const UICommon::GameFileCache& cache)
+{
+  std::set<std::string> paths;
+  cache.ForEach([&paths](const std::shared_ptr<const UICommon::GameFile>& game) {
+    paths.insert(game->GetFilePath());
+  });
+  return paths;
+}
+}  // namespace
+
+class GameFileCacheTest : public testing::Test
+{
+protected:
+  GameFileCacheTest()
+      : m_directory(File::CreateTempDir()), m_cache_path(m_directory + "/gamelist.cache")
+  {
+  }
+
+  ~GameFileCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  // DOLs are accepted based on their extension, so these don't need any real contents
+  std::string WriteGame(const std::string& name, const std::string& contents)
+  {
+    const std::string path = m_directory + '/' + name;
+    File::WriteStringToFile(path, contents);
+    return path;
+  }
+
+  const std::string m_directory;
+  const std::string m_cache_path;
+};
+
+TEST_F(GameFileCacheTest, SaveAndLoad)
+{
+  std::vector<std::string> paths;
+  for (int i = 0; i < 50; ++i)
+    paths.push_back(WriteGame("game" + std::to_string(i) + ".dol", std::to_string(i)));
+
+  UICommon::GameFileCache cache(m_cache_path);
+  EXPECT_FALSE(cache.Load());
+
+  size_t added = 0;
+  EXPECT_TRUE(cache.Update(paths, [&added](const auto&) { ++added; }));
+  EXPECT_EQ(added, paths.size());
+  EXPECT_TRUE(cache.Save());
+
+  UICommon::GameFileCache loaded_cache(m_cache_path);
+  ASSERT_TRUE(loaded_cache.Load());
+  EXPECT_EQ(GetCachedPaths(loaded_cache), std::set<std::string>(paths.begin(), paths.end()));
+
+  // Nothing has changed, so nothing is rescanned or written
+  const u64 cache_size = File::GetSize(m_cache_path);
+  EXPECT_FALSE(loaded_cache.Update(paths));
+  EXPECT_TRUE(loaded_cache.Save());
+  EXPECT_EQ(File::GetSize(m_cache_path), cache_size);
+}
+
+TEST_F(GameFileCacheTest, IncrementalUpdate)
+{
+  std::vector<std::string> paths;
+  for (int i = 0; i < 50; ++i)
+    paths.push_back(WriteGame("game" + std::to_string(i) + ".dol", std::to_string(i)));
+
+  UICommon::GameFileCache cache(m_cache_path);
+  cache.Update(paths);
+  ASSERT_TRUE(cache.Save());
+  const u64 full_cache_size = File::GetSize(m_cache_path);
+
+  // A changed file is reported as removed and added again
+  WriteGame("game3.dol", "a different size");
+  const std::string removed_path = paths.back();
+  paths.pop_back();
+  paths.push_back(WriteGame("new.dol", "new"));
+
+  std::vector<std::string> added;
+  std::vector<std::string> removed;
+  EXPECT_TRUE(cache.Update(
+      paths, [&added](const auto& game) { added.push_back(game->GetFilePath()); },
+      [&removed](const std::string& path) { removed.push_back(path); }));
+  EXPECT_EQ(std::set<std::string>(added.begin(), added.end()),
+            std::set<std::string>({paths[3], paths.back()}));
+  EXPECT_EQ(std::set<std::string>(removed.begin(), removed.end()),
+            std::set<std::string>({paths[3], removed_path}));
+
+  // Only the changes are appended to the cache file
+  ASSERT_TRUE(cache.Save());
+  const u64 cache_size = File::GetSize(m_cache_path);
+  EXPECT_GT(cache_size, full_cache_size);
+  EXPECT_LT(cache_size - full_cache_size, full_cache_size / 4);
+
+  UICommon::GameFileCache loaded_cache(m_cache_path);
+  ASSERT_TRUE(loaded_cache.Load());
+  EXPECT_EQ(GetCachedPaths(loaded_cache), std::set<std::string>(paths.begin(), paths.end()));
+  loaded_cache.ForEach([&](const std::shared_ptr<const UICommon::GameFile>& game) {
+    if (game->GetFilePath() == paths[3])
+      EXPECT_EQ(game->GetFileSize(), 16u);
+  });
+}
+
+TEST_F(GameFileCacheTest, InterruptedSave)
+{
+  std::vector<std::string> paths;
+  for (int i = 0; i < 10; ++i)
+    paths.push_back(WriteGame("game" + std::to_string(i) + ".dol", std::to_string(i)));
+
+  UICommon::GameFileCache cache(m_cache_path);
+  cache.Update(paths);
+  ASSERT_TRUE(cache.Save());
+
+  // The start of a record that was never finished
+  {
+    File::IOFile file(m_cache_path, "ab");
+    const u32 record_size = 1000;
+    ASSERT_TRUE(file.WriteArray(&record_size, 1));
+  }
+
+  UICommon::GameFileCache loaded_cache(m_cache_path);
+  ASSERT_TRUE(loaded_cache.Load());
+  EXPECT_EQ(GetCachedPaths(loaded_cache), std::set<std::string>(paths.begin(), paths.end()));
+
+  // The cut off record is dropped when saving
+  ASSERT_TRUE(loaded_cache.Save());
+  UICommon::GameFileCache reloaded_cache(m_cache_path);
+  ASSERT_TRUE(reloaded_cache.Load());
+  EXPECT_EQ(GetCachedPaths(reloaded_cache), std::set<std::string>(paths.begin(), paths.end()));
+}
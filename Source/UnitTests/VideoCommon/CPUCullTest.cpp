@@ -0,0 +1,286 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/System.h"
+#include "VideoCommon/BPMemory.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/CPUCull.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
+#include "VideoCommon/XFMemory.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+constexpr u32 POSITION_MATRIX = 3;
+constexpr u32 NUM_PER_VERTEX_MATRICES = 8;
+
+// All values are small integers or powers of two, so that the transforms are exact no matter in
+// which order they are done. The clip space w is offset a little so that no position lies exactly
+// on the edge of the screen.
+void SetUpMatrices()
+{
+  for (u32 i = 0; i < NUM_PER_VERTEX_MATRICES; ++i)
+  {
+    float* matrix = &xfmem.posMatrices[i * 4 * 3];
+    const float scale = i % 2 ? 0.5f : 1.0f;
+    const std::array<float, 12> values = {scale, 0,     1.0f * (i % 3), float(i) - 4,
+                                          0,     scale, 0,              2 - float(i),
+                                          0,     1,     scale,          0};
+    std::memcpy(matrix, values.data(), sizeof(values));
+  }
+  g_main_cp_state.matrix_index_a.PosNormalMtxIdx = POSITION_MATRIX * 3;
+
+  // w is positive for all positions used here
+  auto& projection = Core::System::GetInstance().GetVertexShaderManager().constants.projection;
+  projection = {{{0.5f, 0, 0, 0}, {0, 0.25f, 0, 0}, {0, 0, 0.5f, 1}, {0, 0, 0.25f, 8.0625f}}};
+}
+
+struct TestVertices
+{
+  PortableVertexDeclaration vtx_decl;
+  std::vector<u8> data;
+};
+
+TestVertices MakeVertices(u32 count, bool has_3_elems, bool per_vertex_posmtx, u32 seed)
+{
+  TestVertices vertices;
+  PortableVertexDeclaration& decl = vertices.vtx_decl;
+  decl.posmtx.enable = per_vertex_posmtx;
+  decl.position.enable = true;
+  decl.position.components = has_3_elems ? 3 : 2;
+  decl.position.offset = per_vertex_posmtx ? sizeof(u32) : 0;
+  // Something else follows the position, like in real vertex formats
+  decl.stride = decl.position.offset + decl.position.components * sizeof(float) + sizeof(u32);
+
+  // Padded like the vertex manager's buffers
+  vertices.data.resize(count * decl.stride + 4);
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> coordinate(-12, 12);
+  std::uniform_int_distribution<u32> matrix(0, NUM_PER_VERTEX_MATRICES - 1);
+  for (u32 i = 0; i < count; ++i)
+  {
+    u8* vertex = &vertices.data[i * decl.stride];
+    if (per_vertex_posmtx)
+    {
+      const u32 index = matrix(rng) * 3;
+      std::memcpy(vertex, &index, sizeof(index));
+    }
+    for (int j = 0; j < decl.position.components; ++j)
+    {
+      const float value = float(coordinate(rng));
+      std::memcpy(vertex + decl.position.offset + j * sizeof(float), &value, sizeof(value));
+    }
+  }
+  return vertices;
+}
+
+// Straightforward version of what CPUCull does
+std::vector<bool> CullReference(const TestVertices& vertices, Primitive primitive, CullMode mode,
+                                u32 count)
+{
+  const auto& projection =
+      Core::System::GetInstance().GetVertexShaderManager().constants.projection;
+  std::vector<std::array<float, 4>> clip(count);
+  for (u32 i = 0; i < count; ++i)
+  {
+    const u8* vertex = &vertices.data[i * vertices.vtx_decl.stride];
+    u32 matrix_index = g_main_cp_state.matrix_index_a.PosNormalMtxIdx;
+    if (vertices.vtx_decl.posmtx.enable)
+      std::memcpy(&matrix_index, vertex, sizeof(matrix_index));
+    const float* matrix = &xfmem.posMatrices[(matrix_index & 0x3f) * 4];
+
+    std::array<float, 4> position = {0, 0, 0, 1};
+    std::memcpy(position.data(), vertex + vertices.vtx_decl.position.offset,
+                vertices.vtx_decl.position.components * sizeof(float));
+    std::array<float, 4> world = {0, 0, 0, 1};
+    for (int row = 0; row < 3; ++row)
+    {
+      for (int col = 0; col < 4; ++col)
+        world[row] += matrix[row * 4 + col] * position[col];
+    }
+    for (int row = 0; row < 4; ++row)
+    {
+      clip[i][row] = 0;
+      for (int col = 0; col < 4; ++col)
+        clip[i][row] += projection[row][col] * world[col];
+    }
+  }
+
+  std::vector<std::array<u32, 3>> triangles;
+  switch (primitive)
+  {
+  case Primitive::GX_DRAW_QUADS:
+    for (u32 i = 0; i + 3 <= count; i += 4)
+    {
+      triangles.push_back({i, i + 1, i + 2});
+      if (i + 4 <= count)
+        triangles.push_back({i, i + 2, i + 3});
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLES:
+    for (u32 i = 0; i + 3 <= count; i += 3)
+      triangles.push_back({i, i + 1, i + 2});
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_STRIP:
+    for (u32 i = 0; i + 3 <= count; ++i)
+    {
+      if (i % 2)
+        triangles.push_back({i, i + 2, i + 1});
+      else
+        triangles.push_back({i, i + 1, i + 2});
+    }
+    break;
+  case Primitive::GX_DRAW_TRIANGLE_FAN:
+    for (u32 i = 1; i + 2 <= count; ++i)
+      triangles.push_back({0, i, i + 1});
+    break;
+  default:
+    break;
+  }
+
+  std::vector<bool> visible;
+  for (const auto& triangle : triangles)
+  {
+    const auto& a = clip[triangle[0]];
+    const auto& b = clip[triangle[1]];
+    const auto& c = clip[triangle[2]];
+    const float normal_z_dir = (c[3] * a[0] - a[3] * c[0]) * b[1] +  //
+                               (c[0] * a[1] - a[0] * c[1]) * b[3] +  //
+                               (c[1] * a[3] - a[1] * c[3]) * b[0];
+    bool culled = (mode == CullMode::None && normal_z_dir == 0) ||
+                  (mode == CullMode::Front && normal_z_dir <= 0) ||
+                  (mode == CullMode::Back && normal_z_dir >= 0);
+    for (int axis = 0; axis < 2; ++axis)
+    {
+      culled |= a[axis] < -a[3] && b[axis] < -b[3] && c[axis] < -c[3];
+      culled |= a[axis] > a[3] && b[axis] > b[3] && c[axis] > c[3];
+    }
+    visible.push_back(!culled);
+  }
+  return visible;
+}
+}  // namespace
+
+class CPUCullTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_cull.Init();
+    SetUpMatrices();
+  }
+
+  CPUCull m_cull;
+};
+
+TEST_F(CPUCullTest, MatchesReference)
+{
+  for (const Primitive primitive : {Primitive::GX_DRAW_QUADS, Primitive::GX_DRAW_TRIANGLES,
+                                    Primitive::GX_DRAW_TRIANGLE_STRIP,
+                                    Primitive::GX_DRAW_TRIANGLE_FAN})
+  {
+    for (const CullMode mode : {CullMode::None, CullMode::Back, CullMode::Front})
+    {
+      // Counts which leave all kinds of remainders after groups of eight vertices
+      for (const u32 count : {3u, 4u, 9u, 15u, 64u, 203u})
+      {
+        for (const int format : {0, 1, 2, 3})
+        {
+          const bool has_3_elems = format & 1;
+          const bool per_vertex_posmtx = format & 2;
+          SCOPED_TRACE(fmt::format("primitive {} mode {} count {} format {}",
+                                   static_cast<int>(primitive), static_cast<int>(mode), count,
+                                   format));
+
+          const TestVertices vertices =
+              MakeVertices(count, has_3_elems, per_vertex_posmtx, count * 4 + format);
+          const std::vector<bool> expected = CullReference(vertices, primitive, mode, count);
+          ASSERT_EQ(expected.size(), IndexGenerator::GetTriangleCount(primitive, count));
+
+          const u32 num_visible =
+              m_cull.CullTriangles(vertices.vtx_decl, primitive, mode, vertices.data.data(), count);
+          u32 expected_visible = 0;
+          for (size_t i = 0; i < expected.size(); ++i)
+          {
+            const bool visible = (m_cull.GetVisibleTriangles()[i / 64] >> (i % 64)) & 1;
+            EXPECT_EQ(expected[i], visible) << "triangle " << i;
+            expected_visible += expected[i];
+          }
+          EXPECT_EQ(expected_visible, num_visible);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CPUCullTest, CullAll)
+{
+  const TestVertices vertices = MakeVertices(30, true, false, 1);
+  EXPECT_EQ(0u, m_cull.CullTriangles(vertices.vtx_decl, Primitive::GX_DRAW_TRIANGLES,
+                                     CullMode::All, vertices.data.data(), 30));
+}
+
+TEST(IndexGenerator, VisibleTriangles)
+{
+  const u64 visible = (1 << 1) | (1 << 6);
+  const u64 visible_quads = (1 << 1) | (1 << 2);
+  const bool old_primitive_restart = g_Config.backend_info.bSupportsPrimitiveRestart;
+
+  for (const bool primitive_restart : {false, true})
+  {
+    g_Config.backend_info.bSupportsPrimitiveRestart = primitive_restart;
+    IndexGenerator generator;
+    generator.Init();
+    std::array<u16, 64> indices{};
+
+    // Triangles 1 and 6 of a strip, the second one is wound the other way around
+    generator.Start(indices.data());
+    generator.AddVisibleIndices(Primitive::GX_DRAW_TRIANGLE_STRIP, 10, &visible, 2);
+    std::vector<u16> expected = {1, 3, 2, 6, 7, 8};
+    if (primitive_restart)
+      expected = {1, 3, 2, UINT16_MAX, 6, 7, 8, UINT16_MAX};
+    EXPECT_EQ(expected, std::vector<u16>(indices.begin(), indices.begin() + expected.size()));
+    EXPECT_EQ(expected.size(), generator.GetIndexLen());
+    EXPECT_EQ(10u, generator.GetNumVerts());
+
+    // Following vertices are offset as usual
+    generator.AddVisibleIndices(Primitive::GX_DRAW_QUADS, 8, &visible_quads, 2);
+    expected = {10, 12, 13, 14, 15, 16};
+    const size_t start = primitive_restart ? 8 : 6;
+    const size_t per_triangle = primitive_restart ? 4 : 3;
+    for (size_t i = 0; i < 2; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+        EXPECT_EQ(expected[i * 3 + j], indices[start + i * per_triangle + j]);
+    }
+    EXPECT_EQ(18u, generator.GetNumVerts());
+
+    // If every triangle is visible, the regular indices are used
+    const u64 all = 0xff;
+    std::array<u16, 64> regular{};
+    generator.Start(regular.data());
+    generator.AddIndices(Primitive::GX_DRAW_TRIANGLE_FAN, 10);
+    const u32 regular_length = generator.GetIndexLen();
+    generator.Start(indices.data());
+    generator.AddVisibleIndices(Primitive::GX_DRAW_TRIANGLE_FAN, 10, &all, 8);
+    ASSERT_EQ(regular_length, generator.GetIndexLen());
+    EXPECT_TRUE(std::equal(regular.begin(), regular.begin() + regular_length, indices.begin()));
+  }
+
+  g_Config.backend_info.bSupportsPrimitiveRestart = old_primitive_restart;
+}
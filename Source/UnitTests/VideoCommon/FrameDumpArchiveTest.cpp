@@ -0,0 +1,170 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "VideoCommon/FrameDumpArchive.h"
+
+using VideoCommon::FrameDumpArchive;
+
+namespace
+{
+struct TestFrame
+{
+  u32 width;
+  u32 height;
+  u32 stride;
+  std::vector<u8> rgba;
+};
+
+TestFrame MakeFrame(u32 width, u32 height, bool noisy)
+{
+  TestFrame frame{width, height, width * 4 + 12, {}};
+  frame.rgba.resize(frame.stride * height);
+  u32 state = width * 31 + height;
+  for (u32 y = 0; y < height; ++y)
+  {
+    for (u32 x = 0; x < frame.stride; ++x)
+    {
+      state = state * 1103515245 + 12345;
+      frame.rgba[y * frame.stride + x] = noisy ? static_cast<u8>(state >> 16) : static_cast<u8>(y);
+    }
+  }
+  return frame;
+}
+
+std::vector<u8> ToRGB(const TestFrame& frame)
+{
+  std::vector<u8> rgb;
+  for (u32 y = 0; y < frame.height; ++y)
+  {
+    for (u32 x = 0; x < frame.width; ++x)
+    {
+      const u8* pixel = &frame.rgba[y * frame.stride + x * 4];
+      rgb.insert(rgb.end(), pixel, pixel + 3);
+    }
+  }
+  return rgb;
+}
+}  // namespace
+
+class FrameDumpArchiveTest : public testing::Test
+{
+protected:
+  FrameDumpArchiveTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/dump.dfa"),
+        m_frames{MakeFrame(64, 48, false), MakeFrame(64, 48, true), MakeFrame(33, 17, false)}
+  {
+  }
+
+  ~FrameDumpArchiveTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  void WriteFrames(FrameDumpArchive::Writer* writer)
+  {
+    ASSERT_TRUE(writer->Open(m_path));
+    for (u32 i = 0; i < m_frames.size(); ++i)
+    {
+      const TestFrame& frame = m_frames[i];
+      ASSERT_TRUE(writer->AddFrame(frame.rgba.data(), frame.width, frame.height, frame.stride,
+                                   1000 * i, i + 5));
+    }
+  }
+
+  void CheckFrames(FrameDumpArchive* archive, size_t count)
+  {
+    ASSERT_EQ(count, archive->GetFrames().size());
+    std::vector<u8> rgb;
+    for (u32 i = 0; i < count; ++i)
+    {
+      const FrameDumpArchive::FrameInfo& info = archive->GetFrames()[i];
+      const std::vector<u8> expected = ToRGB(m_frames[i]);
+      EXPECT_EQ(m_frames[i].width, info.width);
+      EXPECT_EQ(m_frames[i].height, info.height);
+      EXPECT_EQ(1000u * i, info.ticks);
+      EXPECT_EQ(i + 5, info.frame_number);
+      EXPECT_EQ(FrameDumpArchive::HashPixels(expected.data(), expected.size()), info.hash);
+
+      ASSERT_TRUE(archive->ReadFrame(i, &rgb));
+      EXPECT_EQ(expected, rgb);
+    }
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+  const std::vector<TestFrame> m_frames;
+};
+
+TEST_F(FrameDumpArchiveTest, RoundTrip)
+{
+  FrameDumpArchive::Writer writer;
+  WriteFrames(&writer);
+  ASSERT_TRUE(writer.Finish());
+
+  const std::unique_ptr<FrameDumpArchive> archive = FrameDumpArchive::Open(m_path);
+  ASSERT_NE(nullptr, archive);
+  CheckFrames(archive.get(), m_frames.size());
+
+  // The flat frames are compressed, the noise is stored as is.
+  EXPECT_LT(File::GetSize(m_path), 64 * 48 * 3 * 2 + 33 * 17 * 3);
+}
+
+TEST_F(FrameDumpArchiveTest, UnfinishedDumpIsScanned)
+{
+  {
+    FrameDumpArchive::Writer writer;
+    WriteFrames(&writer);
+  }
+
+  const std::unique_ptr<FrameDumpArchive> archive = FrameDumpArchive::Open(m_path);
+  ASSERT_NE(nullptr, archive);
+  CheckFrames(archive.get(), m_frames.size());
+
+  // A frame which was cut off is left out.
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+  contents.resize(contents.size() - 10);
+  ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+
+  const std::unique_ptr<FrameDumpArchive> truncated = FrameDumpArchive::Open(m_path);
+  ASSERT_NE(nullptr, truncated);
+  CheckFrames(truncated.get(), m_frames.size() - 1);
+}
+
+TEST_F(FrameDumpArchiveTest, RejectsOtherFiles)
+{
+  ASSERT_TRUE(File::WriteStringToFile(m_path, "not a frame dump archive"));
+  EXPECT_EQ(nullptr, FrameDumpArchive::Open(m_path));
+}
+
+TEST_F(FrameDumpArchiveTest, RejectsBogusFrameCount)
+{
+  FrameDumpArchive::Writer writer;
+  WriteFrames(&writer);
+  ASSERT_TRUE(writer.Finish());
+
+  // Claim more frames than the index can hold.
+  std::string contents;
+  ASSERT_TRUE(File::ReadFileToString(m_path, contents));
+  const u32 num_frames = 0xffffffff;
+  std::memcpy(contents.data() + 16, &num_frames, sizeof(num_frames));
+  ASSERT_TRUE(File::WriteStringToFile(m_path, contents));
+
+  EXPECT_EQ(nullptr, FrameDumpArchive::Open(m_path));
+}
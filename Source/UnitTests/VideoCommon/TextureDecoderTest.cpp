@@ -0,0 +1,150 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr TextureFormat DECODED_FORMATS[] = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+constexpr TLUTFormat TLUT_FORMATS[] = {TLUTFormat::IA8, TLUTFormat::RGB565, TLUTFormat::RGB5A3};
+
+bool IsPaletted(TextureFormat format)
+{
+  return format == TextureFormat::C4 || format == TextureFormat::C8 ||
+         format == TextureFormat::C14X2;
+}
+
+std::vector<u8> MakeRandomData(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+    byte = static_cast<u8>(dist(rng));
+  return data;
+}
+
+// Restores the detected CPU features when a test forces a narrower code path.
+class ScopedCPUFeatures
+{
+public:
+  ScopedCPUFeatures() : m_saved(cpu_info) {}
+  ~ScopedCPUFeatures() { cpu_info = m_saved; }
+
+private:
+  CPUInfo m_saved;
+};
+
+void CheckAgainstTexelDecoder(TextureFormat format, TLUTFormat tlut_format, int width, int height,
+                              const std::vector<u8>& src, const std::vector<u8>& tlut)
+{
+  std::vector<u8> decoded(width * height * 4);
+  TexDecoder_Decode(decoded.data(), src.data(), width, height, format, tlut.data(), tlut_format);
+
+  for (int t = 0; t < height; ++t)
+  {
+    for (int s = 0; s < width; ++s)
+    {
+      // Like the software renderer, DecodeTexel takes the width minus one.
+      u8 expected[4];
+      TexDecoder_DecodeTexel(expected, src.data(), s, t, width - 1, format, tlut.data(),
+                             tlut_format);
+      const u8* actual = &decoded[(t * width + s) * 4];
+      if (std::memcmp(expected, actual, sizeof(expected)) != 0)
+      {
+        ADD_FAILURE() << fmt::format("{} (TLUT {}) mismatch at ({}, {})", format, tlut_format, s,
+                                     t);
+        return;
+      }
+    }
+  }
+}
+
+void CheckAllFormats()
+{
+  constexpr int width = 64;
+  constexpr int height = 32;
+  const std::vector<u8> tlut = MakeRandomData(TexDecoder_GetPaletteSize(TextureFormat::C14X2), 1);
+
+  u32 seed = 2;
+  for (TextureFormat format : DECODED_FORMATS)
+  {
+    const std::vector<u8> src =
+        MakeRandomData(TexDecoder_GetTextureSizeInBytes(width, height, format), seed++);
+    if (IsPaletted(format))
+    {
+      for (TLUTFormat tlut_format : TLUT_FORMATS)
+        CheckAgainstTexelDecoder(format, tlut_format, width, height, src, tlut);
+    }
+    else
+    {
+      CheckAgainstTexelDecoder(format, TLUTFormat::IA8, width, height, src, tlut);
+    }
+  }
+}
+}  // namespace
+
+TEST(TextureDecoder, MatchesTexelDecoder)
+{
+  CheckAllFormats();
+}
+
+TEST(TextureDecoder, MatchesTexelDecoderWithoutAVX2)
+{
+  ScopedCPUFeatures saved_features;
+  cpu_info.bAVX2 = false;
+  CheckAllFormats();
+}
+
+TEST(TextureDecoder, MatchesTexelDecoderWithoutSSSE3)
+{
+  ScopedCPUFeatures saved_features;
+  cpu_info.bAVX2 = false;
+  cpu_info.bSSSE3 = false;
+  CheckAllFormats();
+}
+
+TEST(TextureDecoder, DecodeRowsMatchesDecode)
+{
+  constexpr int width = 64;
+  constexpr int height = 48;
+  const std::vector<u8> tlut = MakeRandomData(TexDecoder_GetPaletteSize(TextureFormat::C14X2), 1);
+
+  // Keep the format overlay out of the comparison, as DecodeRows never draws it.
+  TexDecoder_SetTexFmtOverlayOptions(false, false);
+
+  u32 seed = 2;
+  for (TextureFormat format : DECODED_FORMATS)
+  {
+    const std::vector<u8> src =
+        MakeRandomData(TexDecoder_GetTextureSizeInBytes(width, height, format), seed++);
+    std::vector<u8> expected(width * height * 4);
+    TexDecoder_Decode(expected.data(), src.data(), width, height, format, tlut.data(),
+                      TLUTFormat::RGB5A3);
+
+    // Decode the slices out of order to make sure they don't depend on each other.
+    const int block_height = TexDecoder_GetBlockHeightInTexels(format);
+    std::vector<u8> actual(width * height * 4);
+    for (int first_row = height - block_height; first_row >= 0; first_row -= block_height)
+    {
+      TexDecoder_DecodeRows(actual.data(), src.data(), width, first_row, block_height, format,
+                            tlut.data(), TLUTFormat::RGB5A3);
+    }
+
+    EXPECT_EQ(expected, actual) << fmt::format("{}", format);
+  }
+}
@@ -0,0 +1,148 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "VideoCommon/Assets/CustomTextureData.h"
+#include "VideoCommon/Assets/TextureAsset.h"
+#include "VideoCommon/Assets/TexturePackLibrary.h"
+
+namespace
+{
+using Level = VideoCommon::CustomTextureData::ArraySlice::Level;
+
+Level MakeLevel(u32 width, u32 height, bool compressible)
+{
+  Level level;
+  level.width = width;
+  level.height = height;
+  level.row_length = width;
+  level.data.resize(width * height * 4);
+  u32 state = width * 31 + height;
+  for (u8& byte : level.data)
+  {
+    state = state * 1103515245 + 12345;
+    byte = compressible ? static_cast<u8>(width) : static_cast<u8>(state >> 16);
+  }
+  return level;
+}
+}  // namespace
+
+class TexturePackLibraryTest : public testing::Test
+{
+protected:
+  TexturePackLibraryTest()
+      : m_directory(File::CreateTempDir()), m_pack_path(m_directory + "/pack.dtp")
+  {
+  }
+
+  ~TexturePackLibraryTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_directory;
+  const std::string m_pack_path;
+};
+
+TEST_F(TexturePackLibraryTest, RoundTrip)
+{
+  // One texture compresses well, the other is stored uncompressed
+  VideoCommon::CustomTextureData flat;
+  auto& flat_levels = flat.m_slices.emplace_back().m_levels;
+  flat_levels.push_back(MakeLevel(64, 32, true));
+  flat_levels.push_back(MakeLevel(32, 16, true));
+
+  VideoCommon::CustomTextureData noisy;
+  noisy.m_slices.emplace_back().m_levels.push_back(MakeLevel(16, 16, false));
+
+  VideoCommon::TexturePackLibrary::Writer writer;
+  ASSERT_TRUE(writer.Open(m_pack_path));
+  ASSERT_TRUE(writer.AddTexture({"tex1_64x32_flat_0", false}, flat));
+  ASSERT_TRUE(writer.AddTexture({"tex1_16x16_noisy_0", true}, noisy));
+  ASSERT_TRUE(writer.Finish());
+
+  const auto library = VideoCommon::TexturePackLibrary::Open(m_pack_path);
+  ASSERT_NE(library, nullptr);
+  EXPECT_EQ(library->GetTextures().size(), 2u);
+
+  for (const auto& [asset_id, expected] :
+       {std::pair{"tex1_64x32_flat_0", &flat}, std::pair{"tex1_16x16_noisy_0", &noisy}})
+  {
+    VideoCommon::TextureData data;
+    const auto load_info = library->LoadGameTexture(asset_id, &data);
+    ASSERT_NE(load_info.m_bytes_loaded, 0u) << asset_id;
+    ASSERT_EQ(data.m_texture.m_slices.size(), 1u);
+
+    const auto& levels = data.m_texture.m_slices[0].m_levels;
+    const auto& expected_levels = expected->m_slices[0].m_levels;
+    ASSERT_EQ(levels.size(), expected_levels.size());
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+      EXPECT_EQ(levels[i].width, expected_levels[i].width);
+      EXPECT_EQ(levels[i].height, expected_levels[i].height);
+      EXPECT_EQ(levels[i].data, expected_levels[i].data);
+    }
+  }
+
+  VideoCommon::TextureData data;
+  EXPECT_EQ(library->LoadGameTexture("tex1_1x1_missing_0", &data).m_bytes_loaded, 0u);
+}
+
+TEST_F(TexturePackLibraryTest, RejectsTruncatedPack)
+{
+  VideoCommon::CustomTextureData texture;
+  texture.m_slices.emplace_back().m_levels.push_back(MakeLevel(8, 8, false));
+
+  VideoCommon::TexturePackLibrary::Writer writer;
+  ASSERT_TRUE(writer.Open(m_pack_path));
+  ASSERT_TRUE(writer.AddTexture({"tex1_8x8_texture_0", false}, texture));
+  ASSERT_TRUE(writer.Finish());
+
+  {
+    File::IOFile file(m_pack_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 1));
+  }
+  EXPECT_EQ(VideoCommon::TexturePackLibrary::Open(m_pack_path), nullptr);
+}
+
+TEST_F(TexturePackLibraryTest, RejectsInvalidIndex)
+{
+  // A slice without any levels
+  VideoCommon::CustomTextureData empty;
+  empty.m_slices.emplace_back();
+
+  VideoCommon::TexturePackLibrary::Writer writer;
+  ASSERT_TRUE(writer.Open(m_pack_path));
+  ASSERT_TRUE(writer.AddTexture({"tex1_8x8_empty_0", false}, empty));
+  ASSERT_TRUE(writer.Finish());
+  EXPECT_EQ(VideoCommon::TexturePackLibrary::Open(m_pack_path), nullptr);
+
+  // An index that is larger than the file
+  VideoCommon::CustomTextureData texture;
+  texture.m_slices.emplace_back().m_levels.push_back(MakeLevel(8, 8, false));
+  ASSERT_TRUE(writer.Open(m_pack_path));
+  ASSERT_TRUE(writer.AddTexture({"tex1_8x8_texture_0", false}, texture));
+  ASSERT_TRUE(writer.Finish());
+
+  {
+    File::IOFile file(m_pack_path, "r+b");
+    const u64 index_size = u64(1) << 60;
+    ASSERT_TRUE(file.Seek(16, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.WriteArray(&index_size, 1));
+  }
+  EXPECT_EQ(VideoCommon::TexturePackLibrary::Open(m_pack_path), nullptr);
+}
@@ -1,17 +1,21 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>  // NOLINT
 
 #include "Common/BitUtils.h"
+#include "Common/CPUDetect.h"
 #include "Common/Common.h"
 #include "Common/MathUtil.h"
+#include "Common/Swap.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -367,6 +371,81 @@ TEST_F(VertexLoaderTest, LargeFloatVertexSpeed)
     RunVertices(100000);
 }
 
+class VertexLoaderNormalAVX2Test : public VertexLoaderTest,
+                                   public ::testing::WithParamInterface<
+                                       std::tuple<VertexComponentFormat, ComponentFormat>>
+{
+protected:
+  static constexpr int COUNT = 100000;
+
+  void SetUp() override
+  {
+    VertexLoaderTest::SetUp();
+
+    const auto [addr, format] = GetParam();
+    m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+    m_vtx_attr.g0.PosFormat = ComponentFormat::Short;
+    m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+    m_vtx_desc.low.Normal = addr;
+    m_vtx_attr.g0.NormalFormat = format;
+    m_vtx_attr.g0.NormalElements = NormalComponentCount::NTB;
+
+    for (size_t i = 0; i < sizeof(input_memory); i++)
+      input_memory[i] = static_cast<u8>(i * 0x9E3779B1u >> 24);
+    if (addr == VertexComponentFormat::Index16)
+    {
+      // Keep the indices within the array.
+      const u32 vertex_size = 3 * sizeof(s16) + sizeof(u16);
+      for (u32 i = 0; i < COUNT; i++)
+      {
+        Common::BitCastPtr<u16>(input_memory + i * vertex_size + 6) =
+            Common::swap16(static_cast<u16>(i));
+      }
+      VertexLoaderManager::cached_arraybases[CPArray::Normal] = input_memory + COUNT * vertex_size;
+      g_main_cp_state.array_strides[CPArray::Normal] = 9 * sizeof(u16);
+    }
+  }
+
+  void TearDown() override { cpu_info = m_saved_cpu_info; }
+
+  // With AVX2, the normal, tangent and binormal of a vertex are converted at once.
+  void Run(bool avx2)
+  {
+    cpu_info.bAVX2 = avx2;
+    m_loader = VertexLoaderBase::CreateVertexLoader(m_vtx_desc, m_vtx_attr);
+    RunVertices(COUNT);
+  }
+
+  const CPUInfo m_saved_cpu_info = cpu_info;
+};
+INSTANTIATE_TEST_SUITE_P(
+    FormatsAndAddressing, VertexLoaderNormalAVX2Test,
+    ::testing::Combine(::testing::Values(VertexComponentFormat::Direct,
+                                         VertexComponentFormat::Index16),
+                       ::testing::Values(ComponentFormat::UByte, ComponentFormat::Byte,
+                                         ComponentFormat::UShort, ComponentFormat::Short)));
+
+TEST_P(VertexLoaderNormalAVX2Test, MatchesSSE)
+{
+  if (!m_saved_cpu_info.bAVX2)
+    GTEST_SKIP() << "AVX2 is not supported on this CPU.";
+
+  VertexLoaderManager::tangent_cache.fill(-1.0f);
+  VertexLoaderManager::binormal_cache.fill(-1.0f);
+  Run(false);
+  const size_t output_size = COUNT * m_loader->m_native_vtx_decl.stride;
+  const std::vector<u8> expected(output_memory, output_memory + output_size);
+  const std::array<float, 4> expected_tangent = VertexLoaderManager::tangent_cache;
+  const std::array<float, 4> expected_binormal = VertexLoaderManager::binormal_cache;
+
+  VertexLoaderManager::tangent_cache.fill(-1.0f);
+  VertexLoaderManager::binormal_cache.fill(-1.0f);
+  Run(true);
+  EXPECT_EQ(expected, std::vector<u8>(output_memory, output_memory + output_size));
+  EXPECT_EQ(expected_tangent, VertexLoaderManager::tangent_cache);
+  EXPECT_EQ(expected_binormal, VertexLoaderManager::binormal_cache);
+}
+
 TEST_F(VertexLoaderTest, DirectAllComponents)
 {
   m_vtx_desc.low.PosMatIdx = 1;